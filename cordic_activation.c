@@ -0,0 +1,614 @@
+/*******************************************************************************
+* File Name:   cordic_activation.c
+*
+* Description: This file contains the tanh and sigmoid activation kernels.
+* The peripheral covers hyperbolic arguments up to +/-60 degrees (about 1.05),
+* so larger arguments are halved k times and the result is restored with the
+* double-argument identity. Arguments whose result rounds to +/-1 in the output
+* format are saturated without a CORDIC operation. The sigmoid is evaluated as
+* (1 + tanh(x / 2)) / 2.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_activation.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Arguments are handled in Q27, which covers +/-16 */
+#define ACT_Q27_ONE              (1L << 27)
+
+/* Arguments beyond which tanh rounds to +/-1 in the output format, in Q27 */
+#define ACT_SAT_Q7               (436207616L)      /* 3.25 */
+#define ACT_SAT_Q15              (805306368L)      /* 6.0 */
+#define ACT_SAT_Q31              (1543503872L)     /* 11.5 */
+
+/* One in Q11 and in Q30 */
+#define ACT_Q11_ONE              (2048L)
+#define ACT_Q30_ONE              (1073741824LL)
+
+/* Benchmark: elements per layer and argument format */
+#define ACT_BENCH_SIZE           (64U)
+#define ACT_BENCH_INT_WIDTH      (3U)
+#define ACT_BENCH_ROWS           (6U)
+#define ACT_LUT_SIZE             (256U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t act_reduce(int32_t x_q27, CY_CORDIC_Q31_t *angle);
+static int32_t  act_tanh_q11(int32_t x_q27);
+static int32_t  act_tanh_q31(int32_t x_q27);
+static void     act_lut_q7(q7_t *data, uint32_t size, const q7_t *table);
+static void     act_lut_q15(q15_t *data, uint32_t size, const q15_t *table);
+static void     act_float_q31(q31_t *data, uint32_t size, cordic_act_type_t type);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Lookup tables of the CMSIS-NN style baseline, arguments with 3 integer bits */
+static q7_t  act_lut_q7_table[2][ACT_LUT_SIZE];
+static q15_t act_lut_q15_table[2][ACT_LUT_SIZE];
+
+/* Benchmark layer */
+static q7_t  act_bench_q7[ACT_BENCH_SIZE];
+static q15_t act_bench_q15[ACT_BENCH_SIZE];
+static q31_t act_bench_q31[ACT_BENCH_SIZE];
+static float32_t act_bench_input[ACT_BENCH_SIZE];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: act_reduce
+********************************************************************************
+* Summary:
+* Halves the argument until it is at most 1.0, inside the range of the
+* peripheral, and converts it to the Q31 angle format.
+*
+* Parameters:
+*  int32_t x_q27            Argument in Q27, below 16 in magnitude
+*  CY_CORDIC_Q31_t *angle   Receives the reduced argument, 2^31 = pi
+*
+* Return:
+*  uint32_t                 Number of halvings
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static uint32_t act_reduce(int32_t x_q27, CY_CORDIC_Q31_t *angle)
+{
+    uint32_t magnitude = (x_q27 < 0) ? (0U - (uint32_t)x_q27) : (uint32_t)x_q27;
+    uint32_t k         = 0;
+
+    while ((magnitude >> k) > (uint32_t)ACT_Q27_ONE)
+    {
+        k++;
+    }
+
+    *angle = (CY_CORDIC_Q31_t)(((int64_t)x_q27 * CORDIC_ANGLE_PER_RAD) >> (27U + k));
+
+    return k;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: act_tanh_q11
+********************************************************************************
+* Summary:
+* tanh with the single Cy_CORDIC_Tanh operation and its 20Q11 result, enough
+* for q7 outputs. Each halving of the argument is undone with
+* tanh(2y) = 2 tanh(y) / (1 + tanh(y)^2).
+*
+* Parameters:
+*  int32_t x_q27  Argument in Q27
+*
+* Return:
+*  int32_t        tanh in Q11
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static int32_t act_tanh_q11(int32_t x_q27)
+{
+    CY_CORDIC_Q31_t angle = 0;
+    uint32_t        k     = act_reduce(x_q27, &angle);
+    int32_t         t     = 0;
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_TANH, 1U, angle, 0, 0);
+    t = Cy_CORDIC_Tanh(MXCORDIC, angle);
+
+    for (; k > 0U; k--)
+    {
+        t = (t * (2L * ACT_Q11_ONE)) / (ACT_Q11_ONE + ((t * t) >> 11));
+    }
+
+    return t;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: act_tanh_q31
+********************************************************************************
+* Summary:
+* tanh as sinh / cosh from the 1Q30 results of the peripheral, for q15 and q31
+* outputs. Each halving of the argument is undone with the double-argument
+* identities sinh(2y) = 2 sinh(y) cosh(y) and cosh(2y) = cosh(y)^2 + sinh(y)^2;
+* only the ratio matters, so both are scaled down together when cosh grows.
+* One division at the end gives tanh.
+*
+* Parameters:
+*  int32_t x_q27  Argument in Q27
+*
+* Return:
+*  int32_t        tanh in Q31, saturated to +/-INT32_MAX
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static int32_t act_tanh_q31(int32_t x_q27)
+{
+    CY_CORDIC_Q31_t angle = 0;
+    uint32_t        k     = act_reduce(x_q27, &angle);
+    int64_t         s     = 0;
+    int64_t         c     = 0;
+    int64_t         next  = 0;
+    int64_t         t     = 0;
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_SINH, 1U, angle, 0, 0);
+    s = Cy_CORDIC_Sinh(MXCORDIC, angle);
+    CORDIC_TRACE(CORDIC_TRACE_OP_COSH, 1U, angle, 0, 0);
+    c = Cy_CORDIC_Cosh(MXCORDIC, angle);
+
+    for (; k > 0U; k--)
+    {
+        next = (s * c) >> 29;
+        c    = ((c * c) + (s * s)) >> 30;
+        s    = next;
+
+        while (c > INT32_MAX)
+        {
+            s >>= 1;
+            c >>= 1;
+        }
+    }
+
+    t = (s * ((int64_t)1 << 31)) / c;
+
+    return (t > INT32_MAX) ? INT32_MAX : ((t < -INT32_MAX) ? -INT32_MAX : (int32_t)t);
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_act_q7
+********************************************************************************
+* Summary:
+* tanh or sigmoid of a q7 tensor in place. The arguments have int_width
+* integer bits; the results are Q0.7.
+*
+* Parameters:
+*  q7_t *data                Tensor, in and out
+*  uint32_t size             Number of elements
+*  uint32_t int_width        Integer bits of the arguments, 0 to CORDIC_ACT_INT_WIDTH_MAX
+*  cordic_act_type_t type    CORDIC_ACT_TANH or CORDIC_ACT_SIGMOID
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL tensor or an unsupported int_width
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_act_q7(q7_t *data, uint32_t size, uint32_t int_width,
+                                    cordic_act_type_t type)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t              shift  = (CORDIC_ACT_SIGMOID == type) ? 1U : 0U;   /* sigmoid uses tanh(x / 2) */
+    int32_t               x      = 0;
+    int32_t               t      = 0;
+    uint32_t              i      = 0;
+
+    if ((NULL != data) && (int_width <= CORDIC_ACT_INT_WIDTH_MAX))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (i = 0U; i < size; i++)
+        {
+            x = ((int32_t)data[i] * (1L << (20U + int_width))) >> shift;
+
+            if (x >= ACT_SAT_Q7)
+            {
+                t = ACT_Q11_ONE;
+            }
+            else if (x <= -ACT_SAT_Q7)
+            {
+                t = -ACT_Q11_ONE;
+            }
+            else
+            {
+                t = act_tanh_q11(x);
+            }
+
+            /* tanh: Q11 to Q0.7; sigmoid: (1 + t) in Q12 to Q0.7 */
+            t = (CORDIC_ACT_SIGMOID == type) ? ((t + ACT_Q11_ONE + 16L) >> 5) : ((t + 8L) >> 4);
+            data[i] = (q7_t)((t > INT8_MAX) ? INT8_MAX : ((t < INT8_MIN) ? INT8_MIN : t));
+        }
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_act_q15
+********************************************************************************
+* Summary:
+* tanh or sigmoid of a q15 tensor in place. The arguments have int_width
+* integer bits; the results are Q0.15.
+*
+* Parameters:
+*  q15_t *data               Tensor, in and out
+*  uint32_t size             Number of elements
+*  uint32_t int_width        Integer bits of the arguments, 0 to CORDIC_ACT_INT_WIDTH_MAX
+*  cordic_act_type_t type    CORDIC_ACT_TANH or CORDIC_ACT_SIGMOID
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL tensor or an unsupported int_width
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_act_q15(q15_t *data, uint32_t size, uint32_t int_width,
+                                     cordic_act_type_t type)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t              shift  = (CORDIC_ACT_SIGMOID == type) ? 1U : 0U;   /* sigmoid uses tanh(x / 2) */
+    int32_t               x      = 0;
+    int64_t               t      = 0;
+    uint32_t              i      = 0;
+
+    if ((NULL != data) && (int_width <= CORDIC_ACT_INT_WIDTH_MAX))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (i = 0U; i < size; i++)
+        {
+            x = ((int32_t)data[i] * (1L << (12U + int_width))) >> shift;
+
+            if (x >= ACT_SAT_Q15)
+            {
+                t = INT32_MAX;
+            }
+            else if (x <= -ACT_SAT_Q15)
+            {
+                t = -INT32_MAX;
+            }
+            else
+            {
+                t = act_tanh_q31(x);
+            }
+
+            /* tanh: Q31 to Q0.15; sigmoid: (1 + t) in Q31 to Q0.15 */
+            t = (CORDIC_ACT_SIGMOID == type) ? ((t + (1LL << 31) + (1LL << 16)) >> 17) : ((t + (1LL << 15)) >> 16);
+            data[i] = (q15_t)((t > INT16_MAX) ? INT16_MAX : ((t < INT16_MIN) ? INT16_MIN : t));
+        }
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_act_q31
+********************************************************************************
+* Summary:
+* tanh or sigmoid of a q31 tensor in place. The arguments have int_width
+* integer bits; the results are Q0.31.
+*
+* Parameters:
+*  q31_t *data               Tensor, in and out
+*  uint32_t size             Number of elements
+*  uint32_t int_width        Integer bits of the arguments, 0 to CORDIC_ACT_INT_WIDTH_MAX_Q31
+*  cordic_act_type_t type    CORDIC_ACT_TANH or CORDIC_ACT_SIGMOID
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL tensor or an unsupported int_width
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_act_q31(q31_t *data, uint32_t size, uint32_t int_width,
+                                     cordic_act_type_t type)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t              shift  = (CORDIC_ACT_SIGMOID == type) ? 1U : 0U;   /* sigmoid uses tanh(x / 2) */
+    int32_t               x      = 0;
+    int32_t               t      = 0;
+    uint32_t              i      = 0;
+
+    if ((NULL != data) && (int_width <= CORDIC_ACT_INT_WIDTH_MAX_Q31))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (i = 0U; i < size; i++)
+        {
+            x = data[i] >> ((CORDIC_ACT_INT_WIDTH_MAX_Q31 - int_width) + shift);
+
+            if (x >= ACT_SAT_Q31)
+            {
+                t = INT32_MAX;
+            }
+            else if (x <= -ACT_SAT_Q31)
+            {
+                t = -INT32_MAX;
+            }
+            else
+            {
+                t = act_tanh_q31(x);
+            }
+
+            /* sigmoid: (1 + t) / 2, at most INT32_MAX for t = INT32_MAX */
+            data[i] = (CORDIC_ACT_SIGMOID == type) ? ((t >> 1) + (1L << 30)) : t;
+        }
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: act_lut_q7
+********************************************************************************
+* Summary:
+* Baseline in the style of the CMSIS-NN q7 direct activation: one table
+* lookup per element, arguments with 3 integer bits.
+*
+* Parameters:
+*  q7_t *data          Tensor, in and out
+*  uint32_t size       Number of elements
+*  const q7_t *table   Table indexed by the argument as an unsigned byte
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void act_lut_q7(q7_t *data, uint32_t size, const q7_t *table)
+{
+    uint32_t i = 0;
+
+    for (i = 0U; i < size; i++)
+    {
+        data[i] = table[(uint8_t)data[i]];
+    }
+}
+
+/*******************************************************************************
+* Function Name: act_lut_q15
+********************************************************************************
+* Summary:
+* Baseline in the style of the CMSIS-NN q15 direct activation: the top 8 bits
+* of the argument select a table entry, the low 8 bits interpolate linearly
+* towards the next entry.
+*
+* Parameters:
+*  q15_t *data          Tensor, in and out
+*  uint32_t size        Number of elements
+*  const q15_t *table   Table of 256 entries, entry 0 for the lowest argument
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void act_lut_q15(q15_t *data, uint32_t size, const q15_t *table)
+{
+    int32_t  index = 0;
+    int32_t  frac  = 0;
+    int32_t  a     = 0;
+    int32_t  b     = 0;
+    uint32_t i     = 0;
+
+    for (i = 0U; i < size; i++)
+    {
+        index   = ((int32_t)data[i] >> 8) + 128;
+        frac    = (int32_t)data[i] & 0xFF;
+        a       = table[index];
+        b       = (index < (int32_t)(ACT_LUT_SIZE - 1U)) ? table[index + 1] : a;
+        data[i] = (q15_t)(a + (((b - a) * frac) >> 8));
+    }
+}
+
+/*******************************************************************************
+* Function Name: act_float_q31
+********************************************************************************
+* Summary:
+* Baseline for q31 tensors: conversion to float and tanhf(), arguments with 4
+* integer bits.
+*
+* Parameters:
+*  q31_t *data               Tensor, in and out
+*  uint32_t size             Number of elements
+*  cordic_act_type_t type    CORDIC_ACT_TANH or CORDIC_ACT_SIGMOID
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void act_float_q31(q31_t *data, uint32_t size, cordic_act_type_t type)
+{
+    float32_t y = 0.0f;
+    uint32_t  i = 0;
+
+    for (i = 0U; i < size; i++)
+    {
+        y = (float32_t)data[i] * (1.0f / 134217728.0f);
+        y = (CORDIC_ACT_SIGMOID == type) ? (0.5f + (0.5f * tanhf(0.5f * y))) : tanhf(y);
+        data[i] = (q31_t)fminf(y * 2147483648.0f, 2147483520.0f);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_act_benchmark
+********************************************************************************
+* Summary:
+* Runs tanh and sigmoid over a layer of ACT_BENCH_SIZE elements in the q7,
+* q15 and q31 formats with the CORDIC kernels and with the baselines, lookup
+* tables in the CMSIS-NN style for q7 and q15 and tanhf() for q31, and prints
+* the cycles per layer and the maximum error of both against the double-precision
+* tanh().
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_act_benchmark(void)
+{
+    static const char *format_names[3] = {"q7 ", "q15", "q31"};
+    static const char *type_names[2]   = {"tanh   ", "sigmoid"};
+    uint32_t  seed   = 0x1B873593UL;
+    uint32_t  start  = 0;
+    uint32_t  cycles[2];
+    double    error[2];
+    float32_t x      = 0.0f;
+    double    arg    = 0.0;
+    double    exact  = 0.0;
+    double    value  = 0.0;
+    uint32_t  row    = 0;
+    uint32_t  format = 0;
+    uint32_t  type   = 0;
+    uint32_t  impl   = 0;
+    uint32_t  i      = 0;
+
+    /* Baseline tables, arguments in Q3.4 for q7 and in steps of 1/16 for q15 */
+    for (i = 0U; i < ACT_LUT_SIZE; i++)
+    {
+        x = (float32_t)(int8_t)(uint8_t)i / 16.0f;
+        act_lut_q7_table[0][i] = (q7_t)fminf(roundf(tanhf(x) * 128.0f), 127.0f);
+        act_lut_q7_table[1][i] = (q7_t)fminf(roundf((0.5f + (0.5f * tanhf(0.5f * x))) * 128.0f), 127.0f);
+        x = ((float32_t)i - 128.0f) / 16.0f;
+        act_lut_q15_table[0][i] = (q15_t)fminf(roundf(tanhf(x) * 32768.0f), 32767.0f);
+        act_lut_q15_table[1][i] = (q15_t)fminf(roundf((0.5f + (0.5f * tanhf(0.5f * x))) * 32768.0f), 32767.0f);
+    }
+
+    /* Arguments uniform over +/-8 */
+    for (i = 0U; i < ACT_BENCH_SIZE; i++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        act_bench_input[i] = (float32_t)(int32_t)seed * (8.0f / 2147483648.0f);
+    }
+
+    printf("\r\nLayer of %u elements, arguments in +/-8\r\n", (unsigned int)ACT_BENCH_SIZE);
+    printf("format | function | CORDIC cycles | baseline cycles | CORDIC max error | baseline max error\r\n");
+
+    for (row = 0U; row < ACT_BENCH_ROWS; row++)
+    {
+        format = row >> 1;
+        type   = row & 1U;
+
+        for (impl = 0U; impl < 2U; impl++)
+        {
+            for (i = 0U; i < ACT_BENCH_SIZE; i++)
+            {
+                act_bench_q7[i]  = (q7_t)(act_bench_input[i] * 16.0f);
+                act_bench_q15[i] = (q15_t)(act_bench_input[i] * 4096.0f);
+                act_bench_q31[i] = (q31_t)(act_bench_input[i] * 134217728.0f);
+            }
+
+            start = cordic_benchmark_get_cycles();
+            if (0U == format)
+            {
+                if (0U == impl)
+                {
+                    (void)cordic_act_q7(act_bench_q7, ACT_BENCH_SIZE, ACT_BENCH_INT_WIDTH, (cordic_act_type_t)type);
+                }
+                else
+                {
+                    act_lut_q7(act_bench_q7, ACT_BENCH_SIZE, act_lut_q7_table[type]);
+                }
+            }
+            else if (1U == format)
+            {
+                if (0U == impl)
+                {
+                    (void)cordic_act_q15(act_bench_q15, ACT_BENCH_SIZE, ACT_BENCH_INT_WIDTH, (cordic_act_type_t)type);
+                }
+                else
+                {
+                    act_lut_q15(act_bench_q15, ACT_BENCH_SIZE, act_lut_q15_table[type]);
+                }
+            }
+            else
+            {
+                if (0U == impl)
+                {
+                    (void)cordic_act_q31(act_bench_q31, ACT_BENCH_SIZE, CORDIC_ACT_INT_WIDTH_MAX_Q31, (cordic_act_type_t)type);
+                }
+                else
+                {
+                    act_float_q31(act_bench_q31, ACT_BENCH_SIZE, (cordic_act_type_t)type);
+                }
+            }
+            cycles[impl] = cordic_benchmark_get_cycles() - start;
+
+            /* Error of both against the double-precision tanh() for the
+             * quantized arguments; tanhf() is itself the q31 baseline */
+            error[impl] = 0.0;
+            for (i = 0U; i < ACT_BENCH_SIZE; i++)
+            {
+                arg   = (0U == format) ? ((double)(q7_t)(act_bench_input[i] * 16.0f) / 16.0) :
+                        ((1U == format) ? ((double)(q15_t)(act_bench_input[i] * 4096.0f) / 4096.0) :
+                                          ((double)(q31_t)(act_bench_input[i] * 134217728.0f) / 134217728.0));
+                exact = (0U == type) ? tanh(arg) : (0.5 + (0.5 * tanh(0.5 * arg)));
+                value = (0U == format) ? ((double)act_bench_q7[i] / 128.0) :
+                        ((1U == format) ? ((double)act_bench_q15[i] / 32768.0) :
+                                          ((double)act_bench_q31[i] / 2147483648.0));
+                error[impl] = fmax(error[impl], fabs(value - exact));
+            }
+        }
+
+        printf("%s    | %s  | %13u | %15u | %16.2e | %.2e\r\n", format_names[format], type_names[type],
+               (unsigned int)cycles[0], (unsigned int)cycles[1], error[0], error[1]);
+    }
+    printf("Baselines: lookup table for q7, lookup table with interpolation for q15, tanhf() for q31.\r\n");
+    printf("Errors against the double-precision tanh().\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,80 @@
+/*******************************************************************************
+* File Name:   cordic_activation.h
+*
+* Description: This header file contains the interface to the tanh and
+* sigmoid activation kernels for neural-network inference. The kernels work in
+* place on q7, q15 and q31 tensors, with the argument format given by the number
+* of integer bits as in the CMSIS-NN direct activation functions.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_ACTIVATION_H
+#define CORDIC_ACTIVATION_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "arm_math.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Highest number of integer bits of the arguments: q7 and q15 tensors cover
+ * +/-8, q31 tensors +/-16 */
+#define CORDIC_ACT_INT_WIDTH_MAX      (3U)
+#define CORDIC_ACT_INT_WIDTH_MAX_Q31  (4U)
+
+/* Activation function */
+typedef enum
+{
+    CORDIC_ACT_TANH    = 0,   /* Output in [-1, 1) in the tensor format, Q0.7, Q0.15 or Q0.31 */
+    CORDIC_ACT_SIGMOID = 1    /* Output in [0, 1) in the tensor format, 1 / (1 + exp(-x)) */
+} cordic_act_type_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_en_cordic_status_t cordic_act_q7(q7_t *data, uint32_t size, uint32_t int_width,
+                                    cordic_act_type_t type);
+cy_en_cordic_status_t cordic_act_q15(q15_t *data, uint32_t size, uint32_t int_width,
+                                     cordic_act_type_t type);
+cy_en_cordic_status_t cordic_act_q31(q31_t *data, uint32_t size, uint32_t int_width,
+                                     cordic_act_type_t type);
+void cordic_act_benchmark(void);
+
+#endif /*CORDIC_ACTIVATION_H*/
+/* [] END OF FILE */
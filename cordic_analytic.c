@@ -0,0 +1,295 @@
+/*******************************************************************************
+* File Name:   cordic_analytic.c
+*
+* Description: This file contains the streaming analytic-signal block. The
+* phase of each I/Q sample comes from the vectoring mode of the CORDIC
+* (Cy_CORDIC_ArcTan), the envelope from a Park rotation of the sample by that
+* phase, and the frequency from the difference of consecutive phases.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_benchmark.h"
+#include "cordic_analytic.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of samples of the benchmark buffer */
+#define ANALYTIC_BENCH_COUNT     (64U)
+
+/* Conversions of the benchmark */
+#define ANALYTIC_Q31_TO_FLOAT    (1.0f / 2147483648.0f)
+#define ANALYTIC_FLOAT_TO_Q31    (2147483648.0f)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void analytic_float(const float32_t *i_in, const float32_t *q_in,
+                           float32_t *envelope, float32_t *phase,
+                           float32_t *frequency, uint32_t count);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark buffers */
+static CY_CORDIC_Q31_t analytic_bench_i[ANALYTIC_BENCH_COUNT];
+static CY_CORDIC_Q31_t analytic_bench_q[ANALYTIC_BENCH_COUNT];
+static CY_CORDIC_Q31_t analytic_bench_envelope[ANALYTIC_BENCH_COUNT];
+static int64_t         analytic_bench_phase[ANALYTIC_BENCH_COUNT];
+static CY_CORDIC_Q31_t analytic_bench_frequency[ANALYTIC_BENCH_COUNT];
+static float32_t       analytic_float_i[ANALYTIC_BENCH_COUNT];
+static float32_t       analytic_float_q[ANALYTIC_BENCH_COUNT];
+static float32_t       analytic_float_envelope[ANALYTIC_BENCH_COUNT];
+static float32_t       analytic_float_phase[ANALYTIC_BENCH_COUNT];
+static float32_t       analytic_float_frequency[ANALYTIC_BENCH_COUNT];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_analytic_init
+********************************************************************************
+* Summary:
+* Resets the state of an I/Q stream. The first processed sample starts the
+* unwrapped phase at its own phase and reports a frequency of zero.
+*
+* Parameters:
+*  cordic_analytic_state_t *state  Stream state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_analytic_init(cordic_analytic_state_t *state)
+{
+    cordic_angle_unwrap_init(&state->unwrap);
+}
+
+/*******************************************************************************
+* Function Name: cordic_analytic_process
+********************************************************************************
+* Summary:
+* Processes a buffer of I/Q samples. cordic_angle_polar_start() gives the
+* phase of each sample and starts the rotation for its magnitude; the phase
+* unwrapping and the frequency run while the peripheral computes the rotation.
+* A sample whose components both vanish in the vectoring operands, below
+* 4 LSB, holds the phase of the previous sample and reports a zero envelope.
+*
+* Parameters:
+*  cordic_analytic_state_t *state  Stream state
+*  const CY_CORDIC_Q31_t *i_in     In-phase samples in Q31
+*  const CY_CORDIC_Q31_t *q_in     Quadrature samples in Q31
+*  CY_CORDIC_Q31_t *envelope       Envelope |z| in Q31
+*  int64_t *phase                  Unwrapped phase, 2^31 = pi
+*  CY_CORDIC_Q31_t *frequency      Phase step per sample in Q31, 1.0 = Nyquist frequency
+*  uint32_t count                  Number of samples
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_analytic_process(cordic_analytic_state_t *state,
+                                              const CY_CORDIC_Q31_t *i_in,
+                                              const CY_CORDIC_Q31_t *q_in,
+                                              CY_CORDIC_Q31_t *envelope,
+                                              int64_t *phase,
+                                              CY_CORDIC_Q31_t *frequency,
+                                              uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t wrapped = 0;
+    int32_t  delta   = 0;
+    bool     valid   = false;
+    uint32_t i       = 0;
+
+    if ((NULL != state) && (NULL != i_in) && (NULL != q_in) &&
+        (NULL != envelope) && (NULL != phase) && (NULL != frequency))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (i = 0U; i < count; i++)
+        {
+            /* A sample below the vectoring resolution holds the phase */
+            wrapped = state->unwrap.last;
+            valid   = cordic_angle_polar_start(i_in[i], q_in[i], &wrapped);
+
+            /* Unwrapping and frequency while the peripheral is busy */
+            delta        = state->unwrap.started ? cordic_angle_diff(wrapped, state->unwrap.last) : 0;
+            phase[i]     = cordic_angle_unwrap(&state->unwrap, wrapped);
+            frequency[i] = delta;
+            envelope[i]  = valid ? cordic_angle_polar_result() : 0;
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: analytic_float
+********************************************************************************
+* Summary:
+* Floating-point reference with atan2f() and sqrtf(). The phase is unwrapped
+* by adding or removing 2 * pi from the phase step.
+*
+* Parameters:
+*  const float32_t *i_in   In-phase samples
+*  const float32_t *q_in   Quadrature samples
+*  float32_t *envelope     Envelope
+*  float32_t *phase        Unwrapped phase in radians
+*  float32_t *frequency    Phase step per sample, 1.0 = Nyquist frequency
+*  uint32_t count          Number of samples
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void analytic_float(const float32_t *i_in, const float32_t *q_in,
+                           float32_t *envelope, float32_t *phase,
+                           float32_t *frequency, uint32_t count)
+{
+    float32_t last  = 0.0f;
+    float32_t delta = 0.0f;
+    float32_t angle = 0.0f;
+    float32_t total = 0.0f;
+    uint32_t  i     = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        envelope[i] = sqrtf((i_in[i] * i_in[i]) + (q_in[i] * q_in[i]));
+        angle       = atan2f(q_in[i], i_in[i]);
+        delta       = (0U == i) ? 0.0f : (angle - last);
+
+        if (delta > PI)
+        {
+            delta -= 2.0f * PI;
+        }
+        else if (delta < -PI)
+        {
+            delta += 2.0f * PI;
+        }
+
+        total        = (0U == i) ? angle : (total + delta);
+        last         = angle;
+        phase[i]     = total;
+        frequency[i] = delta / PI;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_analytic_benchmark
+********************************************************************************
+* Summary:
+* Processes an amplitude and frequency modulated I/Q buffer with the CORDIC
+* block and with the atan2f() + sqrtf() reference, and prints the samples per
+* second of both and the maximum deviation of the CORDIC results.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_analytic_benchmark(void)
+{
+    cordic_analytic_state_t state;
+    float32_t carrier   = 0.0f;
+    float32_t amplitude = 0.0f;
+    float32_t error_env = 0.0f;
+    float32_t error_ph  = 0.0f;
+    float32_t error_fr  = 0.0f;
+    float32_t error     = 0.0f;
+    uint32_t  start     = 0;
+    uint32_t  cordic    = 0;
+    uint32_t  library   = 0;
+    uint32_t  i         = 0;
+
+    /* Envelope between 0.2 and 0.8, frequency sweeping from 0.05 to 0.9 of Nyquist */
+    for (i = 0U; i < ANALYTIC_BENCH_COUNT; i++)
+    {
+        amplitude = 0.5f + (0.3f * cosf((2.0f * PI * (float32_t)i) / (float32_t)ANALYTIC_BENCH_COUNT));
+        carrier  += PI * (0.05f + ((0.85f * (float32_t)i) / (float32_t)ANALYTIC_BENCH_COUNT));
+        analytic_bench_i[i] = (CY_CORDIC_Q31_t)(amplitude * cosf(carrier) * ANALYTIC_FLOAT_TO_Q31);
+        analytic_bench_q[i] = (CY_CORDIC_Q31_t)(amplitude * sinf(carrier) * ANALYTIC_FLOAT_TO_Q31);
+    }
+
+    cordic_analytic_init(&state);
+    start   = cordic_benchmark_get_cycles();
+    (void)cordic_analytic_process(&state, analytic_bench_i, analytic_bench_q, analytic_bench_envelope,
+                                  analytic_bench_phase, analytic_bench_frequency, ANALYTIC_BENCH_COUNT);
+    cordic  = cordic_benchmark_get_cycles() - start;
+
+    /* The float pipeline starts from the same Q31 samples */
+    start   = cordic_benchmark_get_cycles();
+    for (i = 0U; i < ANALYTIC_BENCH_COUNT; i++)
+    {
+        analytic_float_i[i] = (float32_t)analytic_bench_i[i] * ANALYTIC_Q31_TO_FLOAT;
+        analytic_float_q[i] = (float32_t)analytic_bench_q[i] * ANALYTIC_Q31_TO_FLOAT;
+    }
+    analytic_float(analytic_float_i, analytic_float_q, analytic_float_envelope,
+                   analytic_float_phase, analytic_float_frequency, ANALYTIC_BENCH_COUNT);
+    library = cordic_benchmark_get_cycles() - start;
+
+    for (i = 0U; i < ANALYTIC_BENCH_COUNT; i++)
+    {
+        error     = fabsf(((float32_t)analytic_bench_envelope[i] * ANALYTIC_Q31_TO_FLOAT) - analytic_float_envelope[i]);
+        error_env = (error > error_env) ? error : error_env;
+        error     = fabsf((((float32_t)analytic_bench_phase[i] * ANALYTIC_Q31_TO_FLOAT) * PI) - analytic_float_phase[i]);
+        error_ph  = (error > error_ph) ? error : error_ph;
+        error     = fabsf(((float32_t)analytic_bench_frequency[i] * ANALYTIC_Q31_TO_FLOAT) - analytic_float_frequency[i]);
+        error_fr  = (error > error_fr) ? error : error_fr;
+    }
+
+    cordic  = (0U != cordic) ? cordic : 1U;
+    library = (0U != library) ? library : 1U;
+
+    printf("\r\n%u samples           | cycles/sample | samples/s\r\n", (unsigned int)ANALYTIC_BENCH_COUNT);
+    printf("CORDIC vectoring     | %13u | %u\r\n", (unsigned int)(cordic / ANALYTIC_BENCH_COUNT),
+           (unsigned int)(((uint64_t)SystemCoreClock * ANALYTIC_BENCH_COUNT) / cordic));
+    printf("atan2f + sqrtf       | %13u | %u\r\n", (unsigned int)(library / ANALYTIC_BENCH_COUNT),
+           (unsigned int)(((uint64_t)SystemCoreClock * ANALYTIC_BENCH_COUNT) / library));
+    printf("Maximum deviation: envelope %.2e, phase %.2e rad, frequency %.2e of Nyquist\r\n",
+           (double)error_env, (double)error_ph, (double)error_fr);
+}
+
+/* [] END OF FILE */
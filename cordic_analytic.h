@@ -0,0 +1,78 @@
+/*******************************************************************************
+* File Name:   cordic_analytic.h
+*
+* Description: This header file contains the interface to the streaming
+* analytic-signal block. It turns buffers of I/Q samples into the envelope, the
+* unwrapped instantaneous phase and the instantaneous frequency in fixed point.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_ANALYTIC_H
+#define CORDIC_ANALYTIC_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "cordic_angle.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* State of one I/Q stream, carried from one buffer to the next */
+typedef struct
+{
+    cordic_angle_unwrap_t unwrap;    /* Unwrapped phase, 2^31 = pi */
+} cordic_analytic_state_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* The I/Q samples are Q31 with a magnitude of at most 1. The envelope is Q31,
+ * the unwrapped phase is counted in units of pi / 2^31, and the frequency is
+ * the phase step per sample in Q31 fractions of the Nyquist frequency. */
+void cordic_analytic_init(cordic_analytic_state_t *state);
+cy_en_cordic_status_t cordic_analytic_process(cordic_analytic_state_t *state,
+                                              const CY_CORDIC_Q31_t *i_in,
+                                              const CY_CORDIC_Q31_t *q_in,
+                                              CY_CORDIC_Q31_t *envelope,
+                                              int64_t *phase,
+                                              CY_CORDIC_Q31_t *frequency,
+                                              uint32_t count);
+void cordic_analytic_benchmark(void);
+
+#endif /*CORDIC_ANALYTIC_H*/
+/* [] END OF FILE */
@@ -0,0 +1,530 @@
+/*******************************************************************************
+* File Name:   cordic_angle.c
+*
+* Description: This file contains the fixed-point angle library.
+* The arithmetic on binary angles wraps by itself as 32-bit integer arithmetic.
+* The angle of a vector extends the right-half-plane vectoring operation to the
+* full circle, and the unwrapper accumulates the shortest rotations between
+* successive angles in 64 bits.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_gain.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Shift from Q31 vector components to 8Q23 vectoring operands */
+#define ANGLE_VECTOR_SHIFT      (2U)
+
+/* Benchmark: block of angles, number of blocks, and conversions */
+#define ANGLE_BENCH_BLOCK       (1024U)
+#define ANGLE_BENCH_BLOCKS      (64U)
+#define ANGLE_TO_RAD            (PI / 2147483648.0f)
+#define ANGLE_RAD_TO_DEG        (180.0 / 3.14159265358979)
+#define ANGLE_UNIT_TO_DEG       (180.0 / 2147483648.0)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static CY_CORDIC_Q31_t angle_half_plane(CY_CORDIC_8Q23_t x, CY_CORDIC_8Q23_t y, uint32_t *angle);
+static float32_t angle_float_unwrap(const float32_t *angle, uint32_t count, float32_t *last,
+                                    float32_t position);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark angles, vectors, and results */
+static uint32_t        angle_bench_angle[ANGLE_BENCH_BLOCK];
+static uint32_t        angle_bench_last[ANGLE_BENCH_BLOCK];
+static float32_t       angle_bench_float[ANGLE_BENCH_BLOCK];
+static CY_CORDIC_Q31_t angle_bench_x[ANGLE_BENCH_BLOCK];
+static CY_CORDIC_Q31_t angle_bench_y[ANGLE_BENCH_BLOCK];
+static int64_t         angle_bench_position[ANGLE_BENCH_BLOCK];
+static int32_t         angle_bench_diff[ANGLE_BENCH_BLOCK];
+static uint32_t        angle_bench_vector[ANGLE_BENCH_BLOCK];
+static float32_t       angle_bench_float_out[ANGLE_BENCH_BLOCK];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_angle_unwrap_init
+********************************************************************************
+* Summary:
+* Resets an unwrapper. The next angle starts the position.
+*
+* Parameters:
+*  cordic_angle_unwrap_t *unwrap  Unwrapper state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_angle_unwrap_init(cordic_angle_unwrap_t *unwrap)
+{
+    unwrap->position = 0;
+    unwrap->last     = 0U;
+    unwrap->started  = false;
+}
+
+/*******************************************************************************
+* Function Name: angle_half_plane
+********************************************************************************
+* Summary:
+* Angle of a vector in the right half plane of the vectoring operation.
+* Vectors in the left half plane are negated, so the angle returned is the
+* angle of the vector folded by pi, within +/-90 degrees.
+*
+* Parameters:
+*  CY_CORDIC_8Q23_t x  x component in 8Q23, not both zero
+*  CY_CORDIC_8Q23_t y  y component in 8Q23
+*  uint32_t *angle     Receives the Q31 binary angle of the unfolded vector
+*
+* Return:
+*  CY_CORDIC_Q31_t     Angle of the folded vector, Q31 binary angle
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static CY_CORDIC_Q31_t angle_half_plane(CY_CORDIC_8Q23_t x, CY_CORDIC_8Q23_t y, uint32_t *angle)
+{
+    CY_CORDIC_Q31_t half = 0;
+
+    *angle = (x < 0) ? CORDIC_ANGLE_PI : 0U;
+    if (x < 0)
+    {
+        x = -x;
+        y = -y;
+    }
+    CORDIC_TRACE(CORDIC_TRACE_OP_ARCTAN, 2U, x, y, 0);
+    half    = Cy_CORDIC_ArcTan(MXCORDIC, x, y);
+    *angle += (uint32_t)half;
+
+    return half;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_angle_vector
+********************************************************************************
+* Summary:
+* Angle of a vector over the full circle. The vectoring operation covers the
+* right half plane; vectors in the left half plane are negated first and pi is
+* added to their angle.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t x  x component in Q31
+*  CY_CORDIC_Q31_t y  y component in Q31
+*  uint32_t hold      Angle returned for a vector below the vectoring resolution
+*
+* Return:
+*  uint32_t           Q31 binary angle
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+uint32_t cordic_angle_vector(CY_CORDIC_Q31_t x, CY_CORDIC_Q31_t y, uint32_t hold)
+{
+    CY_CORDIC_8Q23_t vx    = x >> ANGLE_VECTOR_SHIFT;
+    CY_CORDIC_8Q23_t vy    = y >> ANGLE_VECTOR_SHIFT;
+    uint32_t         angle = hold;
+
+    if ((0 != vx) || (0 != vy))
+    {
+        (void)angle_half_plane(vx, vy, &angle);
+    }
+
+    return angle;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_angle_polar_start
+********************************************************************************
+* Summary:
+* Starts the conversion of a vector to angle and magnitude. The Park transform
+* cannot rotate by more than +/-90 degrees, so the vector is rotated by the
+* angle of the vector folded by pi instead of by its own angle. That leaves
+* |v| in the d component, or -|v| for the folded vectors, and the sign is
+* dropped by cordic_angle_polar_result(). The caller can work while the
+* peripheral rotates.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t x  x component in Q31
+*  CY_CORDIC_Q31_t y  y component in Q31
+*  uint32_t *angle    Angle to hold for a vector below the vectoring
+*                     resolution; receives the Q31 binary angle
+*
+* Return:
+*  bool               true when the rotation was started and
+*                     cordic_angle_polar_result() must be called
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+bool cordic_angle_polar_start(CY_CORDIC_Q31_t x, CY_CORDIC_Q31_t y, uint32_t *angle)
+{
+    CY_CORDIC_8Q23_t vx      = x >> ANGLE_VECTOR_SHIFT;
+    CY_CORDIC_8Q23_t vy      = y >> ANGLE_VECTOR_SHIFT;
+    CY_CORDIC_Q31_t  half    = 0;
+    bool             started = (0 != vx) || (0 != vy);
+
+    if (started)
+    {
+        half = angle_half_plane(vx, vy, angle);
+        CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, half, x, y);
+        Cy_CORDIC_ParkTransformNB(MXCORDIC, half, x, y);
+    }
+
+    return started;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_angle_polar_result
+********************************************************************************
+* Summary:
+* Waits for the rotation of cordic_angle_polar_start() and returns the
+* magnitude with the CORDIC gain removed.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  CY_CORDIC_Q31_t  Magnitude in Q31, saturated
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+CY_CORDIC_Q31_t cordic_angle_polar_result(void)
+{
+    cy_stc_cordic_parkTransform_result_t park;
+
+    while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+    Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+
+    return cordic_gain_remove(park.parkTransformId, park.parkTransformId >> 31);
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_angle_vector_batch
+********************************************************************************
+* Summary:
+* Angles of a buffer of vectors. A vector below the vectoring resolution holds
+* the angle of the previous one.
+*
+* Parameters:
+*  const CY_CORDIC_Q31_t *x  x components in Q31
+*  const CY_CORDIC_Q31_t *y  y components in Q31
+*  uint32_t *angle           Q31 binary angles
+*  uint32_t hold             Angle held before the first vector
+*  uint32_t count            Number of vectors
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_angle_vector_batch(const CY_CORDIC_Q31_t *x, const CY_CORDIC_Q31_t *y,
+                                                uint32_t *angle, uint32_t hold, uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t i = 0;
+
+    if ((NULL != x) && (NULL != y) && (NULL != angle))
+    {
+        for (i = 0U; i < count; i++)
+        {
+            hold     = cordic_angle_vector(x[i], y[i], hold);
+            angle[i] = hold;
+        }
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_angle_diff_batch
+********************************************************************************
+* Summary:
+* Shortest signed rotations between two buffers of angles. a and b may be the
+* same buffer offset by one to get the steps of a stream.
+*
+* Parameters:
+*  const uint32_t *a  Q31 binary angles
+*  const uint32_t *b  Q31 binary angles
+*  int32_t *diff      a - b in [-pi, pi), 2^31 = pi
+*  uint32_t count     Number of angles
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_angle_diff_batch(const uint32_t *a, const uint32_t *b,
+                                              int32_t *diff, uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t i = 0;
+
+    if ((NULL != a) && (NULL != b) && (NULL != diff))
+    {
+        for (i = 0U; i < count; i++)
+        {
+            diff[i] = cordic_angle_diff(a[i], b[i]);
+        }
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_angle_unwrap_batch
+********************************************************************************
+* Summary:
+* Adds a buffer of angles to a streaming unwrapper.
+*
+* Parameters:
+*  cordic_angle_unwrap_t *unwrap  Unwrapper state
+*  const uint32_t *angle          Q31 binary angles
+*  int64_t *position              Unwrapped angles, 2^31 = pi
+*  uint32_t count                 Number of angles
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_angle_unwrap_batch(cordic_angle_unwrap_t *unwrap, const uint32_t *angle,
+                                                int64_t *position, uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t i = 0;
+
+    if ((NULL != unwrap) && (NULL != angle) && (NULL != position))
+    {
+        for (i = 0U; i < count; i++)
+        {
+            position[i] = cordic_angle_unwrap(unwrap, angle[i]);
+        }
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: angle_float_unwrap
+********************************************************************************
+* Summary:
+* Floating-point unwrapping with compares, as the consumers of the angles did
+* before the library.
+*
+* Parameters:
+*  const float32_t *angle  Angles in radians
+*  uint32_t count          Number of angles
+*  float32_t *last         Last angle, in and out
+*  float32_t position      Unwrapped angle before the block
+*
+* Return:
+*  float32_t               Unwrapped angle after the block
+*
+*******************************************************************************/
+static CY_CORDIC_Q31_t angle_half_plane(CY_CORDIC_8Q23_t x, CY_CORDIC_8Q23_t y, uint32_t *angle);
+static float32_t angle_float_unwrap(const float32_t *angle, uint32_t count, float32_t *last,
+                                    float32_t position)
+{
+    float32_t delta = 0.0f;
+    uint32_t  i     = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        delta = angle[i] - *last;
+        if (delta > PI)
+        {
+            delta -= 2.0f * PI;
+        }
+        else if (delta < -PI)
+        {
+            delta += 2.0f * PI;
+        }
+        else
+        {
+            /* Within half a turn */
+        }
+        position += delta;
+        angle_bench_float_out[i] = position;
+        *last = angle[i];
+    }
+
+    return position;
+}
+
+/*******************************************************************************
+* Function Name: cordic_angle_benchmark
+********************************************************************************
+* Summary:
+* Unwraps 64 blocks of 1024 angles of a phasor that turns by 0.2 to 0.8 pi per
+* sample, takes the steps between the angles, and the angles of the phasor
+* samples, with the library and with the float code it replaces. Prints the
+* cycles per sample and the error of the float results.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_angle_benchmark(void)
+{
+    cordic_angle_unwrap_t unwrap;
+    int64_t   truth       = 0;
+    uint32_t  phase       = 0;
+    uint32_t  step        = 0;
+    float32_t last        = 0.0f;
+    float32_t position    = 0.0f;
+    float32_t error_diff  = 0.0f;
+    float32_t error_angle = 0.0f;
+    float32_t value       = 0.0f;
+    uint32_t  start       = 0;
+    uint32_t  cycles[6]   = { 0U, 0U, 0U, 0U, 0U, 0U };
+    uint32_t  block       = 0;
+    uint32_t  i           = 0;
+
+    for (i = 0U; i < ANGLE_BENCH_BLOCK; i++)
+    {
+        step   = (uint32_t)(int32_t)lroundf(2147483648.0f * (0.5f + (0.3f * sinf((2.0f * PI * (float32_t)i) /
+                                                                                 (float32_t)ANGLE_BENCH_BLOCK))));
+        phase += step;
+        truth += (0U != i) ? (int64_t)step : 0;
+        angle_bench_angle[i] = phase;
+        angle_bench_last[i]  = phase - step;
+        angle_bench_float[i] = (float32_t)(int32_t)phase * ANGLE_TO_RAD;
+        angle_bench_x[i]     = (CY_CORDIC_Q31_t)lroundf(1.5e9f * cosf(angle_bench_float[i]));
+        angle_bench_y[i]     = (CY_CORDIC_Q31_t)lroundf(1.5e9f * sinf(angle_bench_float[i]));
+    }
+
+    /* Unwrapping: the block ends a whole number of turns from its start */
+    cordic_angle_unwrap_init(&unwrap);
+    last = 0.0f;
+    for (block = 0U; block < ANGLE_BENCH_BLOCKS; block++)
+    {
+        start      = cordic_benchmark_get_cycles();
+        (void)cordic_angle_unwrap_batch(&unwrap, angle_bench_angle, angle_bench_position, ANGLE_BENCH_BLOCK);
+        cycles[0] += cordic_benchmark_get_cycles() - start;
+
+        start      = cordic_benchmark_get_cycles();
+        position   = angle_float_unwrap(angle_bench_float, ANGLE_BENCH_BLOCK, &last, position);
+        cycles[1] += cordic_benchmark_get_cycles() - start;
+    }
+
+    /* Steps between successive angles */
+    start     = cordic_benchmark_get_cycles();
+    (void)cordic_angle_diff_batch(angle_bench_angle, angle_bench_last, angle_bench_diff, ANGLE_BENCH_BLOCK);
+    cycles[2] = cordic_benchmark_get_cycles() - start;
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 1U; i < ANGLE_BENCH_BLOCK; i++)
+    {
+        value = angle_bench_float[i] - angle_bench_float[i - 1U];
+        value = (value > PI) ? (value - (2.0f * PI)) : ((value < -PI) ? (value + (2.0f * PI)) : value);
+        angle_bench_float_out[i] = value;
+    }
+    cycles[3] = cordic_benchmark_get_cycles() - start;
+
+    for (i = 1U; i < ANGLE_BENCH_BLOCK; i++)
+    {
+        error_diff = fmaxf(error_diff, fabsf(angle_bench_float_out[i] -
+                                             ((float32_t)angle_bench_diff[i] * ANGLE_TO_RAD)));
+    }
+
+    /* Angles of the phasor samples */
+    start     = cordic_benchmark_get_cycles();
+    (void)cordic_angle_vector_batch(angle_bench_x, angle_bench_y, angle_bench_vector, 0U, ANGLE_BENCH_BLOCK);
+    cycles[4] = cordic_benchmark_get_cycles() - start;
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < ANGLE_BENCH_BLOCK; i++)
+    {
+        angle_bench_float_out[i] = atan2f((float32_t)angle_bench_y[i], (float32_t)angle_bench_x[i]);
+    }
+    cycles[5] = cordic_benchmark_get_cycles() - start;
+
+    for (i = 0U; i < ANGLE_BENCH_BLOCK; i++)
+    {
+        error_angle = fmaxf(error_angle, fabsf((float32_t)cordic_angle_diff(angle_bench_vector[i],
+                                                                            angle_bench_angle[i])));
+    }
+
+    /* Exact end: the first angle, the steps within the blocks, and the steps
+     * from the end of one block to the start of the next */
+    truth = (int64_t)(int32_t)angle_bench_angle[0] + ((int64_t)ANGLE_BENCH_BLOCKS * truth) +
+            ((int64_t)(ANGLE_BENCH_BLOCKS - 1U) *
+             cordic_angle_diff(angle_bench_angle[0], angle_bench_angle[ANGLE_BENCH_BLOCK - 1U]));
+
+    printf("\r\n%u angles unwrapped, %.0f turns\r\n", (unsigned int)(ANGLE_BENCH_BLOCK * ANGLE_BENCH_BLOCKS),
+           (double)truth / 4294967296.0);
+    printf("Operation            | library cycles/sample | float cycles/sample\r\n");
+    printf("Unwrap               | %21u | %19u\r\n",
+           (unsigned int)(cycles[0] / (ANGLE_BENCH_BLOCK * ANGLE_BENCH_BLOCKS)),
+           (unsigned int)(cycles[1] / (ANGLE_BENCH_BLOCK * ANGLE_BENCH_BLOCKS)));
+    printf("Step                 | %21u | %19u\r\n", (unsigned int)(cycles[2] / ANGLE_BENCH_BLOCK),
+           (unsigned int)(cycles[3] / ANGLE_BENCH_BLOCK));
+    printf("Vector angle (atan2) | %21u | %19u\r\n", (unsigned int)(cycles[4] / ANGLE_BENCH_BLOCK),
+           (unsigned int)(cycles[5] / ANGLE_BENCH_BLOCK));
+    printf("Unwrapped end position error: library %.6f deg, float %.3f deg\r\n",
+           (double)(angle_bench_position[ANGLE_BENCH_BLOCK - 1U] - truth) * ANGLE_UNIT_TO_DEG,
+           ((double)position * ANGLE_RAD_TO_DEG) - ((double)truth * ANGLE_UNIT_TO_DEG));
+    printf("Largest float step error %.2e rad, vector angle error %.2e deg\r\n",
+           (double)error_diff, (double)error_angle * ANGLE_UNIT_TO_DEG);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,196 @@
+/*******************************************************************************
+* File Name:   cordic_angle.h
+*
+* Description: This header file contains the interface to the fixed-point angle
+* library: wrap-safe arithmetic on Q31 binary angles, the full-circle angle of
+* a vector, and a streaming unwrapper that counts turns into a 64-bit position.
+* A Q31 binary angle is the angle format of the CORDIC, 2^31 = pi, used as an
+* unsigned 32-bit value so that all arithmetic wraps at one turn.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_ANGLE_H
+#define CORDIC_ANGLE_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Q31 binary angles of pi / 2 and pi */
+#define CORDIC_ANGLE_PI_2   (0x40000000U)
+#define CORDIC_ANGLE_PI     (0x80000000U)
+
+/* 2^31 / pi: a radian in Qn times this, shifted right by n, is a Q31 binary
+ * angle */
+#define CORDIC_ANGLE_PER_RAD   (683565276LL)
+
+/* Streaming unwrapper. The position counts in units of pi / 2^31, so one turn
+ * is 2^32 and the low 32 bits are the wrapped angle. */
+typedef struct
+{
+    int64_t  position;    /* Unwrapped angle of the last sample */
+    uint32_t last;        /* Wrapped angle of the last sample */
+    bool     started;     /* false until the first sample */
+} cordic_angle_unwrap_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+/*******************************************************************************
+* Function Name: cordic_angle_add
+********************************************************************************
+* Summary:
+* Sum of two angles, modulo one turn.
+*
+* Parameters:
+*  uint32_t a  Q31 binary angle
+*  uint32_t b  Q31 binary angle
+*
+* Return:
+*  uint32_t    a + b, Q31 binary angle
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t cordic_angle_add(uint32_t a, uint32_t b)
+{
+    return a + b;
+}
+
+/*******************************************************************************
+* Function Name: cordic_angle_sub
+********************************************************************************
+* Summary:
+* Difference of two angles, modulo one turn.
+*
+* Parameters:
+*  uint32_t a  Q31 binary angle
+*  uint32_t b  Q31 binary angle
+*
+* Return:
+*  uint32_t    a - b, Q31 binary angle
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t cordic_angle_sub(uint32_t a, uint32_t b)
+{
+    return a - b;
+}
+
+/*******************************************************************************
+* Function Name: cordic_angle_diff
+********************************************************************************
+* Summary:
+* Shortest signed rotation from b to a. The 32-bit difference wraps into
+* [-pi, pi) by itself, so no compare is needed.
+*
+* Parameters:
+*  uint32_t a  Q31 binary angle
+*  uint32_t b  Q31 binary angle
+*
+* Return:
+*  int32_t     a - b in [-pi, pi), 2^31 = pi
+*
+*******************************************************************************/
+__STATIC_INLINE int32_t cordic_angle_diff(uint32_t a, uint32_t b)
+{
+    return (int32_t)(a - b);
+}
+
+/*******************************************************************************
+* Function Name: cordic_angle_fold
+********************************************************************************
+* Summary:
+* Folds an angle into the +/-90 degree range of the peripheral by adding pi.
+*
+* Parameters:
+*  uint32_t *theta  Q31 binary angle, in and out
+*
+* Return:
+*  int32_t          -1 when folded, the results must be negated, 0 otherwise
+*
+*******************************************************************************/
+__STATIC_INLINE int32_t cordic_angle_fold(uint32_t *theta)
+{
+    int32_t negate = -(int32_t)((*theta + CORDIC_ANGLE_PI_2) >= CORDIC_ANGLE_PI);
+
+    *theta += (uint32_t)negate & CORDIC_ANGLE_PI;
+
+    return negate;
+}
+
+/*******************************************************************************
+* Function Name: cordic_angle_unwrap
+********************************************************************************
+* Summary:
+* Adds an angle to a streaming unwrapper. The first angle is taken within half
+* a turn of zero; each further angle adds its shortest rotation from the last,
+* so the angle must change by less than half a turn per sample.
+*
+* Parameters:
+*  cordic_angle_unwrap_t *unwrap  Unwrapper state
+*  uint32_t angle                 Q31 binary angle
+*
+* Return:
+*  int64_t                        Unwrapped angle, 2^31 = pi
+*
+*******************************************************************************/
+__STATIC_INLINE int64_t cordic_angle_unwrap(cordic_angle_unwrap_t *unwrap, uint32_t angle)
+{
+    unwrap->position = unwrap->started ? (unwrap->position + cordic_angle_diff(angle, unwrap->last)) :
+                       (int64_t)(int32_t)angle;
+    unwrap->last     = angle;
+    unwrap->started  = true;
+
+    return unwrap->position;
+}
+
+void     cordic_angle_unwrap_init(cordic_angle_unwrap_t *unwrap);
+uint32_t cordic_angle_vector(CY_CORDIC_Q31_t x, CY_CORDIC_Q31_t y, uint32_t hold);
+bool     cordic_angle_polar_start(CY_CORDIC_Q31_t x, CY_CORDIC_Q31_t y, uint32_t *angle);
+CY_CORDIC_Q31_t cordic_angle_polar_result(void);
+cy_en_cordic_status_t cordic_angle_vector_batch(const CY_CORDIC_Q31_t *x, const CY_CORDIC_Q31_t *y,
+                                                uint32_t *angle, uint32_t hold, uint32_t count);
+cy_en_cordic_status_t cordic_angle_diff_batch(const uint32_t *a, const uint32_t *b,
+                                              int32_t *diff, uint32_t count);
+cy_en_cordic_status_t cordic_angle_unwrap_batch(cordic_angle_unwrap_t *unwrap, const uint32_t *angle,
+                                                int64_t *position, uint32_t count);
+void     cordic_angle_benchmark(void);
+
+#endif /*CORDIC_ANGLE_H*/
+/* [] END OF FILE */
@@ -0,0 +1,435 @@
+/*******************************************************************************
+* File Name:   cordic_axis.c
+*
+* Description: This file contains the multi-axis Clarke/Park engine. The
+* Park transforms of all axes are issued back to back: while the CORDIC works on
+* one axis, the CPU removes the gain from the previous result and computes the
+* Clarke transform of the next axis.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_gain.h"
+#include "cordic_axis.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* 1 / sqrt(3) in Q31 */
+#define AXIS_INV_SQRT3_Q31       (1239850262LL)
+
+/* Number of runs per measurement, the fastest run is kept */
+#define AXIS_BENCH_RUNS          (8U)
+
+/* Number of PWM frequencies reported by the benchmark */
+#define AXIS_BENCH_FREQUENCIES   (4U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int32_t axis_saturate(int64_t value);
+static int32_t axis_clarke(const cordic_axis_sample_t *sample,
+                           cordic_axis_result_t *result,
+                           uint32_t *theta);
+static void    axis_pipelined(const cordic_axis_sample_t *sample,
+                              cordic_axis_result_t *result,
+                              uint32_t axes);
+static void    axis_sequential(const cordic_axis_sample_t *sample,
+                               cordic_axis_result_t *result,
+                               uint32_t axes);
+static uint32_t axis_measure(void (*transform)(const cordic_axis_sample_t *,
+                                               cordic_axis_result_t *, uint32_t),
+                             uint32_t axes);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark samples and results */
+static cordic_axis_sample_t axis_bench_sample[CORDIC_AXIS_MAX];
+static cordic_axis_result_t axis_bench_result[CORDIC_AXIS_MAX];
+
+/* PWM frequencies reported by the benchmark in Hz */
+static const uint32_t axis_bench_frequency[AXIS_BENCH_FREQUENCIES] =
+{
+    8000U, 16000U, 20000U, 40000U
+};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: axis_saturate
+********************************************************************************
+* Summary:
+* Saturates a 64-bit intermediate to the symmetric Q31 range.
+*
+* Parameters:
+*  int64_t value  Value in Q31
+*
+* Return:
+*  int32_t        Value limited to +/-INT32_MAX
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static int32_t axis_saturate(int64_t value)
+{
+    if (value > INT32_MAX)
+    {
+        value = INT32_MAX;
+    }
+    else if (value < -INT32_MAX)
+    {
+        value = -INT32_MAX;
+    }
+
+    return (int32_t)value;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: axis_clarke
+********************************************************************************
+* Summary:
+* Clarke transform of one axis, ialpha = ia, ibeta = (ia + 2 * ib) / sqrt(3),
+* and folding of its rotor angle into the +/-90 degree range of the peripheral.
+*
+* Parameters:
+*  const cordic_axis_sample_t *sample  Phase currents and angle
+*  cordic_axis_result_t *result        Receives ialpha and ibeta
+*  uint32_t *theta                     Receives the folded angle
+*
+* Return:
+*  int32_t   -1 when the angle was folded, the Park results must be negated, 0 otherwise
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static int32_t axis_clarke(const cordic_axis_sample_t *sample,
+                           cordic_axis_result_t *result,
+                           uint32_t *theta)
+{
+    int64_t sum    = (int64_t)sample->ia + (2LL * sample->ib);
+    int32_t negate = 0;
+
+    result->ialpha = sample->ia;
+    result->ibeta  = axis_saturate(((sum * AXIS_INV_SQRT3_Q31) + (1LL << 30)) >> 31);
+
+    *theta = (uint32_t)sample->angle;
+    negate = cordic_angle_fold(theta);
+
+    return negate;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: axis_pipelined
+********************************************************************************
+* Summary:
+* Pipelined engine. The Clarke transform of axis i + 1 runs while the CORDIC
+* works on axis i; axis i + 1 is started as soon as the result of axis i is
+* read, and the gain of axis i is removed while the CORDIC works on axis i + 1.
+*
+* Parameters:
+*  const cordic_axis_sample_t *sample  Samples, one per axis
+*  cordic_axis_result_t *result        Results, one per axis
+*  uint32_t axes                       Number of axes, 1 to CORDIC_AXIS_MAX
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static void axis_pipelined(const cordic_axis_sample_t *sample,
+                           cordic_axis_result_t *result,
+                           uint32_t axes)
+{
+    cy_stc_cordic_parkTransform_result_t park;
+    uint32_t theta   = 0;
+    int32_t  negate  = axis_clarke(&sample[0], &result[0], &theta);
+    int32_t  current = 0;
+    uint32_t i       = 0;
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)theta, result[0].ialpha, result[0].ibeta);
+    Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)theta, result[0].ialpha, result[0].ibeta);
+
+    for (i = 0U; i < axes; i++)
+    {
+        current = negate;
+
+        /* Clarke transform of the next axis while the peripheral is busy */
+        if ((i + 1U) < axes)
+        {
+            negate = axis_clarke(&sample[i + 1U], &result[i + 1U], &theta);
+        }
+
+        while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+        Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+
+        if ((i + 1U) < axes)
+        {
+            CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)theta, result[i + 1U].ialpha, result[i + 1U].ibeta);
+            Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)theta,
+                                      result[i + 1U].ialpha, result[i + 1U].ibeta);
+        }
+
+        result[i].id = cordic_gain_remove(park.parkTransformId, current);
+        result[i].iq = cordic_gain_remove(park.parkTransformIq, current);
+    }
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: axis_sequential
+********************************************************************************
+* Summary:
+* Reference engine that transforms one axis after the other, as repeated calls
+* of the single-axis sequence: Clarke, start, wait, read, remove the gain.
+* Same results as axis_pipelined().
+*
+* Parameters:
+*  const cordic_axis_sample_t *sample  Samples, one per axis
+*  cordic_axis_result_t *result        Results, one per axis
+*  uint32_t axes                       Number of axes
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void axis_sequential(const cordic_axis_sample_t *sample,
+                            cordic_axis_result_t *result,
+                            uint32_t axes)
+{
+    cy_stc_cordic_parkTransform_result_t park;
+    uint32_t theta  = 0;
+    int32_t  negate = 0;
+    uint32_t i      = 0;
+
+    for (i = 0U; i < axes; i++)
+    {
+        negate = axis_clarke(&sample[i], &result[i], &theta);
+
+        CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)theta, result[i].ialpha, result[i].ibeta);
+        Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)theta, result[i].ialpha, result[i].ibeta);
+        while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+        Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+
+        result[i].id = cordic_gain_remove(park.parkTransformId, negate);
+        result[i].iq = cordic_gain_remove(park.parkTransformIq, negate);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_axis_transform
+********************************************************************************
+* Summary:
+* Clarke and Park transform of all axes of one PWM period:
+* ialpha = ia, ibeta = (ia + 2 * ib) / sqrt(3),
+* id = ialpha * cos(angle) + ibeta * sin(angle),
+* iq = ibeta * cos(angle) - ialpha * sin(angle).
+*
+* Parameters:
+*  const cordic_axis_sample_t *sample  Samples, one per axis
+*  cordic_axis_result_t *result        Results, one per axis
+*  uint32_t axes                       Number of axes, 1 to CORDIC_AXIS_MAX
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for NULL arrays or an axis count out of range
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_axis_transform(const cordic_axis_sample_t *sample,
+                                            cordic_axis_result_t *result,
+                                            uint32_t axes)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+
+    if ((NULL != sample) && (NULL != result) && (0U < axes) && (axes <= CORDIC_AXIS_MAX))
+    {
+        axis_pipelined(sample, result, axes);
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: axis_measure
+********************************************************************************
+* Summary:
+* Measures the cycles of one engine call over the benchmark samples. The
+* fastest of AXIS_BENCH_RUNS runs is kept, so that interrupts do not inflate
+* the cost model.
+*
+* Parameters:
+*  transform      Engine to measure
+*  uint32_t axes  Number of axes
+*
+* Return:
+*  uint32_t       Cycles of one call
+*
+*******************************************************************************/
+static uint32_t axis_measure(void (*transform)(const cordic_axis_sample_t *,
+                                               cordic_axis_result_t *, uint32_t),
+                             uint32_t axes)
+{
+    uint32_t best   = UINT32_MAX;
+    uint32_t start  = 0;
+    uint32_t cycles = 0;
+    uint32_t run    = 0;
+
+    for (run = 0U; run < AXIS_BENCH_RUNS; run++)
+    {
+        start  = cordic_benchmark_get_cycles();
+        transform(axis_bench_sample, axis_bench_result, axes);
+        cycles = cordic_benchmark_get_cycles() - start;
+
+        best = (cycles < best) ? cycles : best;
+    }
+
+    return best;
+}
+
+/*******************************************************************************
+* Function Name: cordic_axis_max_count
+********************************************************************************
+* Summary:
+* Maximum number of axes whose transforms fit into a share of the PWM period.
+* The cost of the engine is measured for one axis and for CORDIC_AXIS_MAX axes
+* and split into a fixed part and a part per axis. The count is not limited to
+* CORDIC_AXIS_MAX; larger drives call the engine once per group of axes.
+*
+* Parameters:
+*  uint32_t pwm_frequency   PWM frequency in Hz
+*  uint32_t budget_percent  Share of the PWM period available for the transforms
+*
+* Return:
+*  uint32_t  Number of axes, 0 when not even one axis fits
+*
+*******************************************************************************/
+uint32_t cordic_axis_max_count(uint32_t pwm_frequency, uint32_t budget_percent)
+{
+    uint32_t budget   = 0;
+    uint32_t single   = 0;
+    uint32_t full     = 0;
+    uint32_t per_axis = 0;
+    uint32_t fixed    = 0;
+    uint32_t count    = 0;
+    uint32_t i        = 0;
+
+    if (0U != pwm_frequency)
+    {
+        for (i = 0U; i < CORDIC_AXIS_MAX; i++)
+        {
+            axis_bench_sample[i].ia    = (CY_CORDIC_Q31_t)(0x20000000L - (int32_t)(i * 0x08000000UL));
+            axis_bench_sample[i].ib    = (CY_CORDIC_Q31_t)(-0x10000000L + (int32_t)(i * 0x04000000UL));
+            axis_bench_sample[i].angle = (CY_CORDIC_Q31_t)(i * 0x2F000000U);
+        }
+
+        budget   = (uint32_t)(((uint64_t)SystemCoreClock * budget_percent) / (100ULL * pwm_frequency));
+        single   = axis_measure(axis_pipelined, 1U);
+        full     = axis_measure(axis_pipelined, CORDIC_AXIS_MAX);
+        per_axis = (full > single) ? ((full - single) / (CORDIC_AXIS_MAX - 1U)) : 1U;
+        per_axis = (0U != per_axis) ? per_axis : 1U;
+        fixed    = (single > per_axis) ? (single - per_axis) : 0U;
+        count    = (budget > fixed) ? ((budget - fixed) / per_axis) : 0U;
+    }
+
+    return count;
+}
+
+/*******************************************************************************
+* Function Name: cordic_axis_benchmark
+********************************************************************************
+* Summary:
+* Measures the cycles per PWM period of the sequential and the pipelined engine
+* for 1 to CORDIC_AXIS_MAX axes, checks that both give the same results, and
+* reports the maximum axis count for common PWM frequencies.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_axis_benchmark(void)
+{
+    cordic_axis_result_t reference[CORDIC_AXIS_MAX];
+    uint32_t sequential = 0;
+    uint32_t pipelined  = 0;
+    uint32_t axes       = 0;
+    uint32_t i          = 0;
+    bool     match      = true;
+
+    /* Also initializes the benchmark samples */
+    (void)cordic_axis_max_count(axis_bench_frequency[0], CORDIC_AXIS_BUDGET_PERCENT);
+
+    printf("\r\naxes | sequential cycles | pipelined cycles\r\n");
+    for (axes = 1U; axes <= CORDIC_AXIS_MAX; axes++)
+    {
+        sequential = axis_measure(axis_sequential, axes);
+        pipelined  = axis_measure(axis_pipelined, axes);
+        printf("%4u | %17u | %16u\r\n", (unsigned int)axes,
+               (unsigned int)sequential, (unsigned int)pipelined);
+    }
+
+    axis_sequential(axis_bench_sample, reference, CORDIC_AXIS_MAX);
+    (void)cordic_axis_transform(axis_bench_sample, axis_bench_result, CORDIC_AXIS_MAX);
+    for (i = 0U; i < CORDIC_AXIS_MAX; i++)
+    {
+        match = match && (reference[i].id == axis_bench_result[i].id) &&
+                         (reference[i].iq == axis_bench_result[i].iq);
+    }
+    printf("Results of the sequential and pipelined engines %s.\r\n", match ? "match" : "DIFFER");
+
+    printf("\r\nMaximum axes with %u%% of the PWM period for the transforms\r\n",
+           (unsigned int)CORDIC_AXIS_BUDGET_PERCENT);
+    for (i = 0U; i < AXIS_BENCH_FREQUENCIES; i++)
+    {
+        printf("%5u Hz : %u\r\n", (unsigned int)axis_bench_frequency[i],
+               (unsigned int)cordic_axis_max_count(axis_bench_frequency[i], CORDIC_AXIS_BUDGET_PERCENT));
+    }
+}
+
+/* [] END OF FILE */
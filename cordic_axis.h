@@ -0,0 +1,90 @@
+/*******************************************************************************
+* File Name:   cordic_axis.h
+*
+* Description: This header file contains the interface to the multi-axis
+* Clarke/Park engine. Drives controlling several motors from the same PWM
+* period transform one set of phase currents per axis; the engine runs the Park
+* transforms of all axes back to back on the CORDIC.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_AXIS_H
+#define CORDIC_AXIS_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Highest number of axes of one engine call */
+#define CORDIC_AXIS_MAX            (8U)
+
+/* Share of the PWM period in percent assumed for the transforms when the
+ * benchmark reports the maximum axis count */
+#define CORDIC_AXIS_BUDGET_PERCENT (25U)
+
+/* Sample of one axis in one PWM period. The currents of phases a and b are
+ * Q31, phase c follows from ia + ib + ic = 0. */
+typedef struct
+{
+    CY_CORDIC_Q31_t ia;
+    CY_CORDIC_Q31_t ib;
+    CY_CORDIC_Q31_t angle;      /* Rotor angle, Q31 binary angle over the full circle */
+} cordic_axis_sample_t;
+
+/* Transformed currents of one axis, Q31 and saturated to +/-1 */
+typedef struct
+{
+    CY_CORDIC_Q31_t ialpha;
+    CY_CORDIC_Q31_t ibeta;
+    CY_CORDIC_Q31_t id;
+    CY_CORDIC_Q31_t iq;
+} cordic_axis_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_en_cordic_status_t cordic_axis_transform(const cordic_axis_sample_t *sample,
+                                            cordic_axis_result_t *result,
+                                            uint32_t axes);
+uint32_t cordic_axis_max_count(uint32_t pwm_frequency, uint32_t budget_percent);
+void cordic_axis_benchmark(void);
+
+#endif /*CORDIC_AXIS_H*/
+/* [] END OF FILE */
@@ -0,0 +1,443 @@
+/*******************************************************************************
+* File Name:   cordic_batch.c
+*
+* Description: This file contains the batch Park transform and vector
+* rotation on the CORDIC peripheral. The loops are software pipelined: while
+* the peripheral computes element i + 1, the CPU removes the gain of element i
+* and stores it, so the conversion work hides in the peripheral latency. Angles
+* outside +/-90 degrees are folded by pi and the results negated, since the
+* peripheral only converges within that range.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_gain.h"
+#include "cordic_batch.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of elements of the benchmark batches */
+#define CORDIC_BATCH_BENCH_COUNT  (64U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static bool    batch_is_aligned(const void *pointer);
+static void    batch_park_pipeline(const CY_CORDIC_Q31_t *angle,
+                                   const CY_CORDIC_Q31_t *ialpha,
+                                   const CY_CORDIC_Q31_t *ibeta,
+                                   CY_CORDIC_Q31_t *id,
+                                   CY_CORDIC_Q31_t *iq,
+                                   uint32_t count,
+                                   uint32_t angle_sign);
+static void    bench_aos_blocking(const cordic_batch_park_input_t *input,
+                                  cy_stc_cordic_parkTransform_result_t *result,
+                                  uint32_t count);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Scratch arrays of the AoS adapter */
+static CY_CORDIC_Q31_t cordic_batch_angle[CORDIC_BATCH_CHUNK]  CORDIC_BATCH_ALIGNED;
+static CY_CORDIC_Q31_t cordic_batch_alpha[CORDIC_BATCH_CHUNK]  CORDIC_BATCH_ALIGNED;
+static CY_CORDIC_Q31_t cordic_batch_beta[CORDIC_BATCH_CHUNK]   CORDIC_BATCH_ALIGNED;
+static CY_CORDIC_Q31_t cordic_batch_id[CORDIC_BATCH_CHUNK]     CORDIC_BATCH_ALIGNED;
+static CY_CORDIC_Q31_t cordic_batch_iq[CORDIC_BATCH_CHUNK]     CORDIC_BATCH_ALIGNED;
+
+/* Benchmark operands and results in both layouts */
+static CY_CORDIC_Q31_t bench_angle[CORDIC_BATCH_BENCH_COUNT]   CORDIC_BATCH_ALIGNED;
+static CY_CORDIC_Q31_t bench_alpha[CORDIC_BATCH_BENCH_COUNT]   CORDIC_BATCH_ALIGNED;
+static CY_CORDIC_Q31_t bench_beta[CORDIC_BATCH_BENCH_COUNT]    CORDIC_BATCH_ALIGNED;
+static CY_CORDIC_Q31_t bench_id[CORDIC_BATCH_BENCH_COUNT]      CORDIC_BATCH_ALIGNED;
+static CY_CORDIC_Q31_t bench_iq[CORDIC_BATCH_BENCH_COUNT]      CORDIC_BATCH_ALIGNED;
+static cordic_batch_park_input_t            bench_input[CORDIC_BATCH_BENCH_COUNT];
+static cy_stc_cordic_parkTransform_result_t bench_result[CORDIC_BATCH_BENCH_COUNT];
+static cy_stc_cordic_parkTransform_result_t bench_blocking_result[CORDIC_BATCH_BENCH_COUNT];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: batch_is_aligned
+********************************************************************************
+* Summary:
+* Checks a batch array against CORDIC_BATCH_ALIGN.
+*
+* Parameters:
+*  const void *pointer  Array
+*
+* Return:
+*  bool                 true when the array is not NULL and aligned
+*
+*******************************************************************************/
+static bool batch_is_aligned(const void *pointer)
+{
+    return (NULL != pointer) && (0U == ((uintptr_t)pointer & (CORDIC_BATCH_ALIGN - 1U)));
+}
+
+/*******************************************************************************
+* Function Name: batch_park_pipeline
+********************************************************************************
+* Summary:
+* Pipelined Park transform over arrays. The angle of element i + 1 is folded
+* while the peripheral works on element i; element i + 1 is started right
+* after the result of element i is read, and element i is post-processed
+* while the peripheral works on element i + 1. A rotation by +theta is the
+* Park transform by -theta, selected by angle_sign.
+*
+* Parameters:
+*  const CY_CORDIC_Q31_t *angle   Angles
+*  const CY_CORDIC_Q31_t *ialpha  First vector components
+*  const CY_CORDIC_Q31_t *ibeta   Second vector components
+*  CY_CORDIC_Q31_t *id            First result components
+*  CY_CORDIC_Q31_t *iq            Second result components
+*  uint32_t count                 Number of elements, at least 1
+*  uint32_t angle_sign            0 for the Park transform, 0xFFFFFFFF to negate the angles
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static void batch_park_pipeline(const CY_CORDIC_Q31_t *angle,
+                                const CY_CORDIC_Q31_t *ialpha,
+                                const CY_CORDIC_Q31_t *ibeta,
+                                CY_CORDIC_Q31_t *id,
+                                CY_CORDIC_Q31_t *iq,
+                                uint32_t count,
+                                uint32_t angle_sign)
+{
+    cy_stc_cordic_parkTransform_result_t park;
+    uint32_t theta   = ((uint32_t)angle[0] ^ angle_sign) - angle_sign;
+    int32_t  negate  = cordic_angle_fold(&theta);
+    int32_t  current = 0;
+    uint32_t i       = 0;
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)theta, ialpha[0], ibeta[0]);
+    Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)theta, ialpha[0], ibeta[0]);
+
+    for (i = 0U; i < count; i++)
+    {
+        current = negate;
+
+        /* Prepare the next element while the peripheral is busy */
+        if ((i + 1U) < count)
+        {
+            theta  = ((uint32_t)angle[i + 1U] ^ angle_sign) - angle_sign;
+            negate = cordic_angle_fold(&theta);
+        }
+
+        while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+        Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+
+        if ((i + 1U) < count)
+        {
+            CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)theta, ialpha[i + 1U], ibeta[i + 1U]);
+            Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)theta, ialpha[i + 1U], ibeta[i + 1U]);
+        }
+
+        id[i] = cordic_gain_remove(park.parkTransformId, current);
+        iq[i] = cordic_gain_remove(park.parkTransformIq, current);
+    }
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_batch_park
+********************************************************************************
+* Summary:
+* Park transform of count elements in the structure-of-arrays layout:
+* id = alpha * cos(angle) + beta * sin(angle), iq = beta * cos(angle) - alpha * sin(angle).
+*
+* Parameters:
+*  const CY_CORDIC_Q31_t *angle   Rotor angles, Q31 binary angle
+*  const CY_CORDIC_Q31_t *ialpha  Alpha currents in Q31
+*  const CY_CORDIC_Q31_t *ibeta   Beta currents in Q31
+*  CY_CORDIC_Q31_t *id            D currents in Q31
+*  CY_CORDIC_Q31_t *iq            Q currents in Q31
+*  uint32_t count                 Number of elements
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when an array is NULL or not aligned
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_batch_park(const CY_CORDIC_Q31_t *angle,
+                                        const CY_CORDIC_Q31_t *ialpha,
+                                        const CY_CORDIC_Q31_t *ibeta,
+                                        CY_CORDIC_Q31_t *id,
+                                        CY_CORDIC_Q31_t *iq,
+                                        uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+
+    if (batch_is_aligned(angle) && batch_is_aligned(ialpha) && batch_is_aligned(ibeta) &&
+        batch_is_aligned(id) && batch_is_aligned(iq))
+    {
+        if (0U != count)
+        {
+            batch_park_pipeline(angle, ialpha, ibeta, id, iq, count, 0U);
+        }
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_batch_rotate
+********************************************************************************
+* Summary:
+* Rotation of count vectors by their angles in the structure-of-arrays layout:
+* xr = x * cos(angle) - y * sin(angle), yr = x * sin(angle) + y * cos(angle).
+*
+* Parameters:
+*  const CY_CORDIC_Q31_t *angle  Rotation angles, Q31 binary angle
+*  const CY_CORDIC_Q31_t *x      X components in Q31
+*  const CY_CORDIC_Q31_t *y      Y components in Q31
+*  CY_CORDIC_Q31_t *xr           Rotated x components in Q31
+*  CY_CORDIC_Q31_t *yr           Rotated y components in Q31
+*  uint32_t count                Number of elements
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when an array is NULL or not aligned
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_batch_rotate(const CY_CORDIC_Q31_t *angle,
+                                          const CY_CORDIC_Q31_t *x,
+                                          const CY_CORDIC_Q31_t *y,
+                                          CY_CORDIC_Q31_t *xr,
+                                          CY_CORDIC_Q31_t *yr,
+                                          uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+
+    if (batch_is_aligned(angle) && batch_is_aligned(x) && batch_is_aligned(y) &&
+        batch_is_aligned(xr) && batch_is_aligned(yr))
+    {
+        if (0U != count)
+        {
+            batch_park_pipeline(angle, x, y, xr, yr, count, 0xFFFFFFFFU);
+        }
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_batch_park_aos
+********************************************************************************
+* Summary:
+* Adapter for the array-of-structures layout. The operands are gathered into
+* aligned scratch arrays in chunks of CORDIC_BATCH_CHUNK, transformed by
+* cordic_batch_park() and scattered into the result structures. Unlike the
+* driver, the results are Q31 without the gain, as for the other batch calls.
+*
+* Parameters:
+*  const cordic_batch_park_input_t *input         Operands
+*  cy_stc_cordic_parkTransform_result_t *result   Results in Q31
+*  uint32_t count                                 Number of elements
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when an array is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_batch_park_aos(const cordic_batch_park_input_t *input,
+                                            cy_stc_cordic_parkTransform_result_t *result,
+                                            uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t              done   = 0;
+    uint32_t              chunk  = 0;
+    uint32_t              i      = 0;
+
+    if ((NULL != input) && (NULL != result))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (done = 0U; done < count; done += chunk)
+        {
+            chunk = ((count - done) < CORDIC_BATCH_CHUNK) ? (count - done) : CORDIC_BATCH_CHUNK;
+
+            for (i = 0U; i < chunk; i++)
+            {
+                cordic_batch_angle[i] = input[done + i].angle;
+                cordic_batch_alpha[i] = input[done + i].ialpha;
+                cordic_batch_beta[i]  = input[done + i].ibeta;
+            }
+
+            batch_park_pipeline(cordic_batch_angle, cordic_batch_alpha, cordic_batch_beta,
+                                cordic_batch_id, cordic_batch_iq, chunk, 0U);
+
+            for (i = 0U; i < chunk; i++)
+            {
+                result[done + i].parkTransformId = cordic_batch_id[i];
+                result[done + i].parkTransformIq = cordic_batch_iq[i];
+            }
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: bench_aos_blocking
+********************************************************************************
+* Summary:
+* Batch Park transform written as a loop around the single-call sequence of
+* park_transform(): start, wait, read and convert one structure at a time.
+* Reference for the batch benchmark, same results as cordic_batch_park().
+*
+* Parameters:
+*  const cordic_batch_park_input_t *input         Operands
+*  cy_stc_cordic_parkTransform_result_t *result   Results in Q31
+*  uint32_t count                                 Number of elements
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void bench_aos_blocking(const cordic_batch_park_input_t *input,
+                               cy_stc_cordic_parkTransform_result_t *result,
+                               uint32_t count)
+{
+    cy_stc_cordic_parkTransform_result_t park;
+    uint32_t theta  = 0;
+    int32_t  negate = 0;
+    uint32_t i      = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        theta  = (uint32_t)input[i].angle;
+        negate = cordic_angle_fold(&theta);
+
+        CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)theta, input[i].ialpha, input[i].ibeta);
+        Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)theta, input[i].ialpha, input[i].ibeta);
+        while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+        Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+
+        result[i].parkTransformId = cordic_gain_remove(park.parkTransformId, negate);
+        result[i].parkTransformIq = cordic_gain_remove(park.parkTransformIq, negate);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_batch_benchmark
+********************************************************************************
+* Summary:
+* Measures the cycles per element of a batch Park transform in the AoS layout
+* with the blocking single-call loop, through the AoS adapter, and in the SoA
+* layout, and of the SoA rotation. Checks that all Park variants give the same
+* results.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_batch_benchmark(void)
+{
+    uint32_t seed     = 0x2545F491UL;
+    uint32_t start    = 0;
+    uint32_t blocking = 0;
+    uint32_t adapter  = 0;
+    uint32_t soa      = 0;
+    uint32_t rotate   = 0;
+    uint32_t i        = 0;
+    bool     match    = true;
+
+    for (i = 0U; i < CORDIC_BATCH_BENCH_COUNT; i++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        bench_angle[i] = (CY_CORDIC_Q31_t)seed;
+        seed = (seed * 1664525UL) + 1013904223UL;
+        bench_alpha[i] = ((CY_CORDIC_Q31_t)seed) >> 1;
+        seed = (seed * 1664525UL) + 1013904223UL;
+        bench_beta[i]  = ((CY_CORDIC_Q31_t)seed) >> 1;
+
+        bench_input[i].angle  = bench_angle[i];
+        bench_input[i].ialpha = bench_alpha[i];
+        bench_input[i].ibeta  = bench_beta[i];
+    }
+
+    start    = cordic_benchmark_get_cycles();
+    bench_aos_blocking(bench_input, bench_blocking_result, CORDIC_BATCH_BENCH_COUNT);
+    blocking = cordic_benchmark_get_cycles() - start;
+
+    start    = cordic_benchmark_get_cycles();
+    (void)cordic_batch_park_aos(bench_input, bench_result, CORDIC_BATCH_BENCH_COUNT);
+    adapter  = cordic_benchmark_get_cycles() - start;
+
+    start    = cordic_benchmark_get_cycles();
+    (void)cordic_batch_park(bench_angle, bench_alpha, bench_beta, bench_id, bench_iq, CORDIC_BATCH_BENCH_COUNT);
+    soa      = cordic_benchmark_get_cycles() - start;
+
+    for (i = 0U; i < CORDIC_BATCH_BENCH_COUNT; i++)
+    {
+        match = match && (bench_blocking_result[i].parkTransformId == bench_id[i]) &&
+                         (bench_blocking_result[i].parkTransformIq == bench_iq[i]) &&
+                         (bench_result[i].parkTransformId == bench_id[i]) &&
+                         (bench_result[i].parkTransformIq == bench_iq[i]);
+    }
+
+    start    = cordic_benchmark_get_cycles();
+    (void)cordic_batch_rotate(bench_angle, bench_alpha, bench_beta, bench_id, bench_iq, CORDIC_BATCH_BENCH_COUNT);
+    rotate   = cordic_benchmark_get_cycles() - start;
+
+    printf("\r\n%u elements, cycles per element\r\n", (unsigned int)CORDIC_BATCH_BENCH_COUNT);
+    printf("park, AoS blocking loop : %u\r\n", (unsigned int)(blocking / CORDIC_BATCH_BENCH_COUNT));
+    printf("park, AoS adapter       : %u\r\n", (unsigned int)(adapter / CORDIC_BATCH_BENCH_COUNT));
+    printf("park, SoA pipelined     : %u\r\n", (unsigned int)(soa / CORDIC_BATCH_BENCH_COUNT));
+    printf("rotate, SoA pipelined   : %u\r\n", (unsigned int)(rotate / CORDIC_BATCH_BENCH_COUNT));
+    printf("Results of the blocking, AoS, and SoA variants %s.\r\n", match ? "match" : "DIFFER");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* File Name:   cordic_batch.h
+*
+* Description: This header file contains the interface of the batch CORDIC
+* operations. The batch functions take structure-of-arrays operands: one array
+* per operand and per result, each aligned to CORDIC_BATCH_ALIGN, so that the
+* pre- and post-processing loops run over contiguous words. Adapters accept the
+* array-of-structures layout of the single-call API.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_BATCH_H
+#define CORDIC_BATCH_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Required alignment of every batch array in bytes */
+#define CORDIC_BATCH_ALIGN   (8U)
+
+/* Declares a batch array with the required alignment */
+#define CORDIC_BATCH_ALIGNED CY_ALIGN(CORDIC_BATCH_ALIGN)
+
+/* Number of elements the AoS adapters convert per step */
+#define CORDIC_BATCH_CHUNK   (32U)
+
+/* Park transform operands in the array-of-structures layout */
+typedef struct
+{
+    CY_CORDIC_Q31_t angle;
+    CY_CORDIC_Q31_t ialpha;
+    CY_CORDIC_Q31_t ibeta;
+} cordic_batch_park_input_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* All angles are Q31 binary angles over the full circle. Results are Q31 with
+ * the CORDIC gain removed and saturated to +/-1. */
+cy_en_cordic_status_t cordic_batch_park(const CY_CORDIC_Q31_t *angle,
+                                        const CY_CORDIC_Q31_t *ialpha,
+                                        const CY_CORDIC_Q31_t *ibeta,
+                                        CY_CORDIC_Q31_t *id,
+                                        CY_CORDIC_Q31_t *iq,
+                                        uint32_t count);
+cy_en_cordic_status_t cordic_batch_rotate(const CY_CORDIC_Q31_t *angle,
+                                          const CY_CORDIC_Q31_t *x,
+                                          const CY_CORDIC_Q31_t *y,
+                                          CY_CORDIC_Q31_t *xr,
+                                          CY_CORDIC_Q31_t *yr,
+                                          uint32_t count);
+cy_en_cordic_status_t cordic_batch_park_aos(const cordic_batch_park_input_t *input,
+                                            cy_stc_cordic_parkTransform_result_t *result,
+                                            uint32_t count);
+void cordic_batch_benchmark(void);
+
+#endif /*CORDIC_BATCH_H*/
+/* [] END OF FILE */
@@ -0,0 +1,293 @@
+/*******************************************************************************
+* File Name:   cordic_beam.c
+*
+* Description: This file contains the beamforming steering-weight
+* generator. The direction vector of the look angle is one CORDIC rotation, the
+* delays are a dot product with the element positions, and the weights are
+* rotations of the unit vector by minus the delay phase with
+* cordic_batch_rotate(), in chunks of CORDIC_BATCH_CHUNK elements.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "cordic_benchmark.h"
+#include "cordic_batch.h"
+#include "cordic_beam.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Shift from a path difference in wavelengths, Q24, to a Q31 binary angle */
+#define BEAM_WAVELENGTH_SHIFT    (8U)
+
+/* Array sizes and look directions of the benchmark */
+#define BEAM_BENCH_SIZES         (4U)
+#define BEAM_BENCH_ELEMENTS      (64U)
+#define BEAM_BENCH_ANGLES        (16U)
+
+/* -60 degrees as a Q31 binary angle and the step to +60 degrees */
+#define BEAM_BENCH_FIRST_ANGLE   (-715827883L)
+#define BEAM_BENCH_ANGLE_STEP    (95443718L)
+
+/* Element spacing of the benchmark array, half a wavelength in Q24 */
+#define BEAM_BENCH_SPACING       (1L << 23)
+
+/* Conversions of the benchmark */
+#define BEAM_Q24_TO_FLOAT        (1.0f / 16777216.0f)
+#define BEAM_Q31_TO_FLOAT        (1.0f / 2147483648.0f)
+#define BEAM_ANGLE_TO_FLOAT      (PI / 2147483648.0f)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void beam_float(const cordic_beam_element_t *elements, uint32_t count,
+                       float32_t look_angle, float32_t *weights);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Operands and results of cordic_batch_rotate() */
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t beam_angle[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t beam_unit[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t beam_zero[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t beam_re[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t beam_im[CORDIC_BATCH_CHUNK];
+
+/* Benchmark array and weights */
+static cordic_beam_element_t beam_bench_elements[BEAM_BENCH_ELEMENTS];
+static q31_t                 beam_bench_weights[2U * BEAM_BENCH_ELEMENTS];
+static float32_t             beam_bench_float[2U * BEAM_BENCH_ELEMENTS];
+
+/* Array sizes of the benchmark */
+static const uint32_t beam_bench_count[BEAM_BENCH_SIZES] = { 8U, 16U, 32U, 64U };
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_beam_steer
+********************************************************************************
+* Summary:
+* Computes the steering weights of an array for a look direction. The path
+* difference of element n is x_n * sin(look) + y_n * cos(look) wavelengths.
+* Its fractional part is the phase of the element as a binary angle, so the
+* phase needs no reduction.
+*
+* Parameters:
+*  const cordic_beam_element_t *elements  Element positions, within 128
+*                                         wavelengths of the origin
+*  uint32_t count                         Number of elements
+*  CY_CORDIC_Q31_t look_angle             Look direction, Q31 binary angle
+*  q31_t *delay                           Path differences in wavelengths, Q24, or NULL
+*  q31_t *weights                         count interleaved {re, im} pairs in Q31
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when elements or weights is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_beam_steer(const cordic_beam_element_t *elements,
+                                        uint32_t count,
+                                        CY_CORDIC_Q31_t look_angle,
+                                        q31_t *delay,
+                                        q31_t *weights)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    int64_t  sin_look = 0;
+    int64_t  cos_look = 0;
+    q31_t    path     = 0;
+    uint32_t start    = 0;
+    uint32_t chunk    = 0;
+    uint32_t i        = 0;
+
+    if ((NULL != elements) && (NULL != weights))
+    {
+        /* Direction vector: the unit vector rotated by the look angle */
+        beam_angle[0] = look_angle;
+        beam_unit[0]  = INT32_MAX;
+        (void)cordic_batch_rotate(beam_angle, beam_unit, beam_zero, beam_re, beam_im, 1U);
+        cos_look = beam_re[0];
+        sin_look = beam_im[0];
+
+        for (i = 0U; i < CORDIC_BATCH_CHUNK; i++)
+        {
+            beam_unit[i] = INT32_MAX;
+        }
+
+        for (start = 0U; start < count; start += chunk)
+        {
+            chunk = ((count - start) < CORDIC_BATCH_CHUNK) ? (count - start) : CORDIC_BATCH_CHUNK;
+
+            for (i = 0U; i < chunk; i++)
+            {
+                path = (q31_t)((((int64_t)elements[start + i].x * sin_look) +
+                                ((int64_t)elements[start + i].y * cos_look)) >> 31);
+                beam_angle[i] = -(CY_CORDIC_Q31_t)((uint32_t)path << BEAM_WAVELENGTH_SHIFT);
+                if (NULL != delay)
+                {
+                    delay[start + i] = path;
+                }
+            }
+
+            (void)cordic_batch_rotate(beam_angle, beam_unit, beam_zero, beam_re, beam_im, chunk);
+
+            for (i = 0U; i < chunk; i++)
+            {
+                weights[2U * (start + i)]        = beam_re[i];
+                weights[(2U * (start + i)) + 1U] = beam_im[i];
+            }
+        }
+
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: beam_float
+********************************************************************************
+* Summary:
+* Floating-point reference with sinf() and cosf() for the direction and each
+* weight.
+*
+* Parameters:
+*  const cordic_beam_element_t *elements  Element positions
+*  uint32_t count                         Number of elements
+*  float32_t look_angle                   Look direction in radians
+*  float32_t *weights                     count interleaved {re, im} pairs
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void beam_float(const cordic_beam_element_t *elements, uint32_t count,
+                       float32_t look_angle, float32_t *weights)
+{
+    float32_t sin_look = sinf(look_angle);
+    float32_t cos_look = cosf(look_angle);
+    float32_t phase    = 0.0f;
+    uint32_t  i        = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        phase = -2.0f * PI * ((((float32_t)elements[i].x * sin_look) +
+                               ((float32_t)elements[i].y * cos_look)) * BEAM_Q24_TO_FLOAT);
+        weights[2U * i]        = cosf(phase);
+        weights[(2U * i) + 1U] = sinf(phase);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_beam_benchmark
+********************************************************************************
+* Summary:
+* Steers uniform linear arrays of 8 to 64 elements at half-wavelength spacing
+* through 16 look directions from -60 to +60 degrees with the CORDIC and with
+* the floating-point reference, and prints the re-steers per second and the
+* maximum weight deviation.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_beam_benchmark(void)
+{
+    uint32_t        start   = 0;
+    uint32_t        cordic  = 0;
+    uint32_t        library = 0;
+    float32_t       error   = 0.0f;
+    CY_CORDIC_Q31_t angle   = 0;
+    uint32_t        count   = 0;
+    uint32_t        s       = 0;
+    uint32_t        a       = 0;
+    uint32_t        i       = 0;
+
+    /* Centred on the origin, along the x axis */
+    for (i = 0U; i < BEAM_BENCH_ELEMENTS; i++)
+    {
+        beam_bench_elements[i].x = ((int32_t)(2U * i) - (int32_t)(BEAM_BENCH_ELEMENTS - 1U)) * (BEAM_BENCH_SPACING / 2);
+        beam_bench_elements[i].y = 0;
+    }
+
+    printf("\r\nUniform linear array, half-wavelength spacing, %u look directions\r\n",
+           (unsigned int)BEAM_BENCH_ANGLES);
+    printf("Elements  CORDIC steers/s  float steers/s  max weight error\r\n");
+
+    for (s = 0U; s < BEAM_BENCH_SIZES; s++)
+    {
+        count   = beam_bench_count[s];
+        cordic  = 0U;
+        library = 0U;
+        error   = 0.0f;
+
+        for (a = 0U; a < BEAM_BENCH_ANGLES; a++)
+        {
+            angle = (CY_CORDIC_Q31_t)(BEAM_BENCH_FIRST_ANGLE + ((int32_t)a * BEAM_BENCH_ANGLE_STEP));
+
+            start   = cordic_benchmark_get_cycles();
+            (void)cordic_beam_steer(beam_bench_elements, count, angle, NULL, beam_bench_weights);
+            cordic += cordic_benchmark_get_cycles() - start;
+
+            start    = cordic_benchmark_get_cycles();
+            beam_float(beam_bench_elements, count, (float32_t)angle * BEAM_ANGLE_TO_FLOAT, beam_bench_float);
+            library += cordic_benchmark_get_cycles() - start;
+
+            for (i = 0U; i < (2U * count); i++)
+            {
+                error = fmaxf(error, fabsf(((float32_t)beam_bench_weights[i] * BEAM_Q31_TO_FLOAT) -
+                                           beam_bench_float[i]));
+            }
+        }
+
+        cordic  = (0U != cordic) ? cordic : 1U;
+        library = (0U != library) ? library : 1U;
+
+        printf("%8u %16u %15u %17.2e\r\n", (unsigned int)count,
+               (unsigned int)(((uint64_t)SystemCoreClock * BEAM_BENCH_ANGLES) / cordic),
+               (unsigned int)(((uint64_t)SystemCoreClock * BEAM_BENCH_ANGLES) / library),
+               (double)error);
+    }
+}
+
+/* [] END OF FILE */
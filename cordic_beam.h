@@ -0,0 +1,80 @@
+/*******************************************************************************
+* File Name:   cordic_beam.h
+*
+* Description: This header file contains the interface to the
+* beamforming steering-weight generator. It computes the delays of the elements
+* of a planar microphone or ultrasonic array for a look direction and fills
+* complex Q31 weight vectors with batched CORDIC rotations.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_BEAM_H
+#define CORDIC_BEAM_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "arm_math.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Position of one array element in wavelengths at the design frequency, Q24.
+ * The look direction is measured from the y axis towards the x axis, so the
+ * broadside of an array along the x axis is the angle 0. */
+typedef struct
+{
+    q31_t x;
+    q31_t y;
+} cordic_beam_element_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* The look angle is a Q31 binary angle over the full circle. delay receives
+ * the path difference of each element relative to the origin in wavelengths,
+ * Q24, and may be NULL. weights receives count interleaved {re, im} pairs of
+ * unit magnitude, e^(-j * 2 * pi * delay), in Q31. */
+cy_en_cordic_status_t cordic_beam_steer(const cordic_beam_element_t *elements,
+                                        uint32_t count,
+                                        CY_CORDIC_Q31_t look_angle,
+                                        q31_t *delay,
+                                        q31_t *weights);
+void cordic_beam_benchmark(void);
+
+#endif /*CORDIC_BEAM_H*/
+/* [] END OF FILE */
@@ -0,0 +1,189 @@
+/*******************************************************************************
+* File Name:   cordic_benchmark.c
+*
+* Description: This file contains the benchmark menu. It lists the available
+* benchmarks, gets the user selection and runs the selected one. The cycle
+* counter of the DWT unit is used for all the measurements.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "stdlib.h"
+#include "cordic_benchmark.h"
+#include "cordic_soft.h"
+#include "cordic_fastpath.h"
+#include "cordic_batch.h"
+#include "cordic_placement.h"
+#include "cordic_suite.h"
+#include "cordic_axis.h"
+#include "cordic_analytic.h"
+#include "cordic_demod.h"
+#include "cordic_costas.h"
+#include "cordic_activation.h"
+#include "cordic_softmax.h"
+#include "cordic_biquad.h"
+#include "cordic_window.h"
+#include "cordic_vocoder.h"
+#include "cordic_beam.h"
+#include "cordic_geo.h"
+#include "cordic_color.h"
+#include "cordic_encoder.h"
+#include "cordic_mtpa.h"
+#include "cordic_ekf.h"
+#include "cordic_circstat.h"
+#include "cordic_angle.h"
+#include "cordic_thermistor.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Benchmark entry: name printed in the menu and function running it */
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+} cordic_benchmark_entry_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Available benchmarks */
+static const cordic_benchmark_entry_t cordic_benchmarks[] =
+{
+    {"software CORDIC with residual correction", cordic_soft_benchmark},
+    {"fast paths ahead of the peripheral",       cordic_fast_benchmark},
+    {"batch Park transform, AoS versus SoA",     cordic_batch_benchmark},
+    {"flash versus RAM execution",               cordic_placement_benchmark},
+    {"operation suite",                          cordic_suite_benchmark},
+    {"multi-axis Clarke/Park engine",            cordic_axis_benchmark},
+    {"analytic signal envelope and frequency",   cordic_analytic_benchmark},
+    {"FM discriminator",                         cordic_demod_benchmark},
+    {"QPSK carrier recovery",                    cordic_costas_benchmark},
+    {"tanh and sigmoid activations",             cordic_act_benchmark},
+    {"softmax",                                  cordic_softmax_benchmark},
+    {"biquad coefficient design",                cordic_biquad_benchmark},
+    {"window generation",                        cordic_window_benchmark},
+    {"phase vocoder",                            cordic_vocoder_benchmark},
+    {"beamforming steering weights",             cordic_beam_benchmark},
+    {"great-circle distance and bearing",        cordic_geo_benchmark},
+    {"HSV and RGB color conversion",             cordic_color_benchmark},
+    {"sin/cos encoder interpolation",            cordic_encoder_benchmark},
+    {"MTPA and field-weakening references",      cordic_mtpa_benchmark},
+    {"extended Kalman filter",                   cordic_ekf_benchmark},
+    {"circular statistics",                      cordic_circstat_benchmark},
+    {"angle unwrapping and arithmetic",          cordic_angle_benchmark},
+    {"thermistor linearization",                 cordic_thermistor_benchmark},
+};
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_benchmark_init
+********************************************************************************
+* Summary:
+* Enables the trace unit and starts the DWT cycle counter.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_benchmark_init(void)
+{
+    DCB->DEMCR |= DCB_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0U;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/*******************************************************************************
+* Function Name: run_cordic_benchmarks
+********************************************************************************
+* Summary:
+* This function prints the benchmark menu and gets the benchmark to be run from
+* the user. The selected benchmark is executed and prints its own results.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void run_cordic_benchmarks(void)
+{
+    char     selection[16] = {0};
+    uint32_t index         = 0;
+
+    cordic_benchmark_init();
+
+    printf("\r\nSelected option - benchmarks.");
+    printf("\r\nPlease select the benchmark from the list. \r\n");
+
+    for (index = 0U; index < (sizeof(cordic_benchmarks) / sizeof(cordic_benchmarks[0])); index++)
+    {
+        printf("%u - %s \r\n", (unsigned int)index, cordic_benchmarks[index].name);
+    }
+    printf(">> \r\n");
+
+    if (0 < scanf("%15s", selection))
+    {
+        index = (uint32_t)atoi(selection);
+
+        if (index < (sizeof(cordic_benchmarks) / sizeof(cordic_benchmarks[0])))
+        {
+            printf("\r\nRunning benchmark - %s. Core clock: %u Hz.\r\n",
+                   cordic_benchmarks[index].name, (unsigned int)SystemCoreClock);
+            cordic_benchmarks[index].run();
+        }
+        else
+        {
+            printf("Wrong option selected. Please try again... \r\n");
+        }
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,81 @@
+/*******************************************************************************
+* File Name:   cordic_benchmark.h
+*
+* Description: This header file contains the interface to the benchmark menu
+* and the cycle counter used to measure the CORDIC operations.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_BENCHMARK_H
+#define CORDIC_BENCHMARK_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+/*******************************************************************************
+* Function Name: cordic_benchmark_get_cycles
+********************************************************************************
+* Summary:
+* Returns the current value of the DWT cycle counter. The counter must be
+* enabled by cordic_benchmark_init() first.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t  Core clock cycles
+*
+*******************************************************************************/
+__STATIC_INLINE uint32_t cordic_benchmark_get_cycles(void)
+{
+    return DWT->CYCCNT;
+}
+
+void cordic_benchmark_init(void);
+void run_cordic_benchmarks(void);
+
+#endif /*CORDIC_BENCHMARK_H*/
+/* [] END OF FILE */
@@ -0,0 +1,495 @@
+/*******************************************************************************
+* File Name:   cordic_biquad.c
+*
+* Description: This file contains the biquad coefficient designer. cos(w0)
+* and sin(w0) come from the circular CORDIC, the sinh of the bandwidth term and
+* the gain factor A = exp(gain * ln(10) / 40) from the hyperbolic CORDIC. The
+* formulas are evaluated in Q30 with 64-bit intermediates; one division per
+* stage normalizes by a0.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_biquad.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* One in Q30 and in Q27 */
+#define BIQUAD_ONE_Q30           (1LL << 30)
+#define BIQUAD_ONE_Q27           (1LL << 27)
+
+/* 2 * pi in Q27, ln(2) / 2 in Q31, ln(10) / 40 in Q31 */
+#define BIQUAD_TWO_PI_Q27        (843314857LL)
+#define BIQUAD_LN2_2_Q31         (744261118LL)
+#define BIQUAD_LN10_40_Q31       (123621027LL)
+
+/* Number of designs of the benchmark */
+#define BIQUAD_BENCH_DESIGNS     (32U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static bool     biquad_exp_parts(int64_t x_q27, int64_t *s, int64_t *c);
+static bool     biquad_stage(const cordic_biquad_spec_t *spec, int64_t *v);
+static uint32_t biquad_shift(const int64_t *v);
+static void     biquad_float(const cordic_biquad_spec_t *spec, float32_t *v);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark specifications and results */
+static cordic_biquad_spec_t biquad_bench_spec[BIQUAD_BENCH_DESIGNS];
+static q31_t                biquad_bench_coeffs[BIQUAD_BENCH_DESIGNS][CORDIC_BIQUAD_COEFFS];
+static int8_t               biquad_bench_shift[BIQUAD_BENCH_DESIGNS];
+static float32_t            biquad_bench_float[BIQUAD_BENCH_DESIGNS][CORDIC_BIQUAD_COEFFS];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: biquad_exp_parts
+********************************************************************************
+* Summary:
+* sinh and cosh of an argument up to 2 in magnitude. Arguments beyond 1 are
+* halved once for the peripheral and doubled back with sinh(2y) = 2 sinh(y)
+* cosh(y) and cosh(2y) = cosh(y)^2 + sinh(y)^2. exp(x) is their sum.
+*
+* Parameters:
+*  int64_t x_q27  Argument in Q27
+*  int64_t *s     Receives sinh in Q30
+*  int64_t *c     Receives cosh in Q30
+*
+* Return:
+*  bool           false when the argument is out of range
+*
+*******************************************************************************/
+static bool biquad_exp_parts(int64_t x_q27, int64_t *s, int64_t *c)
+{
+    bool            valid = (x_q27 <= (2 * BIQUAD_ONE_Q27)) && (x_q27 >= (-2 * BIQUAD_ONE_Q27));
+    bool            halve = (x_q27 > BIQUAD_ONE_Q27) || (x_q27 < -BIQUAD_ONE_Q27);
+    CY_CORDIC_Q31_t angle = (CY_CORDIC_Q31_t)((x_q27 * CORDIC_ANGLE_PER_RAD) >> (halve ? 28U : 27U));
+    int64_t         sinh  = 0;
+
+    if (valid)
+    {
+        CORDIC_TRACE(CORDIC_TRACE_OP_SINH, 1U, angle, 0, 0);
+        sinh = Cy_CORDIC_Sinh(MXCORDIC, angle);
+        CORDIC_TRACE(CORDIC_TRACE_OP_COSH, 1U, angle, 0, 0);
+        *c   = Cy_CORDIC_Cosh(MXCORDIC, angle);
+        *s   = sinh;
+
+        if (halve)
+        {
+            *s = (sinh * *c) >> 29;
+            *c = ((*c * *c) + (sinh * sinh)) >> 30;
+        }
+    }
+
+    return valid;
+}
+
+/*******************************************************************************
+* Function Name: biquad_stage
+********************************************************************************
+* Summary:
+* Designs one stage with the RBJ cookbook formulas and normalizes it by a0.
+* The feedback coefficients are negated for the CMSIS-DSP convention
+* y = b0 x[n] + b1 x[n-1] + b2 x[n-2] + a1 y[n-1] + a2 y[n-2].
+*
+* Parameters:
+*  const cordic_biquad_spec_t *spec  Stage specification
+*  int64_t *v                        Receives b0, b1, b2, a1, a2 in Q30
+*
+* Return:
+*  bool  false when the specification is out of range
+*
+*******************************************************************************/
+static bool biquad_stage(const cordic_biquad_spec_t *spec, int64_t *v)
+{
+    uint32_t        theta  = (uint32_t)spec->frequency << 1;
+    int32_t         negate = 0;
+    int64_t         sin_w  = 0;
+    int64_t         cos_w  = 0;
+    int64_t         w0     = 0;
+    int64_t         x      = 0;
+    int64_t         ratio  = 0;
+    int64_t         sinh   = 0;
+    int64_t         cosh   = 0;
+    int64_t         alpha  = 0;
+    int64_t         a      = BIQUAD_ONE_Q30;
+    int64_t         a0     = 0;
+    int64_t         a2     = 0;
+    int64_t         recip  = 0;
+    uint32_t        i      = 0;
+    bool            valid  = (spec->frequency > 0) && (spec->frequency < (q31_t)(1L << 30)) &&
+                             (spec->type <= CORDIC_BIQUAD_PEAKING);
+
+    if (valid)
+    {
+        /* w0 in (0, pi); sin(pi - w) = sin(w), cos(pi - w) = -cos(w) */
+        negate = (theta > CORDIC_ANGLE_PI_2) ? -1 : 0;
+        theta  = (0 != negate) ? (CORDIC_ANGLE_PI - theta) : theta;
+        CORDIC_TRACE(CORDIC_TRACE_OP_SIN, 1U, (int32_t)theta, 0, 0);
+        sin_w  = Cy_CORDIC_Sin(MXCORDIC, (CY_CORDIC_Q31_t)theta);
+        CORDIC_TRACE(CORDIC_TRACE_OP_COS, 1U, (int32_t)theta, 0, 0);
+        cos_w  = (Cy_CORDIC_Cos(MXCORDIC, (CY_CORDIC_Q31_t)theta) >> 1) * (1 | negate);
+        valid  = (0 < sin_w);
+    }
+
+    if (valid)
+    {
+        /* alpha = sin(w0) * sinh(ln(2) / 2 * bandwidth * w0 / sin(w0)) */
+        w0    = ((int64_t)spec->frequency * BIQUAD_TWO_PI_Q27) >> 31;
+        x     = (BIQUAD_LN2_2_Q31 * spec->bandwidth) >> 31;
+        ratio = (w0 << 31) / sin_w;
+
+        /* w0 / sin(w0) grows without bound near Nyquist; reject the product
+         * before it overflows */
+        valid = (0 == x) || (ratio <= (INT64_MAX / ((x < 0) ? -x : x)));
+    }
+
+    if (valid)
+    {
+        valid = biquad_exp_parts((x * ratio) >> 27, &sinh, &cosh);
+        alpha = (sin_w * sinh) >> 31;
+    }
+
+    if (valid && (CORDIC_BIQUAD_PEAKING == spec->type))
+    {
+        /* A = 10^(gain / 40) = exp(gain * ln(10) / 40) */
+        valid = biquad_exp_parts(((int64_t)spec->gain * BIQUAD_LN10_40_Q31) >> 28, &sinh, &cosh);
+        a     = sinh + cosh;
+    }
+
+    if (valid)
+    {
+        a0   = BIQUAD_ONE_Q30 + alpha;
+        a2   = BIQUAD_ONE_Q30 - alpha;
+        v[1] = -2 * cos_w;
+
+        switch (spec->type)
+        {
+            case CORDIC_BIQUAD_LOWPASS:
+                v[0] = (BIQUAD_ONE_Q30 - cos_w) >> 1;
+                v[1] = BIQUAD_ONE_Q30 - cos_w;
+                v[2] = v[0];
+                break;
+            case CORDIC_BIQUAD_HIGHPASS:
+                v[0] = (BIQUAD_ONE_Q30 + cos_w) >> 1;
+                v[1] = -(BIQUAD_ONE_Q30 + cos_w);
+                v[2] = v[0];
+                break;
+            case CORDIC_BIQUAD_BANDPASS:
+                v[0] = alpha;
+                v[1] = 0;
+                v[2] = -alpha;
+                break;
+            case CORDIC_BIQUAD_NOTCH:
+                v[0] = BIQUAD_ONE_Q30;
+                v[2] = BIQUAD_ONE_Q30;
+                break;
+            case CORDIC_BIQUAD_ALLPASS:
+                v[0] = BIQUAD_ONE_Q30 - alpha;
+                v[2] = BIQUAD_ONE_Q30 + alpha;
+                break;
+            default:
+                v[0] = BIQUAD_ONE_Q30 + ((alpha * a) >> 30);
+                v[2] = BIQUAD_ONE_Q30 - ((alpha * a) >> 30);
+                a0   = BIQUAD_ONE_Q30 + ((alpha << 30) / a);
+                a2   = BIQUAD_ONE_Q30 - ((alpha << 30) / a);
+                break;
+        }
+
+        v[3] = 2 * cos_w;
+        v[4] = -a2;
+
+        recip = ((int64_t)1 << 60) / a0;
+        for (i = 0U; i < CORDIC_BIQUAD_COEFFS; i++)
+        {
+            v[i] = ((v[i] * recip) + (1LL << 29)) >> 30;
+        }
+    }
+
+    return valid;
+}
+
+/*******************************************************************************
+* Function Name: biquad_shift
+********************************************************************************
+* Summary:
+* Smallest post shift for which all coefficients of a stage fit into Q31.
+*
+* Parameters:
+*  const int64_t *v  b0, b1, b2, a1, a2 in Q30
+*
+* Return:
+*  uint32_t          Post shift
+*
+*******************************************************************************/
+static uint32_t biquad_shift(const int64_t *v)
+{
+    int64_t  max   = 0;
+    uint32_t shift = 0;
+    uint32_t i     = 0;
+
+    for (i = 0U; i < CORDIC_BIQUAD_COEFFS; i++)
+    {
+        max = ((v[i] > max) || (-v[i] > max)) ? ((v[i] < 0) ? -v[i] : v[i]) : max;
+    }
+
+    while (max >= (BIQUAD_ONE_Q30 << shift))
+    {
+        shift++;
+    }
+
+    return shift;
+}
+
+/*******************************************************************************
+* Function Name: cordic_biquad_design
+********************************************************************************
+* Summary:
+* Designs a cascade of biquads. arm_biquad_cascade_df1_q31 applies one post
+* shift to all stages, so the stages are designed first and then scaled with
+* the largest shift any of them needs.
+*
+* Parameters:
+*  const cordic_biquad_spec_t *spec  Stage specifications
+*  uint32_t stages                   Number of stages, 1 to CORDIC_BIQUAD_MAX_STAGES
+*  q31_t *coeffs                     Receives CORDIC_BIQUAD_COEFFS coefficients per stage
+*  int8_t *post_shift                Receives the post shift of the cascade
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for NULL pointers, a stage count
+*                         out of range or a specification out of range
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_biquad_design(const cordic_biquad_spec_t *spec,
+                                           uint32_t stages,
+                                           q31_t *coeffs,
+                                           int8_t *post_shift)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    int64_t  v[CORDIC_BIQUAD_MAX_STAGES][CORDIC_BIQUAD_COEFFS];
+    uint32_t shift = 0;
+    uint32_t stage = 0;
+    uint32_t i     = 0;
+    bool     valid = (NULL != spec) && (NULL != coeffs) && (NULL != post_shift) &&
+                     (0U < stages) && (stages <= CORDIC_BIQUAD_MAX_STAGES);
+
+    for (stage = 0U; valid && (stage < stages); stage++)
+    {
+        valid = biquad_stage(&spec[stage], v[stage]);
+        if (valid)
+        {
+            i     = biquad_shift(v[stage]);
+            shift = (i > shift) ? i : shift;
+        }
+    }
+
+    if (valid)
+    {
+        /* Q30 to Q31 scaled by 2^-shift */
+        for (stage = 0U; stage < stages; stage++)
+        {
+            for (i = 0U; i < CORDIC_BIQUAD_COEFFS; i++)
+            {
+                coeffs[(stage * CORDIC_BIQUAD_COEFFS) + i] = (0U == shift) ? (q31_t)(v[stage][i] * 2) :
+                    (q31_t)((v[stage][i] + ((1LL << (shift - 1U)) >> 1)) >> (shift - 1U));
+            }
+        }
+
+        *post_shift = (int8_t)shift;
+        status      = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: biquad_float
+********************************************************************************
+* Summary:
+* Floating-point reference design with sinf(), cosf(), sinhf() and powf().
+*
+* Parameters:
+*  const cordic_biquad_spec_t *spec  Stage specification
+*  float32_t *v                      Receives b0, b1, b2, a1, a2, CMSIS-DSP signs
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void biquad_float(const cordic_biquad_spec_t *spec, float32_t *v)
+{
+    float32_t w0    = 2.0f * PI * ((float32_t)spec->frequency / 2147483648.0f);
+    float32_t sin_w = sinf(w0);
+    float32_t cos_w = cosf(w0);
+    float32_t alpha = sin_w * sinhf(0.34657359f * ((float32_t)spec->bandwidth / 134217728.0f) * w0 / sin_w);
+    float32_t a     = powf(10.0f, ((float32_t)spec->gain / 16777216.0f) / 40.0f);
+    float32_t a0    = 1.0f + alpha;
+    float32_t a2    = 1.0f - alpha;
+    uint32_t  i     = 0;
+
+    v[1] = -2.0f * cos_w;
+    switch (spec->type)
+    {
+        case CORDIC_BIQUAD_LOWPASS:
+            v[0] = (1.0f - cos_w) * 0.5f;
+            v[1] = 1.0f - cos_w;
+            v[2] = v[0];
+            break;
+        case CORDIC_BIQUAD_HIGHPASS:
+            v[0] = (1.0f + cos_w) * 0.5f;
+            v[1] = -(1.0f + cos_w);
+            v[2] = v[0];
+            break;
+        case CORDIC_BIQUAD_BANDPASS:
+            v[0] = alpha;
+            v[1] = 0.0f;
+            v[2] = -alpha;
+            break;
+        case CORDIC_BIQUAD_NOTCH:
+            v[0] = 1.0f;
+            v[2] = 1.0f;
+            break;
+        case CORDIC_BIQUAD_ALLPASS:
+            v[0] = 1.0f - alpha;
+            v[2] = 1.0f + alpha;
+            break;
+        default:
+            v[0] = 1.0f + (alpha * a);
+            v[2] = 1.0f - (alpha * a);
+            a0   = 1.0f + (alpha / a);
+            a2   = 1.0f - (alpha / a);
+            break;
+    }
+    v[3] = 2.0f * cos_w;
+    v[4] = -a2;
+
+    for (i = 0U; i < CORDIC_BIQUAD_COEFFS; i++)
+    {
+        v[i] /= a0;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_biquad_benchmark
+********************************************************************************
+* Summary:
+* Designs a set of single-stage filters of all types with the CORDIC and with
+* the floating-point reference and prints the designs per second of both and
+* the maximum coefficient deviation.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_biquad_benchmark(void)
+{
+    uint32_t  seed    = 0xC2B2AE35UL;
+    uint32_t  start   = 0;
+    uint32_t  cordic  = 0;
+    uint32_t  library = 0;
+    float32_t error   = 0.0f;
+    float32_t scale   = 0.0f;
+    uint32_t  d       = 0;
+    uint32_t  i       = 0;
+    bool      valid   = true;
+
+    /* Frequencies 0.005 to 0.45 of the sample rate, 0.2 to 1.2 octaves, +/-16 dB */
+    for (d = 0U; d < BIQUAD_BENCH_DESIGNS; d++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        biquad_bench_spec[d].type      = (cordic_biquad_type_t)(d % 6U);
+        biquad_bench_spec[d].frequency = (q31_t)(10737418L + (int32_t)((seed >> 8) * 57U));
+        seed = (seed * 1664525UL) + 1013904223UL;
+        biquad_bench_spec[d].bandwidth = (q31_t)(26843546L + (int32_t)(seed >> 5));
+        seed = (seed * 1664525UL) + 1013904223UL;
+        biquad_bench_spec[d].gain      = (q31_t)((int32_t)(seed >> 3) - (int32_t)(1L << 28));
+    }
+
+    start  = cordic_benchmark_get_cycles();
+    for (d = 0U; d < BIQUAD_BENCH_DESIGNS; d++)
+    {
+        valid = (CY_CORDIC_SUCCESS == cordic_biquad_design(&biquad_bench_spec[d], 1U,
+                                                           biquad_bench_coeffs[d], &biquad_bench_shift[d])) && valid;
+    }
+    cordic = cordic_benchmark_get_cycles() - start;
+
+    start   = cordic_benchmark_get_cycles();
+    for (d = 0U; d < BIQUAD_BENCH_DESIGNS; d++)
+    {
+        biquad_float(&biquad_bench_spec[d], biquad_bench_float[d]);
+    }
+    library = cordic_benchmark_get_cycles() - start;
+
+    for (d = 0U; d < BIQUAD_BENCH_DESIGNS; d++)
+    {
+        scale = (float32_t)(1UL << (uint32_t)biquad_bench_shift[d]) / 2147483648.0f;
+        for (i = 0U; i < CORDIC_BIQUAD_COEFFS; i++)
+        {
+            error = fmaxf(error, fabsf(((float32_t)biquad_bench_coeffs[d][i] * scale) - biquad_bench_float[d][i]));
+        }
+    }
+
+    cordic  = (0U != cordic) ? cordic : 1U;
+    library = (0U != library) ? library : 1U;
+
+    printf("\r\n%u single-stage designs, all types\r\n", (unsigned int)BIQUAD_BENCH_DESIGNS);
+    printf("CORDIC fixed point : %6u cycles/design, %u designs/s\r\n",
+           (unsigned int)(cordic / BIQUAD_BENCH_DESIGNS),
+           (unsigned int)(((uint64_t)SystemCoreClock * BIQUAD_BENCH_DESIGNS) / cordic));
+    printf("float math library : %6u cycles/design, %u designs/s\r\n",
+           (unsigned int)(library / BIQUAD_BENCH_DESIGNS),
+           (unsigned int)(((uint64_t)SystemCoreClock * BIQUAD_BENCH_DESIGNS) / library));
+    printf("Maximum coefficient deviation: %.2e%s\r\n", (double)error,
+           valid ? "" : ", some designs were rejected");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,97 @@
+/*******************************************************************************
+* File Name:   cordic_biquad.h
+*
+* Description: This header file contains the interface to the biquad
+* coefficient designer. It evaluates the RBJ audio EQ cookbook formulas in fixed
+* point with the CORDIC and writes coefficients for the CMSIS-DSP
+* arm_biquad_cascade_df1_q31 filter.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_BIQUAD_H
+#define CORDIC_BIQUAD_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "arm_math.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of coefficients per stage: b0, b1, b2, a1, a2 */
+#define CORDIC_BIQUAD_COEFFS      (5U)
+
+/* Highest number of stages of one design call */
+#define CORDIC_BIQUAD_MAX_STAGES  (8U)
+
+/* Filter type of a stage */
+typedef enum
+{
+    CORDIC_BIQUAD_LOWPASS  = 0,
+    CORDIC_BIQUAD_HIGHPASS = 1,
+    CORDIC_BIQUAD_BANDPASS = 2,    /* Constant 0 dB peak gain */
+    CORDIC_BIQUAD_NOTCH    = 3,
+    CORDIC_BIQUAD_ALLPASS  = 4,
+    CORDIC_BIQUAD_PEAKING  = 5
+} cordic_biquad_type_t;
+
+/* Specification of one stage. The sinh argument of the bandwidth,
+ * ln(2) / 2 * bandwidth * w0 / sin(w0), and the peaking gain in dB times
+ * ln(10) / 40 must both stay within 2. Specifications whose sinh
+ * argument would overflow near Nyquist are rejected with CY_CORDIC_BAD_PARAM. */
+typedef struct
+{
+    cordic_biquad_type_t type;
+    q31_t frequency;     /* Centre or corner frequency over the sample rate, Q31 in (0, 0.5) */
+    q31_t bandwidth;     /* Bandwidth in octaves, Q27 */
+    q31_t gain;          /* Peaking gain in dB, Q24, ignored by the other types */
+} cordic_biquad_spec_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* coeffs receives CORDIC_BIQUAD_COEFFS values per stage, in the order and sign
+ * convention of arm_biquad_cascade_df1_q31 and scaled by 2^-post_shift. */
+cy_en_cordic_status_t cordic_biquad_design(const cordic_biquad_spec_t *spec,
+                                           uint32_t stages,
+                                           q31_t *coeffs,
+                                           int8_t *post_shift);
+void cordic_biquad_benchmark(void);
+
+#endif /*CORDIC_BIQUAD_H*/
+/* [] END OF FILE */
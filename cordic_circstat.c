@@ -0,0 +1,373 @@
+/*******************************************************************************
+* File Name:   cordic_circstat.c
+*
+* Description: This file contains the streaming circular statistics accumulator.
+* Blocks of angles are turned into unit vectors with batched CORDIC rotations
+* and summed. The result takes the angle of the sum with the vectoring
+* operation and its length with a Park transform by that angle.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_angle.h"
+#include "cordic_batch.h"
+#include "cordic_benchmark.h"
+#include "cordic_circstat.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Bits of the normalized sums, within the Q31 operands of the vectoring */
+#define CIRCSTAT_NORM_BITS        (30U)
+
+/* 2 / pi in Q31, from sqrt((1 - R) / 2) to the deviation as a binary angle */
+#define CIRCSTAT_TWO_BY_PI_Q31    (1367130551LL)
+
+/* Benchmark: block of angles, windows, mean angle, and spread */
+#define CIRCSTAT_BENCH_BLOCK      (1024U)
+#define CIRCSTAT_BENCH_WINDOWS    (4U)
+#define CIRCSTAT_BENCH_MEAN       (40.0f)
+#define CIRCSTAT_BENCH_SPREAD     (60.0f)
+#define CIRCSTAT_ANGLE_TO_DEG     (180.0f / 2147483648.0f)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void circstat_float(const float32_t *angle, uint32_t count, float32_t *sum_cos, float32_t *sum_sin);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Operands and results of cordic_batch_rotate() */
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t circstat_angle[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t circstat_unit[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t circstat_zero[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t circstat_cos[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t circstat_sin[CORDIC_BATCH_CHUNK];
+
+/* Benchmark block, fed repeatedly to fill a window */
+static CY_CORDIC_Q31_t circstat_bench_angle[CIRCSTAT_BENCH_BLOCK];
+static float32_t       circstat_bench_float[CIRCSTAT_BENCH_BLOCK];
+
+/* Window sizes of the benchmark */
+static const uint32_t circstat_bench_window[CIRCSTAT_BENCH_WINDOWS] = { 1024U, 4096U, 16384U, 65536U };
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_circstat_reset
+********************************************************************************
+* Summary:
+* Starts a new window.
+*
+* Parameters:
+*  cordic_circstat_t *stat  Accumulator
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when stat is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_circstat_reset(cordic_circstat_t *stat)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+
+    if (NULL != stat)
+    {
+        stat->sum_cos = 0;
+        stat->sum_sin = 0;
+        stat->count   = 0U;
+        status        = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_circstat_add
+********************************************************************************
+* Summary:
+* Adds the unit vectors of a block of angles to the sums, rotating (1, 0) by
+* each angle in batches of CORDIC_BATCH_CHUNK.
+*
+* Parameters:
+*  cordic_circstat_t *stat       Accumulator
+*  const CY_CORDIC_Q31_t *angle  Angles, Q31 binary angles
+*  uint32_t count                Number of angles
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_circstat_add(cordic_circstat_t *stat, const CY_CORDIC_Q31_t *angle,
+                                          uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    int64_t  sum_cos = 0;
+    int64_t  sum_sin = 0;
+    uint32_t start   = 0;
+    uint32_t chunk   = 0;
+    uint32_t i       = 0;
+
+    if ((NULL != stat) && (NULL != angle))
+    {
+        for (i = 0U; i < CORDIC_BATCH_CHUNK; i++)
+        {
+            circstat_unit[i] = INT32_MAX;
+        }
+
+        for (start = 0U; start < count; start += chunk)
+        {
+            chunk = ((count - start) < CORDIC_BATCH_CHUNK) ? (count - start) : CORDIC_BATCH_CHUNK;
+
+            for (i = 0U; i < chunk; i++)
+            {
+                circstat_angle[i] = angle[start + i];
+            }
+
+            (void)cordic_batch_rotate(circstat_angle, circstat_unit, circstat_zero,
+                                      circstat_cos, circstat_sin, chunk);
+
+            for (i = 0U; i < chunk; i++)
+            {
+                sum_cos += circstat_cos[i];
+                sum_sin += circstat_sin[i];
+            }
+        }
+
+        stat->sum_cos += sum_cos;
+        stat->sum_sin += sum_sin;
+        stat->count   += count;
+        status         = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_circstat_result
+********************************************************************************
+* Summary:
+* Statistics of the window. The sums are shifted until the larger one has
+* CIRCSTAT_NORM_BITS bits. cordic_angle_polar_start() and
+* cordic_angle_polar_result() give the mean angle and the length of the sum:
+*   R = |sum| / count,  variance = 1 - R,  deviation = sqrt(2 (1 - R))
+*
+* Parameters:
+*  const cordic_circstat_t *stat       Accumulator
+*  cordic_circstat_result_t *result    Statistics
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_circstat_result(const cordic_circstat_t *stat,
+                                             cordic_circstat_result_t *result)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint64_t largest = 0;
+    uint32_t high    = 0;
+    uint32_t bits    = 0;
+    int64_t  c       = 0;
+    int64_t  s       = 0;
+    uint32_t angle   = 0;
+    int64_t  length  = 0;
+    uint64_t r       = 0;
+
+    if ((NULL != stat) && (NULL != result))
+    {
+        c       = stat->sum_cos;
+        s       = stat->sum_sin;
+        largest = (uint64_t)((c < 0) ? -c : c) | (uint64_t)((s < 0) ? -s : s);
+        high    = (uint32_t)(largest >> 32);
+        bits    = (0ULL == largest) ? 0U :
+                  ((0U != high) ? (64U - __CLZ(high)) : (32U - __CLZ((uint32_t)largest)));
+
+        if ((0U != bits) && (0U != stat->count))
+        {
+            c = (bits > CIRCSTAT_NORM_BITS) ? (c >> (bits - CIRCSTAT_NORM_BITS)) : (c << (CIRCSTAT_NORM_BITS - bits));
+            s = (bits > CIRCSTAT_NORM_BITS) ? (s >> (bits - CIRCSTAT_NORM_BITS)) : (s << (CIRCSTAT_NORM_BITS - bits));
+
+            if (cordic_angle_polar_start((CY_CORDIC_Q31_t)c, (CY_CORDIC_Q31_t)s, &angle))
+            {
+                length = cordic_angle_polar_result();
+            }
+
+            /* Undo the normalization: R in Q31 = |sum| / count */
+            r = (bits > CIRCSTAT_NORM_BITS) ?
+                (((uint64_t)length << (bits - CIRCSTAT_NORM_BITS)) / stat->count) :
+                ((uint64_t)length / ((uint64_t)stat->count << (CIRCSTAT_NORM_BITS - bits)));
+            r = (r > (uint64_t)INT32_MAX) ? (uint64_t)INT32_MAX : r;
+        }
+
+        result->mean      = (CY_CORDIC_Q31_t)angle;
+        result->coherence = (CY_CORDIC_Q31_t)r;
+        result->variance  = INT32_MAX - (CY_CORDIC_Q31_t)r;
+        CORDIC_TRACE(CORDIC_TRACE_OP_SQRT, 1U, result->variance >> 1, 0, 0);
+        result->deviation = (CY_CORDIC_Q31_t)(((int64_t)Cy_CORDIC_Sqrt(MXCORDIC, result->variance >> 1) *
+                                               CIRCSTAT_TWO_BY_PI_Q31) >> 31);
+        result->count     = stat->count;
+        status            = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: circstat_float
+********************************************************************************
+* Summary:
+* Floating-point reference accumulation with sinf() and cosf().
+*
+* Parameters:
+*  const float32_t *angle  Angles in radians
+*  uint32_t count          Number of angles
+*  float32_t *sum_cos      Sum of the cosines
+*  float32_t *sum_sin      Sum of the sines
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void circstat_float(const float32_t *angle, uint32_t count, float32_t *sum_cos, float32_t *sum_sin)
+{
+    uint32_t i = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        *sum_cos += cosf(angle[i]);
+        *sum_sin += sinf(angle[i]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_circstat_benchmark
+********************************************************************************
+* Summary:
+* Accumulates windows of 1k to 64k angles around a mean of 40 degrees, fed as
+* repeated blocks of CIRCSTAT_BENCH_BLOCK angles, with the CORDIC and with the
+* floating-point reference with atan2f() and sqrtf() for the result. Prints
+* the throughput and the differences of the mean angle and the coherence.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_circstat_benchmark(void)
+{
+    cordic_circstat_t        stat;
+    cordic_circstat_result_t result;
+    float32_t  sum_cos   = 0.0f;
+    float32_t  sum_sin   = 0.0f;
+    float32_t  mean      = 0.0f;
+    float32_t  coherence = 0.0f;
+    float32_t  noise     = 0.0f;
+    uint32_t   seed      = 1U;
+    uint32_t   start     = 0;
+    uint32_t   cordic    = 0;
+    uint32_t   library   = 0;
+    uint32_t   window    = 0;
+    uint32_t   done      = 0;
+    uint32_t   i         = 0;
+    uint32_t   j         = 0;
+
+    /* Spread as the sum of three uniform variables */
+    for (i = 0U; i < CIRCSTAT_BENCH_BLOCK; i++)
+    {
+        noise = 0.0f;
+        for (j = 0U; j < 3U; j++)
+        {
+            seed   = (seed * 1664525U) + 1013904223U;
+            noise += ((float32_t)(seed >> 8) / 16777216.0f) - 0.5f;
+        }
+        circstat_bench_float[i] = (CIRCSTAT_BENCH_MEAN + (CIRCSTAT_BENCH_SPREAD * noise)) * (PI / 180.0f);
+        circstat_bench_angle[i] = (CY_CORDIC_Q31_t)lroundf((CIRCSTAT_BENCH_MEAN + (CIRCSTAT_BENCH_SPREAD * noise)) *
+                                                           (2147483648.0f / 180.0f));
+    }
+
+    printf("\r\nWindow | CORDIC samples/s | float samples/s | mean angle diff (deg) | coherence diff\r\n");
+    for (i = 0U; i < CIRCSTAT_BENCH_WINDOWS; i++)
+    {
+        window = circstat_bench_window[i];
+
+        start = cordic_benchmark_get_cycles();
+        (void)cordic_circstat_reset(&stat);
+        for (done = 0U; done < window; done += CIRCSTAT_BENCH_BLOCK)
+        {
+            (void)cordic_circstat_add(&stat, circstat_bench_angle, CIRCSTAT_BENCH_BLOCK);
+        }
+        (void)cordic_circstat_result(&stat, &result);
+        cordic = cordic_benchmark_get_cycles() - start;
+
+        start   = cordic_benchmark_get_cycles();
+        sum_cos = 0.0f;
+        sum_sin = 0.0f;
+        for (done = 0U; done < window; done += CIRCSTAT_BENCH_BLOCK)
+        {
+            circstat_float(circstat_bench_float, CIRCSTAT_BENCH_BLOCK, &sum_cos, &sum_sin);
+        }
+        mean      = atan2f(sum_sin, sum_cos);
+        coherence = sqrtf((sum_cos * sum_cos) + (sum_sin * sum_sin)) / (float32_t)window;
+        library   = cordic_benchmark_get_cycles() - start;
+
+        cordic  = (0U != cordic) ? cordic : 1U;
+        library = (0U != library) ? library : 1U;
+
+        printf("%6u | %16u | %15u | %21.5f | %.2e\r\n", (unsigned int)window,
+               (unsigned int)(((uint64_t)SystemCoreClock * window) / cordic),
+               (unsigned int)(((uint64_t)SystemCoreClock * window) / library),
+               (double)fabsf(((float32_t)result.mean * CIRCSTAT_ANGLE_TO_DEG) - (mean * (180.0f / PI))),
+               (double)fabsf(((float32_t)result.coherence / 2147483648.0f) - coherence));
+    }
+    printf("Coherence %.4f, circular variance %.4f, angular deviation %.2f deg\r\n",
+           (double)((float32_t)result.coherence / 2147483648.0f), (double)((float32_t)result.variance / 2147483648.0f),
+           (double)((float32_t)result.deviation * CIRCSTAT_ANGLE_TO_DEG));
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* File Name:   cordic_circstat.h
+*
+* Description: This header file contains the interface to the streaming circular
+* statistics accumulator: mean angle, phase coherence, circular variance, and
+* angular deviation of a window of angles.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_CIRCSTAT_H
+#define CORDIC_CIRCSTAT_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Sum of the unit vectors of the angles added since the last reset */
+typedef struct
+{
+    int64_t  sum_cos;     /* Sum of the cosines, Q31 */
+    int64_t  sum_sin;     /* Sum of the sines, Q31 */
+    uint32_t count;       /* Number of angles */
+} cordic_circstat_t;
+
+/* Statistics of a window. The mean angle is 0 when the resultant is 0. */
+typedef struct
+{
+    CY_CORDIC_Q31_t mean;        /* Mean angle, Q31 binary angle */
+    CY_CORDIC_Q31_t coherence;   /* Mean resultant length R in [0, 1], Q31 */
+    CY_CORDIC_Q31_t variance;    /* Circular variance 1 - R, Q31 */
+    CY_CORDIC_Q31_t deviation;   /* Angular deviation sqrt(2 (1 - R)), Q31 binary angle */
+    uint32_t        count;       /* Number of angles */
+} cordic_circstat_result_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_en_cordic_status_t cordic_circstat_reset(cordic_circstat_t *stat);
+/* angle holds Q31 binary angles. The accumulator takes up to 2^32 - 1 angles. */
+cy_en_cordic_status_t cordic_circstat_add(cordic_circstat_t *stat, const CY_CORDIC_Q31_t *angle,
+                                          uint32_t count);
+cy_en_cordic_status_t cordic_circstat_result(const cordic_circstat_t *stat,
+                                             cordic_circstat_result_t *result);
+void cordic_circstat_benchmark(void);
+
+#endif /*CORDIC_CIRCSTAT_H*/
+/* [] END OF FILE */
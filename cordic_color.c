@@ -0,0 +1,573 @@
+/*******************************************************************************
+* File Name:   cordic_color.c
+*
+* Description: This file contains the color conversion module. RGB is
+* split into the intensity and the chroma plane, alpha = R - (G + B) / 2 and
+* beta = sqrt(3) / 2 (G - B). The hue is the angle of the chroma vector from
+* the vectoring operation and the chroma its length from cordic_batch_park();
+* the way back and the hue rotation are cordic_batch_rotate() calls. All
+* operations run in chunks of CORDIC_BATCH_CHUNK pixels.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_batch.h"
+#include "cordic_color.h"
+#include "cordic_placement.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Fraction bits of the chroma components, 8-bit channels in Q22 */
+#define COLOR_SHIFT              (22U)
+
+/* sqrt(3) / 2, 1 / sqrt(3), and 1 / 3 in Q31 */
+#define COLOR_SQRT3_2_Q31        (1859775393LL)
+#define COLOR_INV_SQRT3_Q31      (1239850262LL)
+#define COLOR_ONE_THIRD_Q31      (715827883LL)
+
+/* Shift from 16-bit hues to Q31 binary angles */
+#define COLOR_HUE_SHIFT          (16U)
+
+/* Hue sector of the integer reference, 65536 / 6 */
+#define COLOR_SECTOR             (10923L)
+
+/* Number of LEDs of the benchmark */
+#define COLOR_BENCH_COUNT        (512U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void    color_chroma(const cordic_color_rgb_t *rgb, CY_CORDIC_Q31_t *alpha, CY_CORDIC_Q31_t *beta);
+static void    color_from_chroma(int64_t alpha, int64_t beta, int64_t base, bool from_value,
+                                 cordic_color_rgb_t *rgb);
+static uint8_t color_channel(int64_t value);
+static void    color_sector_to_hsv(const cordic_color_rgb_t *rgb, cordic_color_hsv_t *hsv);
+static void    color_sector_to_rgb(const cordic_color_hsv_t *hsv, cordic_color_rgb_t *rgb);
+static uint32_t color_roundtrip_error(void);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Operands and results of the batch calls */
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t color_angle[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t color_alpha[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t color_beta[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t color_out_alpha[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t color_out_beta[CORDIC_BATCH_CHUNK];
+
+/* Benchmark LEDs */
+static cordic_color_rgb_t color_bench_rgb[COLOR_BENCH_COUNT];
+static cordic_color_rgb_t color_bench_out[COLOR_BENCH_COUNT];
+static cordic_color_hsv_t color_bench_hsv[COLOR_BENCH_COUNT];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: color_chroma
+********************************************************************************
+* Summary:
+* Chroma plane components of a pixel.
+*
+* Parameters:
+*  const cordic_color_rgb_t *rgb  Pixel
+*  CY_CORDIC_Q31_t *alpha         Receives R - (G + B) / 2 in Q22
+*  CY_CORDIC_Q31_t *beta          Receives sqrt(3) / 2 (G - B) in Q22
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void color_chroma(const cordic_color_rgb_t *rgb, CY_CORDIC_Q31_t *alpha, CY_CORDIC_Q31_t *beta)
+{
+    *alpha = ((2 * (int32_t)rgb->r) - (int32_t)rgb->g - (int32_t)rgb->b) << (COLOR_SHIFT - 1U);
+    *beta  = (CY_CORDIC_Q31_t)(((((int64_t)rgb->g - rgb->b) << COLOR_SHIFT) * COLOR_SQRT3_2_Q31) >> 31);
+}
+
+/*******************************************************************************
+* Function Name: color_channel
+********************************************************************************
+* Summary:
+* Rounds a Q22 channel value and clips it to 0 to 255.
+*
+* Parameters:
+*  int64_t value  Channel in Q22
+*
+* Return:
+*  uint8_t        Channel
+*
+*******************************************************************************/
+static uint8_t color_channel(int64_t value)
+{
+    value = (value + (1LL << (COLOR_SHIFT - 1U))) >> COLOR_SHIFT;
+
+    return (uint8_t)((value > 255) ? 255 : ((value < 0) ? 0 : value));
+}
+
+/*******************************************************************************
+* Function Name: color_from_chroma
+********************************************************************************
+* Summary:
+* Pixel from its chroma components: R = m + 2 alpha / 3,
+* G = m - alpha / 3 + beta / sqrt(3), B = m - alpha / 3 - beta / sqrt(3). The
+* base m is either the intensity or, for a given value, the value minus the
+* largest of the three chroma offsets.
+*
+* Parameters:
+*  int64_t alpha            Chroma component in Q22
+*  int64_t beta             Chroma component in Q22
+*  int64_t base             Intensity or value in Q22
+*  bool from_value          true when base is the value
+*  cordic_color_rgb_t *rgb  Receives the pixel
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void color_from_chroma(int64_t alpha, int64_t beta, int64_t base, bool from_value,
+                              cordic_color_rgb_t *rgb)
+{
+    int64_t third = (alpha * COLOR_ONE_THIRD_Q31) >> 31;
+    int64_t cross = (beta * COLOR_INV_SQRT3_Q31) >> 31;
+    int64_t r     = 2 * third;
+    int64_t g     = cross - third;
+    int64_t b     = -cross - third;
+    int64_t top   = (r > g) ? r : g;
+
+    top  = (top > b) ? top : b;
+    base = from_value ? (base - top) : base;
+
+    rgb->r = color_channel(base + r);
+    rgb->g = color_channel(base + g);
+    rgb->b = color_channel(base + b);
+}
+
+/*******************************************************************************
+* Function Name: cordic_color_rgb_to_hsv
+********************************************************************************
+* Summary:
+* Converts pixels to hue, saturation, and value. The value is the largest
+* channel, the saturation the chroma radius over the value.
+*
+* Parameters:
+*  const cordic_color_rgb_t *rgb  Pixels
+*  cordic_color_hsv_t *hsv        Receives the converted pixels
+*  uint32_t count                 Number of pixels
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_color_rgb_to_hsv(const cordic_color_rgb_t *rgb,
+                                              cordic_color_hsv_t *hsv,
+                                              uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t value = 0;
+    uint32_t sat   = 0;
+    uint32_t start = 0;
+    uint32_t chunk = 0;
+    uint32_t i     = 0;
+
+    if ((NULL != rgb) && (NULL != hsv))
+    {
+        for (start = 0U; start < count; start += chunk)
+        {
+            chunk = ((count - start) < CORDIC_BATCH_CHUNK) ? (count - start) : CORDIC_BATCH_CHUNK;
+
+            for (i = 0U; i < chunk; i++)
+            {
+                color_chroma(&rgb[start + i], &color_alpha[i], &color_beta[i]);
+
+                /* Grey pixels have no hue. The chroma components stay below
+                 * 2^30, so doubling them fills the Q31 operands. */
+                color_angle[i] = (CY_CORDIC_Q31_t)cordic_angle_vector(color_alpha[i] * 2, color_beta[i] * 2, 0U);
+            }
+
+            /* Chroma radius: the d component of the rotation by minus the hue */
+            (void)cordic_batch_park(color_angle, color_alpha, color_beta,
+                                    color_out_alpha, color_out_beta, chunk);
+
+            for (i = 0U; i < chunk; i++)
+            {
+                value = rgb[start + i].r;
+                value = (rgb[start + i].g > value) ? rgb[start + i].g : value;
+                value = (rgb[start + i].b > value) ? rgb[start + i].b : value;
+                sat   = (0U != value) ?
+                        (uint32_t)((((uint64_t)(uint32_t)color_out_alpha[i] * 255U) + ((uint64_t)value << (COLOR_SHIFT - 1U))) /
+                                   ((uint64_t)value << COLOR_SHIFT)) : 0U;
+
+                hsv[start + i].hue        = (uint16_t)(((uint32_t)color_angle[i] + (1UL << (COLOR_HUE_SHIFT - 1U))) >> COLOR_HUE_SHIFT);
+                hsv[start + i].saturation = (uint8_t)((sat > 255U) ? 255U : sat);
+                hsv[start + i].value      = (uint8_t)value;
+            }
+        }
+
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_color_hsv_to_rgb
+********************************************************************************
+* Summary:
+* Converts hue, saturation, and value to pixels by rotating the chroma radius
+* to the hue.
+*
+* Parameters:
+*  const cordic_color_hsv_t *hsv  Pixels
+*  cordic_color_rgb_t *rgb        Receives the converted pixels
+*  uint32_t count                 Number of pixels
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_color_hsv_to_rgb(const cordic_color_hsv_t *hsv,
+                                              cordic_color_rgb_t *rgb,
+                                              uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t start = 0;
+    uint32_t chunk = 0;
+    uint32_t i     = 0;
+
+    if ((NULL != hsv) && (NULL != rgb))
+    {
+        for (start = 0U; start < count; start += chunk)
+        {
+            chunk = ((count - start) < CORDIC_BATCH_CHUNK) ? (count - start) : CORDIC_BATCH_CHUNK;
+
+            for (i = 0U; i < chunk; i++)
+            {
+                color_angle[i] = (CY_CORDIC_Q31_t)((uint32_t)hsv[start + i].hue << COLOR_HUE_SHIFT);
+                color_alpha[i] = (CY_CORDIC_Q31_t)((((uint64_t)hsv[start + i].saturation * hsv[start + i].value)
+                                                    << COLOR_SHIFT) / 255U);
+                color_beta[i]  = 0;
+            }
+
+            (void)cordic_batch_rotate(color_angle, color_alpha, color_beta,
+                                      color_out_alpha, color_out_beta, chunk);
+
+            for (i = 0U; i < chunk; i++)
+            {
+                color_from_chroma(color_out_alpha[i], color_out_beta[i],
+                                  (int64_t)hsv[start + i].value << COLOR_SHIFT, true, &rgb[start + i]);
+            }
+        }
+
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_color_rotate_hue
+********************************************************************************
+* Summary:
+* Shifts the hue of pixels without converting them to HSV. The chroma vector
+* is rotated and the intensity (R + G + B) / 3 is kept, so the brightness stays
+* constant through a hue animation. Channels that leave the range are clipped.
+*
+* Parameters:
+*  const cordic_color_rgb_t *in  Pixels
+*  cordic_color_rgb_t *out       Receives the shifted pixels, may equal in
+*  uint32_t count                Number of pixels
+*  uint16_t hue_shift            Hue shift, 65536 = 360 degrees
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_color_rotate_hue(const cordic_color_rgb_t *in,
+                                              cordic_color_rgb_t *out,
+                                              uint32_t count,
+                                              uint16_t hue_shift)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    int64_t  intensity = 0;
+    uint32_t start     = 0;
+    uint32_t chunk     = 0;
+    uint32_t i         = 0;
+
+    if ((NULL != in) && (NULL != out))
+    {
+        for (i = 0U; i < CORDIC_BATCH_CHUNK; i++)
+        {
+            color_angle[i] = (CY_CORDIC_Q31_t)((uint32_t)hue_shift << COLOR_HUE_SHIFT);
+        }
+
+        for (start = 0U; start < count; start += chunk)
+        {
+            chunk = ((count - start) < CORDIC_BATCH_CHUNK) ? (count - start) : CORDIC_BATCH_CHUNK;
+
+            for (i = 0U; i < chunk; i++)
+            {
+                color_chroma(&in[start + i], &color_alpha[i], &color_beta[i]);
+            }
+
+            (void)cordic_batch_rotate(color_angle, color_alpha, color_beta,
+                                      color_out_alpha, color_out_beta, chunk);
+
+            for (i = 0U; i < chunk; i++)
+            {
+                intensity = ((((int64_t)in[start + i].r + in[start + i].g + in[start + i].b) << COLOR_SHIFT) *
+                             COLOR_ONE_THIRD_Q31) >> 31;
+                color_from_chroma(color_out_alpha[i], color_out_beta[i], intensity, false, &out[start + i]);
+            }
+        }
+
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: color_sector_to_hsv
+********************************************************************************
+* Summary:
+* Integer sector-based RGB to HSV conversion, the usual software method.
+*
+* Parameters:
+*  const cordic_color_rgb_t *rgb  Pixel
+*  cordic_color_hsv_t *hsv        Receives the converted pixel
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void color_sector_to_hsv(const cordic_color_rgb_t *rgb, cordic_color_hsv_t *hsv)
+{
+    int32_t max   = rgb->r;
+    int32_t min   = rgb->r;
+    int32_t delta = 0;
+    int32_t hue   = 0;
+
+    max   = (rgb->g > max) ? rgb->g : max;
+    max   = (rgb->b > max) ? rgb->b : max;
+    min   = (rgb->g < min) ? rgb->g : min;
+    min   = (rgb->b < min) ? rgb->b : min;
+    delta = max - min;
+
+    if (0 != delta)
+    {
+        if (max == rgb->r)
+        {
+            hue = (COLOR_SECTOR * ((int32_t)rgb->g - rgb->b)) / delta;
+        }
+        else if (max == rgb->g)
+        {
+            hue = (2 * COLOR_SECTOR) + ((COLOR_SECTOR * ((int32_t)rgb->b - rgb->r)) / delta);
+        }
+        else
+        {
+            hue = (4 * COLOR_SECTOR) + ((COLOR_SECTOR * ((int32_t)rgb->r - rgb->g)) / delta);
+        }
+    }
+
+    hsv->hue        = (uint16_t)hue;
+    hsv->saturation = (uint8_t)((0 != max) ? (((255 * delta) + (max / 2)) / max) : 0);
+    hsv->value      = (uint8_t)max;
+}
+
+/*******************************************************************************
+* Function Name: color_sector_to_rgb
+********************************************************************************
+* Summary:
+* Integer sector-based HSV to RGB conversion, the usual software method.
+*
+* Parameters:
+*  const cordic_color_hsv_t *hsv  Pixel
+*  cordic_color_rgb_t *rgb        Receives the converted pixel
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void color_sector_to_rgb(const cordic_color_hsv_t *hsv, cordic_color_rgb_t *rgb)
+{
+    int32_t sector = hsv->hue / COLOR_SECTOR;
+    int32_t rest   = (((int32_t)hsv->hue - (sector * COLOR_SECTOR)) * 255) / COLOR_SECTOR;
+    int32_t v      = hsv->value;
+    int32_t s      = hsv->saturation;
+    uint8_t p      = (uint8_t)((v * (255 - s) + 127) / 255);
+    uint8_t q      = (uint8_t)((v * (65025 - (s * rest)) + 32512) / 65025);
+    uint8_t t      = (uint8_t)((v * (65025 - (s * (255 - rest))) + 32512) / 65025);
+
+    switch (sector)
+    {
+        case 0:  rgb->r = (uint8_t)v; rgb->g = t;          rgb->b = p;          break;
+        case 1:  rgb->r = q;          rgb->g = (uint8_t)v; rgb->b = p;          break;
+        case 2:  rgb->r = p;          rgb->g = (uint8_t)v; rgb->b = t;          break;
+        case 3:  rgb->r = p;          rgb->g = q;          rgb->b = (uint8_t)v; break;
+        case 4:  rgb->r = t;          rgb->g = p;          rgb->b = (uint8_t)v; break;
+        default: rgb->r = (uint8_t)v; rgb->g = p;          rgb->b = q;          break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: color_roundtrip_error
+********************************************************************************
+* Summary:
+* Largest channel difference between the benchmark LEDs and their round trip.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t  Largest difference in 8-bit steps
+*
+*******************************************************************************/
+static uint32_t color_roundtrip_error(void)
+{
+    uint32_t error = 0;
+    int32_t  d     = 0;
+    uint32_t i     = 0;
+
+    for (i = 0U; i < COLOR_BENCH_COUNT; i++)
+    {
+        d     = (int32_t)color_bench_rgb[i].r - color_bench_out[i].r;
+        error = ((uint32_t)((d < 0) ? -d : d) > error) ? (uint32_t)((d < 0) ? -d : d) : error;
+        d     = (int32_t)color_bench_rgb[i].g - color_bench_out[i].g;
+        error = ((uint32_t)((d < 0) ? -d : d) > error) ? (uint32_t)((d < 0) ? -d : d) : error;
+        d     = (int32_t)color_bench_rgb[i].b - color_bench_out[i].b;
+        error = ((uint32_t)((d < 0) ? -d : d) > error) ? (uint32_t)((d < 0) ? -d : d) : error;
+    }
+
+    return error;
+}
+
+/*******************************************************************************
+* Function Name: cordic_color_benchmark
+********************************************************************************
+* Summary:
+* Converts 512 LEDs of random colors to HSV and back, and shifts their hue,
+* with the CORDIC module and with the integer sector-based method, and prints
+* the conversions per second and the round-trip error.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_color_benchmark(void)
+{
+    uint32_t seed      = 0x6C078965UL;
+    uint32_t start     = 0;
+    uint32_t to_hsv[2] = { 0U, 0U };
+    uint32_t to_rgb[2] = { 0U, 0U };
+    uint32_t shift[2]  = { 0U, 0U };
+    uint32_t error[2]  = { 0U, 0U };
+    uint32_t m         = 0;
+    uint32_t i         = 0;
+
+    for (i = 0U; i < COLOR_BENCH_COUNT; i++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        color_bench_rgb[i].r = (uint8_t)(seed >> 24);
+        color_bench_rgb[i].g = (uint8_t)(seed >> 16);
+        color_bench_rgb[i].b = (uint8_t)(seed >> 8);
+    }
+
+    start     = cordic_benchmark_get_cycles();
+    (void)cordic_color_rgb_to_hsv(color_bench_rgb, color_bench_hsv, COLOR_BENCH_COUNT);
+    to_hsv[0] = cordic_benchmark_get_cycles() - start;
+    start     = cordic_benchmark_get_cycles();
+    (void)cordic_color_hsv_to_rgb(color_bench_hsv, color_bench_out, COLOR_BENCH_COUNT);
+    to_rgb[0] = cordic_benchmark_get_cycles() - start;
+    error[0]  = color_roundtrip_error();
+    start     = cordic_benchmark_get_cycles();
+    (void)cordic_color_rotate_hue(color_bench_rgb, color_bench_out, COLOR_BENCH_COUNT, 1000U);
+    shift[0]  = cordic_benchmark_get_cycles() - start;
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < COLOR_BENCH_COUNT; i++)
+    {
+        color_sector_to_hsv(&color_bench_rgb[i], &color_bench_hsv[i]);
+    }
+    to_hsv[1] = cordic_benchmark_get_cycles() - start;
+    start     = cordic_benchmark_get_cycles();
+    for (i = 0U; i < COLOR_BENCH_COUNT; i++)
+    {
+        color_sector_to_rgb(&color_bench_hsv[i], &color_bench_out[i]);
+    }
+    to_rgb[1] = cordic_benchmark_get_cycles() - start;
+    error[1]  = color_roundtrip_error();
+    start     = cordic_benchmark_get_cycles();
+    for (i = 0U; i < COLOR_BENCH_COUNT; i++)
+    {
+        color_sector_to_hsv(&color_bench_rgb[i], &color_bench_hsv[i]);
+        color_bench_hsv[i].hue = (uint16_t)(color_bench_hsv[i].hue + 1000U);
+        color_sector_to_rgb(&color_bench_hsv[i], &color_bench_out[i]);
+    }
+    shift[1]  = cordic_benchmark_get_cycles() - start;
+
+    printf("\r\n%u LEDs, conversions per second\r\n", (unsigned int)COLOR_BENCH_COUNT);
+    printf("Method        RGB to HSV  HSV to RGB  hue shift  round-trip error\r\n");
+    for (m = 0U; m < 2U; m++)
+    {
+        to_hsv[m] = (0U != to_hsv[m]) ? to_hsv[m] : 1U;
+        to_rgb[m] = (0U != to_rgb[m]) ? to_rgb[m] : 1U;
+        shift[m]  = (0U != shift[m]) ? shift[m] : 1U;
+
+        printf("%-12s %11u %11u %10u %17u\r\n", (0U == m) ? "CORDIC" : "Sector",
+               (unsigned int)(((uint64_t)SystemCoreClock * COLOR_BENCH_COUNT) / to_hsv[m]),
+               (unsigned int)(((uint64_t)SystemCoreClock * COLOR_BENCH_COUNT) / to_rgb[m]),
+               (unsigned int)(((uint64_t)SystemCoreClock * COLOR_BENCH_COUNT) / shift[m]),
+               (unsigned int)error[m]);
+    }
+}
+
+/* [] END OF FILE */
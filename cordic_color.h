@@ -0,0 +1,90 @@
+/*******************************************************************************
+* File Name:   cordic_color.h
+*
+* Description: This header file contains the interface to the color
+* conversion module. It converts 8-bit RGB pixels or LEDs to hue, saturation,
+* and value in the polar form of the chroma plane with CORDIC vectoring, back
+* with CORDIC rotation, and rotates the hue of RGB values directly.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_COLOR_H
+#define CORDIC_COLOR_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* 8-bit RGB value of one pixel or LED */
+typedef struct
+{
+    uint8_t r;
+    uint8_t g;
+    uint8_t b;
+} cordic_color_rgb_t;
+
+/* Hue, saturation, and value. The hue is a 16-bit binary angle, 65536 = 360
+ * degrees, 0 = red. The saturation is the chroma radius over the value, so
+ * hues between the primaries and secondaries reach at most 0.87 at full
+ * chroma and larger saturations are clipped by the conversion to RGB. */
+typedef struct
+{
+    uint16_t hue;
+    uint8_t  saturation;
+    uint8_t  value;
+} cordic_color_hsv_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_en_cordic_status_t cordic_color_rgb_to_hsv(const cordic_color_rgb_t *rgb,
+                                              cordic_color_hsv_t *hsv,
+                                              uint32_t count);
+cy_en_cordic_status_t cordic_color_hsv_to_rgb(const cordic_color_hsv_t *hsv,
+                                              cordic_color_rgb_t *rgb,
+                                              uint32_t count);
+cy_en_cordic_status_t cordic_color_rotate_hue(const cordic_color_rgb_t *in,
+                                              cordic_color_rgb_t *out,
+                                              uint32_t count,
+                                              uint16_t hue_shift);
+void cordic_color_benchmark(void);
+
+#endif /*CORDIC_COLOR_H*/
+/* [] END OF FILE */
@@ -0,0 +1,356 @@
+/*******************************************************************************
+* File Name:   cordic_costas.c
+*
+* Description: This file contains the carrier recovery loop for BPSK and
+* QPSK. Each symbol is derotated by the NCO phase with the Park transform of the
+* CORDIC, and the phase error is detected by vectoring the derotated symbol.
+* The loop is pipelined across symbols: the loop filter and the NCO update for
+* one symbol run while the CORDIC derotates the next one.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_gain.h"
+#include "cordic_costas.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Q31 binary angle of pi/4 */
+#define COSTAS_ANGLE_PI_4        (0x20000000U)
+
+/* Benchmark: symbols, carrier offset in cycles per symbol, initial phase offset */
+#define COSTAS_BENCH_COUNT       (256U)
+#define COSTAS_BENCH_OFFSET      (0.002f)
+#define COSTAS_BENCH_PHASE       (1.0f)
+#define COSTAS_BENCH_SETTLED     (128U)
+
+/* Symbol rates at which the benchmark reports the CPU load */
+#define COSTAS_BENCH_RATES       (3U)
+
+/* Conversions of the benchmark */
+#define COSTAS_Q31_TO_FLOAT      (1.0f / 2147483648.0f)
+#define COSTAS_FLOAT_TO_Q31      (2147483648.0f)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int32_t costas_detect(const cordic_costas_t *loop,
+                             const cy_stc_cordic_parkTransform_result_t *park);
+static void    costas_update(cordic_costas_t *loop);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark buffers */
+static CY_CORDIC_Q31_t costas_bench_i[COSTAS_BENCH_COUNT];
+static CY_CORDIC_Q31_t costas_bench_q[COSTAS_BENCH_COUNT];
+static CY_CORDIC_Q31_t costas_bench_i_out[COSTAS_BENCH_COUNT];
+static CY_CORDIC_Q31_t costas_bench_q_out[COSTAS_BENCH_COUNT];
+
+/* Symbol rates of the load report in symbols per second */
+static const uint32_t costas_bench_rate[COSTAS_BENCH_RATES] =
+{
+    100000U, 250000U, 1000000U
+};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_costas_init
+********************************************************************************
+* Summary:
+* Initializes a carrier recovery loop with a zero NCO phase and frequency.
+*
+* Parameters:
+*  cordic_costas_t *loop       Loop state
+*  cordic_costas_mode_t mode   BPSK or QPSK
+*  int32_t kp                  Proportional gain in Q31, CORDIC_COSTAS_KP_DEFAULT
+*  int32_t ki                  Integral gain in Q31, CORDIC_COSTAS_KI_DEFAULT
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_costas_init(cordic_costas_t *loop, cordic_costas_mode_t mode,
+                        int32_t kp, int32_t ki)
+{
+    loop->mode      = mode;
+    loop->kp        = kp;
+    loop->ki        = ki;
+    loop->phase     = 0U;
+    loop->frequency = 0;
+    loop->error     = 0;
+}
+
+/*******************************************************************************
+* Function Name: costas_detect
+********************************************************************************
+* Summary:
+* Phase detector. The derotated symbol, still in Q23 with the gain, is vectored
+* in the right half plane; the vectoring is scale invariant and the pi lost by
+* folding is removed with the modulation anyway. The phase is shifted so that
+* the constellation points fall on multiples of 2 * pi, then the shift by the
+* bits per symbol leaves the deviation from the nearest point.
+*
+* Parameters:
+*  const cordic_costas_t *loop                       Loop state
+*  const cy_stc_cordic_parkTransform_result_t *park  Derotated symbol
+*
+* Return:
+*  int32_t  Phase error, Q31 binary angle
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static int32_t costas_detect(const cordic_costas_t *loop,
+                             const cy_stc_cordic_parkTransform_result_t *park)
+{
+    CY_CORDIC_8Q23_t x      = park->parkTransformId;
+    CY_CORDIC_8Q23_t y      = park->parkTransformIq;
+    uint32_t         shift  = (uint32_t)loop->mode;
+    uint32_t         offset = (CORDIC_COSTAS_QPSK == loop->mode) ? COSTAS_ANGLE_PI_4 : 0U;
+    uint32_t         angle  = 0;
+    int32_t          error  = 0;
+
+    if ((0 != x) || (0 != y))
+    {
+        if (x < 0)
+        {
+            x = -x;
+            y = -y;
+        }
+        CORDIC_TRACE(CORDIC_TRACE_OP_ARCTAN, 2U, x, y, 0);
+        angle = (uint32_t)Cy_CORDIC_ArcTan(MXCORDIC, x, y) - offset;
+        error = ((int32_t)(angle << shift)) >> shift;
+    }
+
+    return error;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: costas_update
+********************************************************************************
+* Summary:
+* Proportional-integral loop filter and NCO: applies the last phase error to
+* the NCO frequency and advances the NCO phase by one symbol.
+*
+* Parameters:
+*  cordic_costas_t *loop  Loop state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static void costas_update(cordic_costas_t *loop)
+{
+    int32_t proportional = (int32_t)(((int64_t)loop->error * loop->kp) >> 31);
+
+    loop->frequency += (int32_t)(((int64_t)loop->error * loop->ki) >> 31);
+    loop->phase     += (uint32_t)loop->frequency + (uint32_t)proportional;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_costas_process
+********************************************************************************
+* Summary:
+* Runs the carrier recovery loop over a buffer of symbols, one sample per
+* symbol. While the CORDIC derotates symbol n, the CPU applies the error of
+* symbol n - 1 to the NCO, which gives the phase of symbol n + 1, and removes
+* the gain from symbol n - 1. The error of each symbol therefore reaches the
+* NCO one symbol later than in a sequential loop, which the loop gains of a
+* bandwidth well below the symbol rate tolerate.
+*
+* Parameters:
+*  cordic_costas_t *loop          Loop state
+*  const CY_CORDIC_Q31_t *i_in    In-phase symbols in Q31
+*  const CY_CORDIC_Q31_t *q_in    Quadrature symbols in Q31
+*  CY_CORDIC_Q31_t *i_out         Derotated in-phase symbols in Q31
+*  CY_CORDIC_Q31_t *q_out         Derotated quadrature symbols in Q31
+*  uint32_t count                 Number of symbols
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_costas_process(cordic_costas_t *loop,
+                                            const CY_CORDIC_Q31_t *i_in,
+                                            const CY_CORDIC_Q31_t *q_in,
+                                            CY_CORDIC_Q31_t *i_out,
+                                            CY_CORDIC_Q31_t *q_out,
+                                            uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    cy_stc_cordic_parkTransform_result_t park     = {0};
+    cy_stc_cordic_parkTransform_result_t previous = {0};
+    uint32_t theta           = 0;
+    int32_t  negate          = 0;
+    int32_t  previous_negate = 0;
+    uint32_t n               = 0;
+
+    if ((NULL != loop) && (NULL != i_in) && (NULL != q_in) && (NULL != i_out) && (NULL != q_out))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        if (0U != count)
+        {
+            theta  = loop->phase;
+            negate = cordic_angle_fold(&theta);
+            CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)theta, i_in[0], q_in[0]);
+            Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)theta, i_in[0], q_in[0]);
+        }
+
+        for (n = 0U; n < count; n++)
+        {
+            /* Loop filter, NCO and output of the previous symbol while the
+             * peripheral derotates symbol n */
+            costas_update(loop);
+            theta = loop->phase;
+            if (0U != n)
+            {
+                i_out[n - 1U] = cordic_gain_remove(previous.parkTransformId, previous_negate);
+                q_out[n - 1U] = cordic_gain_remove(previous.parkTransformIq, previous_negate);
+            }
+
+            while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+            Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+
+            loop->error = costas_detect(loop, &park);
+
+            previous        = park;
+            previous_negate = negate;
+            if ((n + 1U) < count)
+            {
+                negate = cordic_angle_fold(&theta);
+                CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)theta, i_in[n + 1U], q_in[n + 1U]);
+                Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)theta, i_in[n + 1U], q_in[n + 1U]);
+            }
+        }
+
+        if (0U != count)
+        {
+            i_out[count - 1U] = cordic_gain_remove(previous.parkTransformId, previous_negate);
+            q_out[count - 1U] = cordic_gain_remove(previous.parkTransformIq, previous_negate);
+        }
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_costas_benchmark
+********************************************************************************
+* Summary:
+* Runs the loop over QPSK symbols with a carrier frequency and phase offset,
+* prints the cycles per symbol, the maximum symbol rate, the CPU load at
+* common symbol rates, and the residual phase error once the loop settled.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_costas_benchmark(void)
+{
+    cordic_costas_t loop;
+    uint32_t  seed     = 0x6C078965UL;
+    float32_t carrier  = COSTAS_BENCH_PHASE;
+    float32_t symbol   = 0.0f;
+    float32_t residual = 0.0f;
+    float32_t error    = 0.0f;
+    uint32_t  start    = 0;
+    uint32_t  cycles   = 0;
+    uint32_t  i        = 0;
+
+    for (i = 0U; i < COSTAS_BENCH_COUNT; i++)
+    {
+        seed    = (seed * 1664525UL) + 1013904223UL;
+        symbol  = (PI / 4.0f) + ((PI / 2.0f) * (float32_t)(seed >> 30));
+        carrier += 2.0f * PI * COSTAS_BENCH_OFFSET;
+        costas_bench_i[i] = (CY_CORDIC_Q31_t)(0.7f * cosf(symbol + carrier) * COSTAS_FLOAT_TO_Q31);
+        costas_bench_q[i] = (CY_CORDIC_Q31_t)(0.7f * sinf(symbol + carrier) * COSTAS_FLOAT_TO_Q31);
+    }
+
+    cordic_costas_init(&loop, CORDIC_COSTAS_QPSK, CORDIC_COSTAS_KP_DEFAULT, CORDIC_COSTAS_KI_DEFAULT);
+    start  = cordic_benchmark_get_cycles();
+    (void)cordic_costas_process(&loop, costas_bench_i, costas_bench_q,
+                                costas_bench_i_out, costas_bench_q_out, COSTAS_BENCH_COUNT);
+    cycles = cordic_benchmark_get_cycles() - start;
+    cycles = (0U != cycles) ? cycles : 1U;
+
+    /* Deviation of the derotated symbols from the nearest constellation point */
+    for (i = COSTAS_BENCH_SETTLED; i < COSTAS_BENCH_COUNT; i++)
+    {
+        error    = atan2f((float32_t)costas_bench_q_out[i], (float32_t)costas_bench_i_out[i]) - (PI / 4.0f);
+        error   -= (PI / 2.0f) * floorf((error + (PI / 4.0f)) / (PI / 2.0f));
+        residual = (fabsf(error) > residual) ? fabsf(error) : residual;
+    }
+
+    printf("\r\nQPSK, %u symbols, carrier offset %.3f cycles/symbol\r\n",
+           (unsigned int)COSTAS_BENCH_COUNT, (double)COSTAS_BENCH_OFFSET);
+    printf("cycles per symbol      : %u\r\n", (unsigned int)(cycles / COSTAS_BENCH_COUNT));
+    printf("maximum symbol rate    : %u symbols/s\r\n",
+           (unsigned int)(((uint64_t)SystemCoreClock * COSTAS_BENCH_COUNT) / cycles));
+    for (i = 0U; i < COSTAS_BENCH_RATES; i++)
+    {
+        printf("CPU load at %7u/s  : %u%%\r\n", (unsigned int)costas_bench_rate[i],
+               (unsigned int)((((uint64_t)cycles * costas_bench_rate[i] * 100U) /
+                               COSTAS_BENCH_COUNT) / SystemCoreClock));
+    }
+    printf("NCO frequency          : %.5f cycles/symbol\r\n",
+           (double)((float32_t)loop.frequency * COSTAS_Q31_TO_FLOAT * 0.5f));
+    printf("residual phase error   : %.2e rad after %u symbols\r\n",
+           (double)residual, (unsigned int)COSTAS_BENCH_SETTLED);
+}
+
+/* [] END OF FILE */
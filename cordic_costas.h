@@ -0,0 +1,92 @@
+/*******************************************************************************
+* File Name:   cordic_costas.h
+*
+* Description: This header file contains the interface to the carrier
+* recovery loop for BPSK and QPSK. The NCO and the mixer are the Park rotation
+* of the CORDIC, the phase detector is its vectoring operation.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_COSTAS_H
+#define CORDIC_COSTAS_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Default loop gains in Q31: damping 0.8, noise bandwidth about 0.5% of the
+ * symbol rate */
+#define CORDIC_COSTAS_KP_DEFAULT  (214748365L)     /* 0.1 */
+#define CORDIC_COSTAS_KI_DEFAULT  (8589935L)       /* 0.004 */
+
+/* Modulation. The value is the number of bits per symbol, which is also the
+ * shift that removes the modulation from the detected phase. */
+typedef enum
+{
+    CORDIC_COSTAS_BPSK = 1,
+    CORDIC_COSTAS_QPSK = 2
+} cordic_costas_mode_t;
+
+/* State of one carrier recovery loop */
+typedef struct
+{
+    cordic_costas_mode_t mode;
+    int32_t  kp;            /* Proportional gain, Q31 */
+    int32_t  ki;            /* Integral gain, Q31 */
+    uint32_t phase;         /* NCO phase of the next symbol, Q31 binary angle */
+    int32_t  frequency;     /* NCO phase step per symbol, Q31 binary angle */
+    int32_t  error;         /* Phase error of the last symbol, Q31 binary angle */
+} cordic_costas_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void cordic_costas_init(cordic_costas_t *loop, cordic_costas_mode_t mode,
+                        int32_t kp, int32_t ki);
+cy_en_cordic_status_t cordic_costas_process(cordic_costas_t *loop,
+                                            const CY_CORDIC_Q31_t *i_in,
+                                            const CY_CORDIC_Q31_t *q_in,
+                                            CY_CORDIC_Q31_t *i_out,
+                                            CY_CORDIC_Q31_t *q_out,
+                                            uint32_t count);
+void cordic_costas_benchmark(void);
+
+#endif /*CORDIC_COSTAS_H*/
+/* [] END OF FILE */
@@ -0,0 +1,322 @@
+/*******************************************************************************
+* File Name:   cordic_demod.c
+*
+* Description: This file contains the FM and PM demodulators. The phase of
+* each I/Q sample comes from Cy_CORDIC_ArcTan, extended from the right half
+* plane to the full circle. Q31 binary angles wrap like the phase itself, so the
+* FM discriminator is a plain 32-bit difference of consecutive phases.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_demod.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of samples of the benchmark buffer */
+#define DEMOD_BENCH_COUNT        (64U)
+
+/* Conversions of the benchmark */
+#define DEMOD_Q31_TO_FLOAT       (1.0f / 2147483648.0f)
+#define DEMOD_FLOAT_TO_Q31       (2147483648.0f)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static cy_en_cordic_status_t demod_run(cordic_demod_state_t *state,
+                                       const CY_CORDIC_Q31_t *i_in,
+                                       const CY_CORDIC_Q31_t *q_in,
+                                       CY_CORDIC_Q31_t *out,
+                                       uint32_t count,
+                                       uint32_t difference);
+static void demod_fm_float(const float32_t *i_in, const float32_t *q_in,
+                           float32_t *out, uint32_t count);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark buffers */
+static CY_CORDIC_Q31_t demod_bench_i[DEMOD_BENCH_COUNT];
+static CY_CORDIC_Q31_t demod_bench_q[DEMOD_BENCH_COUNT];
+static CY_CORDIC_Q31_t demod_bench_out[DEMOD_BENCH_COUNT];
+static float32_t       demod_bench_message[DEMOD_BENCH_COUNT];
+static float32_t       demod_float_i[DEMOD_BENCH_COUNT];
+static float32_t       demod_float_q[DEMOD_BENCH_COUNT];
+static float32_t       demod_float_out[DEMOD_BENCH_COUNT];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_demod_init
+********************************************************************************
+* Summary:
+* Resets the state of a demodulated stream to a phase of zero.
+*
+* Parameters:
+*  cordic_demod_state_t *state  Stream state
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_demod_init(cordic_demod_state_t *state)
+{
+    state->last_phase = 0U;
+}
+
+/*******************************************************************************
+* Function Name: demod_run
+********************************************************************************
+* Summary:
+* Extracts the phase of each sample and writes either the phase or its step
+* from the previous sample. A sample below the vectoring resolution holds the
+* phase of the previous sample.
+*
+* Parameters:
+*  cordic_demod_state_t *state   Stream state
+*  const CY_CORDIC_Q31_t *i_in   In-phase samples in Q31
+*  const CY_CORDIC_Q31_t *q_in   Quadrature samples in Q31
+*  CY_CORDIC_Q31_t *out          Phase or phase step in Q31
+*  uint32_t count                Number of samples
+*  uint32_t difference           0xFFFFFFFF for the phase step, 0 for the phase
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+static cy_en_cordic_status_t demod_run(cordic_demod_state_t *state,
+                                       const CY_CORDIC_Q31_t *i_in,
+                                       const CY_CORDIC_Q31_t *q_in,
+                                       CY_CORDIC_Q31_t *out,
+                                       uint32_t count,
+                                       uint32_t difference)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t phase = 0;
+    uint32_t last  = 0;
+    uint32_t i     = 0;
+
+    if ((NULL != state) && (NULL != i_in) && (NULL != q_in) && (NULL != out))
+    {
+        status = CY_CORDIC_SUCCESS;
+        last   = state->last_phase;
+
+        for (i = 0U; i < count; i++)
+        {
+            phase = cordic_angle_vector(i_in[i], q_in[i], last);
+
+            out[i] = (CY_CORDIC_Q31_t)cordic_angle_sub(phase, last & difference);
+            last   = phase;
+        }
+
+        state->last_phase = last;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_demod_fm
+********************************************************************************
+* Summary:
+* Quadrature discriminator: the output is the phase step from the previous
+* sample, which is proportional to the instantaneous frequency.
+*
+* Parameters:
+*  cordic_demod_state_t *state   Stream state
+*  const CY_CORDIC_Q31_t *i_in   In-phase samples in Q31
+*  const CY_CORDIC_Q31_t *q_in   Quadrature samples in Q31
+*  CY_CORDIC_Q31_t *out          Phase step in Q31, 1.0 = Nyquist frequency
+*  uint32_t count                Number of samples
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_demod_fm(cordic_demod_state_t *state,
+                                      const CY_CORDIC_Q31_t *i_in,
+                                      const CY_CORDIC_Q31_t *q_in,
+                                      CY_CORDIC_Q31_t *out,
+                                      uint32_t count)
+{
+    return demod_run(state, i_in, q_in, out, count, 0xFFFFFFFFU);
+}
+
+/*******************************************************************************
+* Function Name: cordic_demod_pm
+********************************************************************************
+* Summary:
+* Phase demodulator: the output is the phase of each sample.
+*
+* Parameters:
+*  cordic_demod_state_t *state   Stream state
+*  const CY_CORDIC_Q31_t *i_in   In-phase samples in Q31
+*  const CY_CORDIC_Q31_t *q_in   Quadrature samples in Q31
+*  CY_CORDIC_Q31_t *out          Phase in Q31, 1.0 = pi
+*  uint32_t count                Number of samples
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_demod_pm(cordic_demod_state_t *state,
+                                      const CY_CORDIC_Q31_t *i_in,
+                                      const CY_CORDIC_Q31_t *q_in,
+                                      CY_CORDIC_Q31_t *out,
+                                      uint32_t count)
+{
+    return demod_run(state, i_in, q_in, out, count, 0U);
+}
+
+/*******************************************************************************
+* Function Name: demod_fm_float
+********************************************************************************
+* Summary:
+* Floating-point reference discriminator: the sample is multiplied by the
+* conjugate of the previous sample and atan2f() gives the phase step.
+*
+* Parameters:
+*  const float32_t *i_in   In-phase samples
+*  const float32_t *q_in   Quadrature samples
+*  float32_t *out          Phase step, 1.0 = Nyquist frequency
+*  uint32_t count          Number of samples
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void demod_fm_float(const float32_t *i_in, const float32_t *q_in,
+                           float32_t *out, uint32_t count)
+{
+    float32_t last_i = 1.0f;
+    float32_t last_q = 0.0f;
+    float32_t re     = 0.0f;
+    float32_t im     = 0.0f;
+    uint32_t  i      = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        re     = (i_in[i] * last_i) + (q_in[i] * last_q);
+        im     = (q_in[i] * last_i) - (i_in[i] * last_q);
+        out[i] = atan2f(im, re) * (1.0f / PI);
+        last_i = i_in[i];
+        last_q = q_in[i];
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_demod_benchmark
+********************************************************************************
+* Summary:
+* Demodulates an FM buffer with a sine message with the CORDIC discriminator
+* and with the conjugate-multiply + atan2f() reference, and prints the samples
+* per second and the maximum deviation from the message of both.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_demod_benchmark(void)
+{
+    cordic_demod_state_t state;
+    float32_t carrier      = 0.0f;
+    float32_t error        = 0.0f;
+    float32_t error_cordic = 0.0f;
+    float32_t error_float  = 0.0f;
+    uint32_t  start        = 0;
+    uint32_t  cordic       = 0;
+    uint32_t  library      = 0;
+    uint32_t  i            = 0;
+
+    /* Carrier at 0.1 of Nyquist, deviation 0.3 of Nyquist, amplitude 0.9 */
+    for (i = 0U; i < DEMOD_BENCH_COUNT; i++)
+    {
+        demod_bench_message[i] = 0.1f + (0.3f * sinf((2.0f * PI * (float32_t)i) / 16.0f));
+        carrier += PI * demod_bench_message[i];
+        demod_bench_i[i] = (CY_CORDIC_Q31_t)(0.9f * cosf(carrier) * DEMOD_FLOAT_TO_Q31);
+        demod_bench_q[i] = (CY_CORDIC_Q31_t)(0.9f * sinf(carrier) * DEMOD_FLOAT_TO_Q31);
+    }
+
+    cordic_demod_init(&state);
+    start   = cordic_benchmark_get_cycles();
+    (void)cordic_demod_fm(&state, demod_bench_i, demod_bench_q, demod_bench_out, DEMOD_BENCH_COUNT);
+    cordic  = cordic_benchmark_get_cycles() - start;
+
+    /* The float discriminator starts from the same Q31 samples */
+    start   = cordic_benchmark_get_cycles();
+    for (i = 0U; i < DEMOD_BENCH_COUNT; i++)
+    {
+        demod_float_i[i] = (float32_t)demod_bench_i[i] * DEMOD_Q31_TO_FLOAT;
+        demod_float_q[i] = (float32_t)demod_bench_q[i] * DEMOD_Q31_TO_FLOAT;
+    }
+    demod_fm_float(demod_float_i, demod_float_q, demod_float_out, DEMOD_BENCH_COUNT);
+    library = cordic_benchmark_get_cycles() - start;
+
+    /* The first output is the step from the initial phase, not part of the message */
+    for (i = 1U; i < DEMOD_BENCH_COUNT; i++)
+    {
+        error        = fabsf(((float32_t)demod_bench_out[i] * DEMOD_Q31_TO_FLOAT) - demod_bench_message[i]);
+        error_cordic = (error > error_cordic) ? error : error_cordic;
+        error        = fabsf(demod_float_out[i] - demod_bench_message[i]);
+        error_float  = (error > error_float) ? error : error_float;
+    }
+
+    cordic  = (0U != cordic) ? cordic : 1U;
+    library = (0U != library) ? library : 1U;
+
+    printf("\r\n%u samples              | cycles/sample | samples/s | max error\r\n",
+           (unsigned int)DEMOD_BENCH_COUNT);
+    printf("CORDIC discriminator    | %13u | %9u | %.2e\r\n", (unsigned int)(cordic / DEMOD_BENCH_COUNT),
+           (unsigned int)(((uint64_t)SystemCoreClock * DEMOD_BENCH_COUNT) / cordic), (double)error_cordic);
+    printf("conjugate mult + atan2f | %13u | %9u | %.2e\r\n", (unsigned int)(library / DEMOD_BENCH_COUNT),
+           (unsigned int)(((uint64_t)SystemCoreClock * DEMOD_BENCH_COUNT) / library), (double)error_float);
+    printf("Errors in fractions of the Nyquist frequency.\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,806 @@
+/*******************************************************************************
+* File Name:   cordic_ekf.c
+*
+* Description: This file contains the fixed-point extended Kalman filter.
+* Each step takes the sine and cosine of the model angle from one Park
+* transform of a unit vector, lets the model set the prediction and the
+* Jacobians, and runs the covariance arithmetic with the CMSIS-DSP Q31 matrix
+* functions. The 2x2 innovation covariance is inverted with a normalized
+* reciprocal of its determinant.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "string.h"
+#include "math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_gain.h"
+#include "cordic_ekf.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* pi / 4 in Q31, the derivative of the angle in radians by the angle unit */
+#define EKF_QUARTER_PI_Q31    (1686629713L)
+
+/* Benchmark: steps, steps of the error window, and the simulated systems */
+#define EKF_BENCH_STEPS       (2048U)
+#define EKF_BENCH_WINDOW      (512U)
+#define EKF_BENCH_RESISTANCE  (0.02f)
+#define EKF_BENCH_BACK_EMF    (0.05f)
+#define EKF_BENCH_INPUT       (0.05f)
+#define EKF_BENCH_SPEED       (0.02f)
+#define EKF_BENCH_OMEGA       (0.6f)
+#define EKF_BENCH_VOLTAGE     (0.8f)
+#define EKF_BENCH_AMPLITUDE   (0.5f)
+#define EKF_BENCH_NOISE       (0.004f)
+#define EKF_BENCH_SCALE       (16.0f)
+#define EKF_BENCH_PI          (3.14159265358979)
+
+/* Float to Q31 with saturation */
+#define EKF_FLOAT_TO_Q31(x)   ((CY_CORDIC_Q31_t)fmaxf(fminf((x) * 2147483648.0f, 2147483520.0f), -2147483520.0f))
+#define EKF_Q31_TO_FLOAT(x)   ((float32_t)(x) / 2147483648.0f)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static CY_CORDIC_Q31_t ekf_mul(CY_CORDIC_Q31_t a, CY_CORDIC_Q31_t b);
+static CY_CORDIC_Q31_t ekf_sat(int64_t value);
+static CY_CORDIC_Q31_t ekf_pmsm_angle(const cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input);
+static void            ekf_pmsm_update(cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input,
+                                       CY_CORDIC_Q31_t sin_angle, CY_CORDIC_Q31_t cos_angle);
+static CY_CORDIC_Q31_t ekf_rotator_angle(const cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input);
+static void            ekf_rotator_update(cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input,
+                                          CY_CORDIC_Q31_t sin_angle, CY_CORDIC_Q31_t cos_angle);
+static void            ekf_float_pmsm_step(float32_t *x, float32_t *p, const float32_t *q, float32_t r,
+                                           const float32_t *input, const float32_t *measurement);
+static float32_t       ekf_noise(uint32_t *seed);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+const cordic_ekf_model_t cordic_ekf_pmsm_model =
+{
+    4U, 3U, ekf_pmsm_angle, ekf_pmsm_update
+};
+
+const cordic_ekf_model_t cordic_ekf_rotator_model =
+{
+    3U, 2U, ekf_rotator_angle, ekf_rotator_update
+};
+
+/* Benchmark filters */
+static cordic_ekf_t ekf_bench_filter;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: ekf_mul
+********************************************************************************
+* Summary:
+* Q31 product, truncated.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t a  Factor
+*  CY_CORDIC_Q31_t b  Factor
+*
+* Return:
+*  CY_CORDIC_Q31_t    Product
+*
+*******************************************************************************/
+static CY_CORDIC_Q31_t ekf_mul(CY_CORDIC_Q31_t a, CY_CORDIC_Q31_t b)
+{
+    return (CY_CORDIC_Q31_t)(((int64_t)a * b) >> 31);
+}
+
+/*******************************************************************************
+* Function Name: ekf_sat
+********************************************************************************
+* Summary:
+* Saturates a 64-bit value to Q31.
+*
+* Parameters:
+*  int64_t value  Value
+*
+* Return:
+*  CY_CORDIC_Q31_t  Saturated value
+*
+*******************************************************************************/
+static CY_CORDIC_Q31_t ekf_sat(int64_t value)
+{
+    return (value > INT32_MAX) ? INT32_MAX : ((value < INT32_MIN) ? INT32_MIN : (CY_CORDIC_Q31_t)value);
+}
+
+/*******************************************************************************
+* Function Name: cordic_ekf_init
+********************************************************************************
+* Summary:
+* Initializes a filter for a model and sets up the matrix instances for the
+* number of states of the model.
+*
+* Parameters:
+*  cordic_ekf_t *ekf                Filter state
+*  const cordic_ekf_model_t *model  Model
+*  const void *params               Model parameters
+*  const CY_CORDIC_Q31_t *x0        Initial states
+*  const CY_CORDIC_Q31_t *p0        Diagonal of the initial covariance
+*  const CY_CORDIC_Q31_t *q         Diagonal of the process noise covariance
+*  const CY_CORDIC_Q31_t *r         Diagonal of the measurement noise covariance
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL pointer or a model
+*                         with an invalid number of states
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_ekf_init(cordic_ekf_t *ekf, const cordic_ekf_model_t *model,
+                                      const void *params, const CY_CORDIC_Q31_t *x0,
+                                      const CY_CORDIC_Q31_t *p0, const CY_CORDIC_Q31_t *q,
+                                      const CY_CORDIC_Q31_t *r)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint16_t n = 0;
+    uint32_t i = 0;
+
+    if ((NULL != ekf) && (NULL != model) && (NULL != params) && (NULL != x0) && (NULL != p0) &&
+        (NULL != q) && (NULL != r) && (model->states >= CORDIC_EKF_MEASUREMENTS) &&
+        (model->states <= CORDIC_EKF_MAX_STATES) && (model->angle_index < model->states))
+    {
+        (void)memset(ekf, 0, sizeof(*ekf));
+        ekf->model  = model;
+        ekf->params = params;
+        n           = (uint16_t)model->states;
+
+        for (i = 0U; i < n; i++)
+        {
+            ekf->x[i]           = x0[i];
+            ekf->p[(i * n) + i] = p0[i];
+            ekf->q[(i * n) + i] = q[i];
+        }
+        for (i = 0U; i < CORDIC_EKF_MEASUREMENTS; i++)
+        {
+            ekf->r[(i * CORDIC_EKF_MEASUREMENTS) + i] = r[i];
+        }
+
+        arm_mat_init_q31(&ekf->mat_p, n, n, ekf->p);
+        arm_mat_init_q31(&ekf->mat_q, n, n, ekf->q);
+        arm_mat_init_q31(&ekf->mat_r, CORDIC_EKF_MEASUREMENTS, CORDIC_EKF_MEASUREMENTS, ekf->r);
+        arm_mat_init_q31(&ekf->mat_df, n, n, ekf->df);
+        arm_mat_init_q31(&ekf->mat_hj, CORDIC_EKF_MEASUREMENTS, n, ekf->hj);
+        arm_mat_init_q31(&ekf->mat_a, n, n, ekf->a);
+        arm_mat_init_q31(&ekf->mat_b, n, n, ekf->b);
+        arm_mat_init_q31(&ekf->mat_hjt, n, CORDIC_EKF_MEASUREMENTS, ekf->b);
+        arm_mat_init_q31(&ekf->mat_pht, n, CORDIC_EKF_MEASUREMENTS, ekf->pht);
+        arm_mat_init_q31(&ekf->mat_hp, CORDIC_EKF_MEASUREMENTS, n, ekf->hp);
+        arm_mat_init_q31(&ekf->mat_s, CORDIC_EKF_MEASUREMENTS, CORDIC_EKF_MEASUREMENTS, ekf->s);
+        arm_mat_init_q31(&ekf->mat_k, n, CORDIC_EKF_MEASUREMENTS, ekf->k);
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_ekf_step
+********************************************************************************
+* Summary:
+* One predict and update step. The covariance prediction uses the Jacobian in
+* the form I + dF:
+*   M = P + dF P,  P = M + M dF^T + Q
+* and the update
+*   S = H P H^T + R,  K = P H^T S^-1,  x = x_pred + K (z - h),  P = P - K H P
+* with H P taken as the transpose of P H^T. The angle state is corrected modulo
+* one turn and the covariance is kept symmetric.
+*
+* Parameters:
+*  cordic_ekf_t *ekf                    Filter state
+*  const CY_CORDIC_Q31_t *input         Inputs of the model, or NULL
+*  const CY_CORDIC_Q31_t *measurement   Measurements
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL pointer or a singular
+*                         innovation covariance
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_ekf_step(cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input,
+                                      const CY_CORDIC_Q31_t *measurement)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    cy_stc_cordic_parkTransform_result_t park;
+    CY_CORDIC_Q31_t sin_angle = 0;
+    CY_CORDIC_Q31_t cos_angle = 0;
+    CY_CORDIC_Q31_t unit      = 0;
+    CY_CORDIC_Q31_t innovation[CORDIC_EKF_MEASUREMENTS];
+    int64_t  det     = 0;
+    int64_t  term    = 0;
+    int64_t  inverse = 0;
+    uint32_t angle   = 0;
+    uint32_t zeros   = 0;
+    uint32_t high    = 0;
+    uint32_t n       = 0;
+    uint32_t i       = 0;
+    uint32_t j       = 0;
+
+    if ((NULL != ekf) && (NULL != ekf->model) && (NULL != measurement))
+    {
+        n = ekf->model->states;
+
+        /* Sine and cosine of the model angle: Park transform of (1, 0) gives
+         * d = cos(angle) and q = -sin(angle). The peripheral rotates within
+         * +/-90 degrees only, so an angle outside is folded by pi and (-1, 0)
+         * rotated instead */
+        angle = (uint32_t)ekf->model->angle(ekf, input);
+        unit  = (0 != cordic_angle_fold(&angle)) ? -INT32_MAX : INT32_MAX;
+        CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, (int32_t)angle, unit, 0);
+        Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)angle, unit, 0);
+        while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+        Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+        cos_angle = cordic_gain_remove(park.parkTransformId, 0);
+        sin_angle = cordic_gain_remove(park.parkTransformIq, -1);
+
+        ekf->model->update(ekf, input, sin_angle, cos_angle);
+
+        /* Covariance prediction */
+        (void)arm_mat_mult_q31(&ekf->mat_df, &ekf->mat_p, &ekf->mat_a);
+        (void)arm_mat_add_q31(&ekf->mat_p, &ekf->mat_a, &ekf->mat_a);
+        (void)arm_mat_trans_q31(&ekf->mat_df, &ekf->mat_b);
+        (void)arm_mat_mult_q31(&ekf->mat_a, &ekf->mat_b, &ekf->mat_p);
+        (void)arm_mat_add_q31(&ekf->mat_p, &ekf->mat_a, &ekf->mat_p);
+        (void)arm_mat_add_q31(&ekf->mat_p, &ekf->mat_q, &ekf->mat_p);
+
+        /* Innovation covariance */
+        (void)arm_mat_trans_q31(&ekf->mat_hj, &ekf->mat_hjt);
+        (void)arm_mat_mult_q31(&ekf->mat_p, &ekf->mat_hjt, &ekf->mat_pht);
+        (void)arm_mat_mult_q31(&ekf->mat_hj, &ekf->mat_pht, &ekf->mat_s);
+        (void)arm_mat_add_q31(&ekf->mat_s, &ekf->mat_r, &ekf->mat_s);
+        (void)arm_mat_trans_q31(&ekf->mat_pht, &ekf->mat_hp);
+
+        (void)memcpy(ekf->x, ekf->x_pred, n * sizeof(ekf->x[0]));
+
+        det = ((int64_t)ekf->s[0] * ekf->s[3]) - ((int64_t)ekf->s[1] * ekf->s[2]);
+        if (det > 0)
+        {
+            status = CY_CORDIC_SUCCESS;
+
+            /* 1 / det = 2^(zeros - 2) / m with the mantissa m in [0.5, 1) and
+             * its reciprocal in Q30 */
+            high    = (uint32_t)((uint64_t)det >> 32);
+            zeros   = (0U != high) ? __CLZ(high) : (32U + __CLZ((uint32_t)det));
+            inverse = (1LL << 61) / (int64_t)((uint64_t)det << (zeros - 1U) >> 32);
+
+            /* K = P H^T adj(S) / det in Q(31 - CORDIC_EKF_GAIN_SHIFT) */
+            for (i = 0U; i < n; i++)
+            {
+                for (j = 0U; j < CORDIC_EKF_MEASUREMENTS; j++)
+                {
+                    term = (0U == j) ?
+                           (((int64_t)ekf->pht[2U * i] * ekf->s[3]) - ((int64_t)ekf->pht[(2U * i) + 1U] * ekf->s[2])) :
+                           (((int64_t)ekf->pht[(2U * i) + 1U] * ekf->s[0]) - ((int64_t)ekf->pht[2U * i] * ekf->s[1]));
+                    term = (term >> 31) * inverse;
+                    if (zeros < (32U + CORDIC_EKF_GAIN_SHIFT))
+                    {
+                        term = (term + (1LL << (31U + CORDIC_EKF_GAIN_SHIFT - zeros))) >>
+                               (32U + CORDIC_EKF_GAIN_SHIFT - zeros);
+                    }
+                    else
+                    {
+                        term = (zeros < 48U) ? (ekf_sat(term) * (1LL << (zeros - 32U - CORDIC_EKF_GAIN_SHIFT))) :
+                               ((term < 0) ? INT32_MIN : ((term > 0) ? INT32_MAX : 0));
+                    }
+                    ekf->k[(2U * i) + j] = ekf_sat(term);
+                }
+            }
+
+            /* State update */
+            for (j = 0U; j < CORDIC_EKF_MEASUREMENTS; j++)
+            {
+                innovation[j] = ekf_sat((int64_t)measurement[j] - ekf->h[j]);
+            }
+            for (i = 0U; i < n; i++)
+            {
+                term = (((int64_t)ekf->k[2U * i] * innovation[0]) +
+                        ((int64_t)ekf->k[(2U * i) + 1U] * innovation[1])) >> (31U - CORDIC_EKF_GAIN_SHIFT);
+                if (i == ekf->model->angle_index)
+                {
+                    ekf->x[i] = (CY_CORDIC_Q31_t)((uint32_t)ekf->x[i] +
+                                                  (uint32_t)ekf_sat(term >> CORDIC_EKF_ANGLE_SHIFT));
+                }
+                else
+                {
+                    ekf->x[i] = ekf_sat((int64_t)ekf->x[i] + term);
+                }
+            }
+
+            /* Covariance update, the gain product rescaled to Q31 */
+            (void)arm_mat_mult_q31(&ekf->mat_k, &ekf->mat_hp, &ekf->mat_a);
+            for (i = 0U; i < (n * n); i++)
+            {
+                ekf->p[i] = ekf_sat((int64_t)ekf->p[i] - ((int64_t)ekf->a[i] * (1LL << CORDIC_EKF_GAIN_SHIFT)));
+            }
+        }
+
+        for (i = 0U; i < n; i++)
+        {
+            for (j = i + 1U; j < n; j++)
+            {
+                ekf->p[(i * n) + j] = (CY_CORDIC_Q31_t)(((int64_t)ekf->p[(i * n) + j] + ekf->p[(j * n) + i]) >> 1);
+                ekf->p[(j * n) + i] = ekf->p[(i * n) + j];
+            }
+        }
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: ekf_pmsm_angle
+********************************************************************************
+* Summary:
+* The PMSM model needs the sine and cosine of the estimated rotor angle.
+*
+* Parameters:
+*  const cordic_ekf_t *ekf       Filter state
+*  const CY_CORDIC_Q31_t *input  Voltages
+*
+* Return:
+*  CY_CORDIC_Q31_t  Rotor angle
+*
+*******************************************************************************/
+static CY_CORDIC_Q31_t ekf_pmsm_angle(const cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input)
+{
+    (void)input;
+
+    return ekf->x[3];
+}
+
+/*******************************************************************************
+* Function Name: ekf_pmsm_update
+********************************************************************************
+* Summary:
+* Euler step of the PMSM in the stationary frame:
+*   i_alpha' = i_alpha - r i_alpha + e omega sin(theta) + g v_alpha
+*   i_beta'  = i_beta  - r i_beta  - e omega cos(theta) + g v_beta
+*   omega'   = omega
+*   theta'   = theta + s omega
+* The measurements are the two currents.
+*
+* Parameters:
+*  cordic_ekf_t *ekf           Filter state
+*  const CY_CORDIC_Q31_t *input  Voltages v_alpha and v_beta
+*  CY_CORDIC_Q31_t sin_angle   Sine of the rotor angle
+*  CY_CORDIC_Q31_t cos_angle   Cosine of the rotor angle
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void ekf_pmsm_update(cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input,
+                            CY_CORDIC_Q31_t sin_angle, CY_CORDIC_Q31_t cos_angle)
+{
+    const cordic_ekf_pmsm_t *pmsm = (const cordic_ekf_pmsm_t *)ekf->params;
+    CY_CORDIC_Q31_t emf = ekf_mul(pmsm->back_emf, ekf->x[2]);
+    CY_CORDIC_Q31_t v_alpha = (NULL != input) ? input[0] : 0;
+    CY_CORDIC_Q31_t v_beta  = (NULL != input) ? input[1] : 0;
+
+    ekf->x_pred[0] = ekf_sat((int64_t)ekf->x[0] - ekf_mul(pmsm->resistance, ekf->x[0]) +
+                             ekf_mul(emf, sin_angle) + ekf_mul(pmsm->input, v_alpha));
+    ekf->x_pred[1] = ekf_sat((int64_t)ekf->x[1] - ekf_mul(pmsm->resistance, ekf->x[1]) -
+                             ekf_mul(emf, cos_angle) + ekf_mul(pmsm->input, v_beta));
+    ekf->x_pred[2] = ekf->x[2];
+    ekf->x_pred[3] = (CY_CORDIC_Q31_t)((uint32_t)ekf->x[3] + (uint32_t)ekf_mul(pmsm->speed, ekf->x[2]));
+
+    ekf->df[0]  = -pmsm->resistance;
+    ekf->df[2]  = ekf_mul(pmsm->back_emf, sin_angle);
+    ekf->df[3]  = ekf_mul(EKF_QUARTER_PI_Q31, ekf_mul(emf, cos_angle));
+    ekf->df[5]  = -pmsm->resistance;
+    ekf->df[6]  = -ekf_mul(pmsm->back_emf, cos_angle);
+    ekf->df[7]  = ekf_mul(EKF_QUARTER_PI_Q31, ekf_mul(emf, sin_angle));
+    ekf->df[14] = ekf_sat((int64_t)pmsm->speed * (1LL << CORDIC_EKF_ANGLE_SHIFT));
+
+    ekf->h[0]  = ekf->x_pred[0];
+    ekf->h[1]  = ekf->x_pred[1];
+    ekf->hj[0] = INT32_MAX;
+    ekf->hj[5] = INT32_MAX;
+}
+
+/*******************************************************************************
+* Function Name: ekf_rotator_angle
+********************************************************************************
+* Summary:
+* The rotator model needs the sine and cosine of the predicted angle.
+*
+* Parameters:
+*  const cordic_ekf_t *ekf       Filter state
+*  const CY_CORDIC_Q31_t *input  Not used
+*
+* Return:
+*  CY_CORDIC_Q31_t  Predicted angle
+*
+*******************************************************************************/
+static CY_CORDIC_Q31_t ekf_rotator_angle(const cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input)
+{
+    const cordic_ekf_rotator_t *rotator = (const cordic_ekf_rotator_t *)ekf->params;
+
+    (void)input;
+
+    return (CY_CORDIC_Q31_t)((uint32_t)ekf->x[2] + (uint32_t)ekf_mul(rotator->speed, ekf->x[1]));
+}
+
+/*******************************************************************************
+* Function Name: ekf_rotator_update
+********************************************************************************
+* Summary:
+* Rotating vector at constant amplitude and speed:
+*   amplitude' = amplitude, omega' = omega, theta' = theta + s omega
+* measured as amplitude' (cos(theta'), sin(theta')).
+*
+* Parameters:
+*  cordic_ekf_t *ekf             Filter state
+*  const CY_CORDIC_Q31_t *input  Not used
+*  CY_CORDIC_Q31_t sin_angle     Sine of the predicted angle
+*  CY_CORDIC_Q31_t cos_angle     Cosine of the predicted angle
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void ekf_rotator_update(cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input,
+                               CY_CORDIC_Q31_t sin_angle, CY_CORDIC_Q31_t cos_angle)
+{
+    const cordic_ekf_rotator_t *rotator = (const cordic_ekf_rotator_t *)ekf->params;
+    CY_CORDIC_Q31_t amplitude = ekf_mul(EKF_QUARTER_PI_Q31, ekf->x[0]);
+
+    (void)input;
+
+    ekf->x_pred[0] = ekf->x[0];
+    ekf->x_pred[1] = ekf->x[1];
+    ekf->x_pred[2] = ekf_rotator_angle(ekf, NULL);
+
+    ekf->df[7] = ekf_sat((int64_t)rotator->speed * (1LL << CORDIC_EKF_ANGLE_SHIFT));
+
+    ekf->h[0]  = ekf_mul(ekf->x[0], cos_angle);
+    ekf->h[1]  = ekf_mul(ekf->x[0], sin_angle);
+    ekf->hj[0] = cos_angle;
+    ekf->hj[2] = -ekf_mul(amplitude, sin_angle);
+    ekf->hj[3] = sin_angle;
+    ekf->hj[5] = ekf_mul(amplitude, cos_angle);
+}
+
+/*******************************************************************************
+* Function Name: ekf_float_pmsm_step
+********************************************************************************
+* Summary:
+* Floating-point reference of the PMSM filter step with sinf(), cosf(), and
+* the full state Jacobian. The angle is in radians.
+*
+* Parameters:
+*  float32_t *x                     States
+*  float32_t *p                     Covariance, 4x4
+*  const float32_t *q               Diagonal of the process noise covariance
+*  float32_t r                      Measurement noise variance
+*  const float32_t *input           Voltages
+*  const float32_t *measurement     Currents
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void ekf_float_pmsm_step(float32_t *x, float32_t *p, const float32_t *q, float32_t r,
+                                const float32_t *input, const float32_t *measurement)
+{
+    float32_t f[16];
+    float32_t fp[16];
+    float32_t k[8];
+    float32_t s[4];
+    float32_t x_pred[4];
+    float32_t sin_theta = sinf(x[3]);
+    float32_t cos_theta = cosf(x[3]);
+    float32_t emf       = EKF_BENCH_BACK_EMF * x[2];
+    float32_t speed     = EKF_BENCH_SPEED * (float32_t)EKF_BENCH_PI;
+    float32_t det       = 0.0f;
+    float32_t y0        = 0.0f;
+    float32_t y1        = 0.0f;
+    float32_t sum       = 0.0f;
+    uint32_t  i         = 0;
+    uint32_t  j         = 0;
+    uint32_t  m         = 0;
+
+    x_pred[0] = x[0] - (EKF_BENCH_RESISTANCE * x[0]) + (emf * sin_theta) + (EKF_BENCH_INPUT * input[0]);
+    x_pred[1] = x[1] - (EKF_BENCH_RESISTANCE * x[1]) - (emf * cos_theta) + (EKF_BENCH_INPUT * input[1]);
+    x_pred[2] = x[2];
+    x_pred[3] = x[3] + (speed * x[2]);
+
+    (void)memset(f, 0, sizeof(f));
+    f[0]  = 1.0f - EKF_BENCH_RESISTANCE;
+    f[2]  = EKF_BENCH_BACK_EMF * sin_theta;
+    f[3]  = emf * cos_theta;
+    f[5]  = 1.0f - EKF_BENCH_RESISTANCE;
+    f[6]  = -EKF_BENCH_BACK_EMF * cos_theta;
+    f[7]  = emf * sin_theta;
+    f[10] = 1.0f;
+    f[14] = speed;
+    f[15] = 1.0f;
+
+    /* P = F P F^T + Q */
+    for (i = 0U; i < 4U; i++)
+    {
+        for (j = 0U; j < 4U; j++)
+        {
+            sum = 0.0f;
+            for (m = 0U; m < 4U; m++)
+            {
+                sum += f[(i * 4U) + m] * p[(m * 4U) + j];
+            }
+            fp[(i * 4U) + j] = sum;
+        }
+    }
+    for (i = 0U; i < 4U; i++)
+    {
+        for (j = 0U; j < 4U; j++)
+        {
+            sum = (i == j) ? q[i] : 0.0f;
+            for (m = 0U; m < 4U; m++)
+            {
+                sum += fp[(i * 4U) + m] * f[(j * 4U) + m];
+            }
+            p[(i * 4U) + j] = sum;
+        }
+    }
+
+    /* H selects the currents: S = P[0..1][0..1] + R, K = P[.][0..1] S^-1 */
+    s[0] = p[0] + r;
+    s[1] = p[1];
+    s[2] = p[4];
+    s[3] = p[5] + r;
+    det  = (s[0] * s[3]) - (s[1] * s[2]);
+    for (i = 0U; i < 4U; i++)
+    {
+        k[2U * i]        = ((p[i * 4U] * s[3]) - (p[(i * 4U) + 1U] * s[2])) / det;
+        k[(2U * i) + 1U] = ((p[(i * 4U) + 1U] * s[0]) - (p[i * 4U] * s[1])) / det;
+    }
+
+    y0 = measurement[0] - x_pred[0];
+    y1 = measurement[1] - x_pred[1];
+    for (i = 0U; i < 4U; i++)
+    {
+        x[i] = x_pred[i] + (k[2U * i] * y0) + (k[(2U * i) + 1U] * y1);
+    }
+    x[3] = remainderf(x[3], 2.0f * (float32_t)EKF_BENCH_PI);
+
+    /* P = P - K H P */
+    (void)memcpy(fp, p, sizeof(fp));
+    for (i = 0U; i < 4U; i++)
+    {
+        for (j = 0U; j < 4U; j++)
+        {
+            p[(i * 4U) + j] = fp[(i * 4U) + j] - (k[2U * i] * fp[j]) - (k[(2U * i) + 1U] * fp[4U + j]);
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: ekf_noise
+********************************************************************************
+* Summary:
+* Uniform measurement noise of the benchmark from a linear congruential
+* generator.
+*
+* Parameters:
+*  uint32_t *seed  Generator state
+*
+* Return:
+*  float32_t       Noise in [-EKF_BENCH_NOISE, EKF_BENCH_NOISE)
+*
+*******************************************************************************/
+static float32_t ekf_noise(uint32_t *seed)
+{
+    *seed = (*seed * 1664525U) + 1013904223U;
+
+    return EKF_BENCH_NOISE * (((float32_t)(*seed >> 8) / 8388608.0f) - 1.0f);
+}
+
+/*******************************************************************************
+* Function Name: cordic_ekf_benchmark
+********************************************************************************
+* Summary:
+* Tracks a simulated PMSM from its noisy currents with the fixed-point filter
+* and with the floating-point reference, and a noisy rotating vector with the
+* fixed-point filter. Both start with a wrong speed and angle. Prints the
+* cycles per step and the largest angle and speed errors over the last
+* EKF_BENCH_WINDOW steps.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_ekf_benchmark(void)
+{
+    cordic_ekf_pmsm_t    pmsm;
+    cordic_ekf_rotator_t rotator;
+    CY_CORDIC_Q31_t      x0[CORDIC_EKF_MAX_STATES];
+    CY_CORDIC_Q31_t      p0[CORDIC_EKF_MAX_STATES];
+    CY_CORDIC_Q31_t      q[CORDIC_EKF_MAX_STATES];
+    CY_CORDIC_Q31_t      r[CORDIC_EKF_MEASUREMENTS];
+    CY_CORDIC_Q31_t      input[CORDIC_EKF_MEASUREMENTS];
+    CY_CORDIC_Q31_t      measurement[CORDIC_EKF_MEASUREMENTS];
+    float32_t            fx[4];
+    float32_t            fp[16];
+    float32_t            fq[4];
+    float32_t            finput[2];
+    float32_t            fmeasurement[2];
+    float32_t            theta   = 0.3f;
+    float32_t            current[2];
+    float32_t            voltage = 0.0f;
+    float32_t            step    = EKF_BENCH_SPEED * (float32_t)EKF_BENCH_PI * EKF_BENCH_OMEGA;
+    float32_t            angle_error[3];
+    float32_t            speed_error[3];
+    uint32_t             cycles[3];
+    uint32_t             seed    = 1U;
+    uint32_t             start   = 0;
+    uint32_t             i       = 0;
+
+    (void)memset(angle_error, 0, sizeof(angle_error));
+    (void)memset(speed_error, 0, sizeof(speed_error));
+    (void)memset(cycles, 0, sizeof(cycles));
+    (void)memset(fp, 0, sizeof(fp));
+
+    /* PMSM, the covariances scaled by EKF_BENCH_SCALE */
+    pmsm.resistance = EKF_FLOAT_TO_Q31(EKF_BENCH_RESISTANCE);
+    pmsm.back_emf   = EKF_FLOAT_TO_Q31(EKF_BENCH_BACK_EMF);
+    pmsm.input      = EKF_FLOAT_TO_Q31(EKF_BENCH_INPUT);
+    pmsm.speed      = EKF_FLOAT_TO_Q31(EKF_BENCH_SPEED);
+    x0[0] = 0;
+    x0[1] = 0;
+    x0[2] = EKF_FLOAT_TO_Q31(0.5f);
+    x0[3] = 0;
+    p0[0] = EKF_FLOAT_TO_Q31(0.001f * EKF_BENCH_SCALE);
+    p0[1] = p0[0];
+    p0[2] = EKF_FLOAT_TO_Q31(0.01f * EKF_BENCH_SCALE);
+    p0[3] = EKF_FLOAT_TO_Q31(0.04f * EKF_BENCH_SCALE);
+    q[0]  = EKF_FLOAT_TO_Q31(1e-5f * EKF_BENCH_SCALE);
+    q[1]  = q[0];
+    q[2]  = EKF_FLOAT_TO_Q31(1e-6f * EKF_BENCH_SCALE);
+    q[3]  = EKF_FLOAT_TO_Q31(1e-6f * EKF_BENCH_SCALE);
+    r[0]  = EKF_FLOAT_TO_Q31(1e-5f * EKF_BENCH_SCALE);
+    r[1]  = r[0];
+    (void)cordic_ekf_init(&ekf_bench_filter, &cordic_ekf_pmsm_model, &pmsm, x0, p0, q, r);
+
+    fx[0] = 0.0f;
+    fx[1] = 0.0f;
+    fx[2] = 0.5f;
+    fx[3] = 0.0f;
+    for (i = 0U; i < 4U; i++)
+    {
+        fp[i * 5U] = (EKF_Q31_TO_FLOAT(p0[i]) / EKF_BENCH_SCALE) *
+                     ((3U == i) ? ((float32_t)EKF_BENCH_PI * (float32_t)EKF_BENCH_PI / 16.0f) : 1.0f);
+        fq[i]      = (EKF_Q31_TO_FLOAT(q[i]) / EKF_BENCH_SCALE) *
+                     ((3U == i) ? ((float32_t)EKF_BENCH_PI * (float32_t)EKF_BENCH_PI / 16.0f) : 1.0f);
+    }
+    current[0] = 0.0f;
+    current[1] = 0.0f;
+
+    for (i = 0U; i < EKF_BENCH_STEPS; i++)
+    {
+        /* Drive against the back EMF and advance the simulated motor */
+        voltage    = theta + (0.5f * (float32_t)EKF_BENCH_PI);
+        finput[0]  = EKF_BENCH_VOLTAGE * cosf(voltage);
+        finput[1]  = EKF_BENCH_VOLTAGE * sinf(voltage);
+        current[0] = current[0] - (EKF_BENCH_RESISTANCE * current[0]) +
+                     (EKF_BENCH_BACK_EMF * EKF_BENCH_OMEGA * sinf(theta)) + (EKF_BENCH_INPUT * finput[0]);
+        current[1] = current[1] - (EKF_BENCH_RESISTANCE * current[1]) -
+                     (EKF_BENCH_BACK_EMF * EKF_BENCH_OMEGA * cosf(theta)) + (EKF_BENCH_INPUT * finput[1]);
+        theta      = remainderf(theta + step, 2.0f * (float32_t)EKF_BENCH_PI);
+        fmeasurement[0] = current[0] + ekf_noise(&seed);
+        fmeasurement[1] = current[1] + ekf_noise(&seed);
+        input[0]        = EKF_FLOAT_TO_Q31(finput[0]);
+        input[1]        = EKF_FLOAT_TO_Q31(finput[1]);
+        measurement[0]  = EKF_FLOAT_TO_Q31(fmeasurement[0]);
+        measurement[1]  = EKF_FLOAT_TO_Q31(fmeasurement[1]);
+
+        start      = cordic_benchmark_get_cycles();
+        (void)cordic_ekf_step(&ekf_bench_filter, input, measurement);
+        cycles[0] += cordic_benchmark_get_cycles() - start;
+
+        start      = cordic_benchmark_get_cycles();
+        ekf_float_pmsm_step(fx, fp, fq, 1e-5f, finput, fmeasurement);
+        cycles[1] += cordic_benchmark_get_cycles() - start;
+
+        if (i >= (EKF_BENCH_STEPS - EKF_BENCH_WINDOW))
+        {
+            angle_error[0] = fmaxf(angle_error[0], fabsf(remainderf(((float32_t)ekf_bench_filter.x[3] *
+                                   (float32_t)EKF_BENCH_PI / 2147483648.0f) - theta, 2.0f * (float32_t)EKF_BENCH_PI)));
+            angle_error[1] = fmaxf(angle_error[1], fabsf(remainderf(fx[3] - theta, 2.0f * (float32_t)EKF_BENCH_PI)));
+            speed_error[0] = fmaxf(speed_error[0], fabsf(EKF_Q31_TO_FLOAT(ekf_bench_filter.x[2]) - EKF_BENCH_OMEGA));
+            speed_error[1] = fmaxf(speed_error[1], fabsf(fx[2] - EKF_BENCH_OMEGA));
+        }
+    }
+
+    /* Rotating vector */
+    rotator.speed = EKF_FLOAT_TO_Q31(EKF_BENCH_SPEED);
+    x0[0] = EKF_FLOAT_TO_Q31(0.4f);
+    x0[1] = EKF_FLOAT_TO_Q31(0.5f);
+    x0[2] = 0;
+    p0[0] = EKF_FLOAT_TO_Q31(0.01f * EKF_BENCH_SCALE);
+    p0[1] = EKF_FLOAT_TO_Q31(0.01f * EKF_BENCH_SCALE);
+    p0[2] = EKF_FLOAT_TO_Q31(0.04f * EKF_BENCH_SCALE);
+    q[0]  = EKF_FLOAT_TO_Q31(1e-7f * EKF_BENCH_SCALE);
+    q[1]  = EKF_FLOAT_TO_Q31(1e-6f * EKF_BENCH_SCALE);
+    q[2]  = EKF_FLOAT_TO_Q31(1e-6f * EKF_BENCH_SCALE);
+    (void)cordic_ekf_init(&ekf_bench_filter, &cordic_ekf_rotator_model, &rotator, x0, p0, q, r);
+
+    theta = 0.3f;
+    for (i = 0U; i < EKF_BENCH_STEPS; i++)
+    {
+        theta          = remainderf(theta + step, 2.0f * (float32_t)EKF_BENCH_PI);
+        measurement[0] = EKF_FLOAT_TO_Q31((EKF_BENCH_AMPLITUDE * cosf(theta)) + ekf_noise(&seed));
+        measurement[1] = EKF_FLOAT_TO_Q31((EKF_BENCH_AMPLITUDE * sinf(theta)) + ekf_noise(&seed));
+
+        start      = cordic_benchmark_get_cycles();
+        (void)cordic_ekf_step(&ekf_bench_filter, NULL, measurement);
+        cycles[2] += cordic_benchmark_get_cycles() - start;
+
+        if (i >= (EKF_BENCH_STEPS - EKF_BENCH_WINDOW))
+        {
+            angle_error[2] = fmaxf(angle_error[2], fabsf(remainderf(((float32_t)ekf_bench_filter.x[2] *
+                                   (float32_t)EKF_BENCH_PI / 2147483648.0f) - theta, 2.0f * (float32_t)EKF_BENCH_PI)));
+            speed_error[2] = fmaxf(speed_error[2], fabsf(EKF_Q31_TO_FLOAT(ekf_bench_filter.x[1]) - EKF_BENCH_OMEGA));
+        }
+    }
+
+    printf("\r\n%u steps, errors over the last %u steps\r\n",
+           (unsigned int)EKF_BENCH_STEPS, (unsigned int)EKF_BENCH_WINDOW);
+    printf("Filter                    | cycles/step | max angle error (deg) | max speed error (pu)\r\n");
+    printf("PMSM, CORDIC and Q31      | %11u | %21.3f | %.5f\r\n", (unsigned int)(cycles[0] / EKF_BENCH_STEPS),
+           (double)angle_error[0] * 180.0 / EKF_BENCH_PI, (double)speed_error[0]);
+    printf("PMSM, libm and float      | %11u | %21.3f | %.5f\r\n", (unsigned int)(cycles[1] / EKF_BENCH_STEPS),
+           (double)angle_error[1] * 180.0 / EKF_BENCH_PI, (double)speed_error[1]);
+    printf("Rotator, CORDIC and Q31   | %11u | %21.3f | %.5f\r\n", (unsigned int)(cycles[2] / EKF_BENCH_STEPS),
+           (double)angle_error[2] * 180.0 / EKF_BENCH_PI, (double)speed_error[2]);
+}
+
+/* [] END OF FILE */
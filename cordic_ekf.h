@@ -0,0 +1,161 @@
+/*******************************************************************************
+* File Name:   cordic_ekf.h
+*
+* Description: This header file contains the interface to the fixed-point extended
+* Kalman filter. The filter takes the sine and cosine of its angle state from a
+* single CORDIC operation per step and keeps its matrices in the CMSIS-DSP Q31
+* layout. Models for a PMSM in the stationary frame and for a generic rotating
+* 2D vector are included.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_EKF_H
+#define CORDIC_EKF_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "arm_math.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest number of states and the number of measurements and inputs */
+#define CORDIC_EKF_MAX_STATES     (4U)
+#define CORDIC_EKF_MEASUREMENTS   (2U)
+
+/* The angle state is a Q31 binary angle, 0x80000000 = -pi. In the covariance,
+ * the Jacobians, and the gain, it is counted in units of pi / 4 rad, so that
+ * the Jacobian entries of an angle stay below 1. */
+#define CORDIC_EKF_ANGLE_SHIFT    (2U)
+
+/* Integer bits of the Kalman gain, which is stored in Q(31 - shift) */
+#define CORDIC_EKF_GAIN_SHIFT     (4U)
+
+struct cordic_ekf_s;
+
+/* Process and measurement model of a filter.
+ * angle:  returns the angle whose sine and cosine the step needs, from the
+ *         state estimate and the input.
+ * update: from the sine and cosine, sets the predicted state, the state
+ *         Jacobian minus the identity, the predicted measurement, and the
+ *         measurement Jacobian. */
+typedef struct
+{
+    uint32_t states;        /* Number of states */
+    uint32_t angle_index;   /* Index of the angle state */
+    CY_CORDIC_Q31_t (*angle)(const struct cordic_ekf_s *ekf, const CY_CORDIC_Q31_t *input);
+    void (*update)(struct cordic_ekf_s *ekf, const CY_CORDIC_Q31_t *input,
+                   CY_CORDIC_Q31_t sin_angle, CY_CORDIC_Q31_t cos_angle);
+} cordic_ekf_model_t;
+
+/* PMSM in the stationary frame, per unit. States i_alpha, i_beta, omega, and
+ * theta; inputs v_alpha and v_beta; measurements i_alpha and i_beta. */
+typedef struct
+{
+    CY_CORDIC_Q31_t resistance; /* T R / L */
+    CY_CORDIC_Q31_t back_emf;   /* T psi omega_base / (L i_base) */
+    CY_CORDIC_Q31_t input;      /* T v_base / (L i_base) */
+    CY_CORDIC_Q31_t speed;      /* T omega_base / pi, below 1 / 4 */
+} cordic_ekf_pmsm_t;
+
+/* Rotating 2D vector, per unit. States amplitude, omega, and theta; no inputs;
+ * measurements amplitude * cos(theta) and amplitude * sin(theta). */
+typedef struct
+{
+    CY_CORDIC_Q31_t speed;      /* T omega_base / pi, below 1 / 4 */
+} cordic_ekf_rotator_t;
+
+/* Filter state. The covariance, the process noise, and the measurement noise
+ * may be scaled by a common factor to use the Q31 range; the gain does not
+ * change. */
+typedef struct cordic_ekf_s
+{
+    const cordic_ekf_model_t *model;
+    const void               *params;
+    CY_CORDIC_Q31_t x[CORDIC_EKF_MAX_STATES];                               /* State estimate */
+    CY_CORDIC_Q31_t p[CORDIC_EKF_MAX_STATES * CORDIC_EKF_MAX_STATES];       /* Covariance */
+    CY_CORDIC_Q31_t q[CORDIC_EKF_MAX_STATES * CORDIC_EKF_MAX_STATES];       /* Process noise */
+    CY_CORDIC_Q31_t r[CORDIC_EKF_MEASUREMENTS * CORDIC_EKF_MEASUREMENTS];   /* Measurement noise */
+    CY_CORDIC_Q31_t x_pred[CORDIC_EKF_MAX_STATES];                          /* Predicted state */
+    CY_CORDIC_Q31_t h[CORDIC_EKF_MEASUREMENTS];                             /* Predicted measurement */
+    CY_CORDIC_Q31_t df[CORDIC_EKF_MAX_STATES * CORDIC_EKF_MAX_STATES];      /* State Jacobian - I */
+    CY_CORDIC_Q31_t hj[CORDIC_EKF_MEASUREMENTS * CORDIC_EKF_MAX_STATES];    /* Measurement Jacobian */
+    CY_CORDIC_Q31_t a[CORDIC_EKF_MAX_STATES * CORDIC_EKF_MAX_STATES];       /* Scratch */
+    CY_CORDIC_Q31_t b[CORDIC_EKF_MAX_STATES * CORDIC_EKF_MAX_STATES];       /* Scratch */
+    CY_CORDIC_Q31_t pht[CORDIC_EKF_MAX_STATES * CORDIC_EKF_MEASUREMENTS];   /* P H^T */
+    CY_CORDIC_Q31_t hp[CORDIC_EKF_MEASUREMENTS * CORDIC_EKF_MAX_STATES];    /* H P */
+    CY_CORDIC_Q31_t s[CORDIC_EKF_MEASUREMENTS * CORDIC_EKF_MEASUREMENTS];   /* Innovation covariance */
+    CY_CORDIC_Q31_t k[CORDIC_EKF_MAX_STATES * CORDIC_EKF_MEASUREMENTS];     /* Gain */
+    arm_matrix_instance_q31 mat_p;
+    arm_matrix_instance_q31 mat_q;
+    arm_matrix_instance_q31 mat_r;
+    arm_matrix_instance_q31 mat_df;
+    arm_matrix_instance_q31 mat_hj;
+    arm_matrix_instance_q31 mat_a;
+    arm_matrix_instance_q31 mat_b;
+    arm_matrix_instance_q31 mat_hjt;  /* H^T, in the data of mat_b */
+    arm_matrix_instance_q31 mat_pht;
+    arm_matrix_instance_q31 mat_hp;
+    arm_matrix_instance_q31 mat_s;
+    arm_matrix_instance_q31 mat_k;
+} cordic_ekf_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern const cordic_ekf_model_t cordic_ekf_pmsm_model;
+extern const cordic_ekf_model_t cordic_ekf_rotator_model;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* x0 holds the initial states, p0, q, and r the diagonals of the initial
+ * covariance and the noise covariances. */
+cy_en_cordic_status_t cordic_ekf_init(cordic_ekf_t *ekf, const cordic_ekf_model_t *model,
+                                      const void *params, const CY_CORDIC_Q31_t *x0,
+                                      const CY_CORDIC_Q31_t *p0, const CY_CORDIC_Q31_t *q,
+                                      const CY_CORDIC_Q31_t *r);
+/* One predict and update step. input may be NULL for models without inputs.
+ * Returns CY_CORDIC_BAD_PARAM and skips the update when the innovation
+ * covariance is not positive definite. */
+cy_en_cordic_status_t cordic_ekf_step(cordic_ekf_t *ekf, const CY_CORDIC_Q31_t *input,
+                                      const CY_CORDIC_Q31_t *measurement);
+void cordic_ekf_benchmark(void);
+
+#endif /*CORDIC_EKF_H*/
+/* [] END OF FILE */
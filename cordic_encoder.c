@@ -0,0 +1,390 @@
+/*******************************************************************************
+* File Name:   cordic_encoder.c
+*
+* Description: This file contains the sin/cos encoder interpolator.
+* Each ADC pair is corrected for offset and gain, the vectoring operation gives
+* its angle within the signal period, and a Park transform by minus that angle
+* gives its magnitude. The period count and the position are updated while the
+* peripheral computes the magnitude.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_benchmark.h"
+#include "cordic_encoder.h"
+#include "cordic_placement.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Benchmark: samples, interpolation bits, and the simulated 12-bit channels */
+#define ENCODER_BENCH_COUNT      (512U)
+#define ENCODER_BENCH_FINE_BITS  (16U)
+#define ENCODER_BENCH_PERIODS    (20.0f)
+#define ENCODER_BENCH_SIN_OFFSET (2085)
+#define ENCODER_BENCH_SIN_AMPL   (1800)
+#define ENCODER_BENCH_COS_OFFSET (2027)
+#define ENCODER_BENCH_COS_AMPL   (1950)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static CY_CORDIC_Q31_t encoder_correct(uint16_t adc, int32_t offset, int32_t gain);
+static void            encoder_float(const uint16_t *adc_sin, const uint16_t *adc_cos,
+                                     uint32_t *position, float32_t *magnitude, uint32_t count);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark samples and results */
+static uint16_t        encoder_bench_sin[ENCODER_BENCH_COUNT];
+static uint16_t        encoder_bench_cos[ENCODER_BENCH_COUNT];
+static uint32_t        encoder_bench_true[ENCODER_BENCH_COUNT];
+static uint32_t        encoder_bench_position[ENCODER_BENCH_COUNT];
+static CY_CORDIC_Q31_t encoder_bench_magnitude[ENCODER_BENCH_COUNT];
+static uint32_t        encoder_float_position[ENCODER_BENCH_COUNT];
+static float32_t       encoder_float_magnitude[ENCODER_BENCH_COUNT];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_encoder_init
+********************************************************************************
+* Summary:
+* Initializes an encoder for a 12-bit ADC with the nominal offset of half the
+* range and an amplitude of the full range, until cordic_encoder_calibrate()
+* sets the measured values. The first sample is placed within half a period of
+* position 0.
+*
+* Parameters:
+*  cordic_encoder_t *encoder  Encoder state
+*  uint32_t fine_bits         Interpolation bits per signal period
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL pointer or fine_bits
+*                         out of range
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_encoder_init(cordic_encoder_t *encoder, uint32_t fine_bits)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+
+    if ((NULL != encoder) && (fine_bits >= CORDIC_ENCODER_FINE_BITS_MIN) &&
+        (fine_bits <= CORDIC_ENCODER_FINE_BITS_MAX))
+    {
+        encoder->fine_bits = fine_bits;
+        cordic_angle_unwrap_init(&encoder->unwrap);
+        status             = cordic_encoder_calibrate(encoder, 0U, 4095U, 0U, 4095U);
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_encoder_calibrate
+********************************************************************************
+* Summary:
+* Sets the offset and gain correction from the extremes of both channels,
+* for example recorded over one signal period at low speed.
+*
+* Parameters:
+*  cordic_encoder_t *encoder  Encoder state
+*  uint16_t sin_min           Smallest sine channel sample
+*  uint16_t sin_max           Largest sine channel sample
+*  uint16_t cos_min           Smallest cosine channel sample
+*  uint16_t cos_max           Largest cosine channel sample
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL pointer or an empty range
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_encoder_calibrate(cordic_encoder_t *encoder,
+                                               uint16_t sin_min, uint16_t sin_max,
+                                               uint16_t cos_min, uint16_t cos_max)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+
+    if ((NULL != encoder) && (sin_max > sin_min) && (cos_max > cos_min))
+    {
+        encoder->sin_offset = (int32_t)sin_max + (int32_t)sin_min;
+        encoder->cos_offset = (int32_t)cos_max + (int32_t)cos_min;
+        encoder->sin_gain   = CORDIC_ENCODER_AMPLITUDE / ((int32_t)sin_max - (int32_t)sin_min);
+        encoder->cos_gain   = CORDIC_ENCODER_AMPLITUDE / ((int32_t)cos_max - (int32_t)cos_min);
+        status              = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: encoder_correct
+********************************************************************************
+* Summary:
+* Offset and gain correction of one channel, saturated to Q31.
+*
+* Parameters:
+*  uint16_t adc    ADC sample
+*  int32_t offset  Twice the offset
+*  int32_t gain    Gain from twice the ADC counts to CORDIC_ENCODER_AMPLITUDE
+*
+* Return:
+*  CY_CORDIC_Q31_t Corrected sample
+*
+*******************************************************************************/
+static CY_CORDIC_Q31_t encoder_correct(uint16_t adc, int32_t offset, int32_t gain)
+{
+    int64_t value = ((2 * (int64_t)adc) - offset) * gain;
+
+    return (value > INT32_MAX) ? INT32_MAX : ((value < -INT32_MAX) ? -INT32_MAX : (CY_CORDIC_Q31_t)value);
+}
+
+/*******************************************************************************
+* Function Name: cordic_encoder_process
+********************************************************************************
+* Summary:
+* Interpolates a buffer of ADC pairs. cordic_angle_polar_start() gives the
+* angle and starts the magnitude rotation, or cordic_angle_vector() gives the
+* angle alone. An angle step that crosses zero counts one period up or down,
+* so the encoder may move less than half a period per sample. A pair below
+* the vectoring resolution holds the position.
+*
+* Parameters:
+*  cordic_encoder_t *encoder   Encoder state
+*  const uint16_t *adc_sin     Sine channel samples
+*  const uint16_t *adc_cos     Cosine channel samples
+*  uint32_t *position          Positions
+*  CY_CORDIC_Q31_t *magnitude  Magnitudes, or NULL
+*  uint32_t count              Number of samples
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_encoder_process(cordic_encoder_t *encoder,
+                                             const uint16_t *adc_sin,
+                                             const uint16_t *adc_cos,
+                                             uint32_t *position,
+                                             CY_CORDIC_Q31_t *magnitude,
+                                             uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    CY_CORDIC_Q31_t s     = 0;
+    CY_CORDIC_Q31_t c     = 0;
+    uint32_t        angle = 0;
+    bool            valid = false;
+    uint32_t        i     = 0;
+
+    if ((NULL != encoder) && (NULL != adc_sin) && (NULL != adc_cos) && (NULL != position))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (i = 0U; i < count; i++)
+        {
+            s     = encoder_correct(adc_sin[i], encoder->sin_offset, encoder->sin_gain);
+            c     = encoder_correct(adc_cos[i], encoder->cos_offset, encoder->cos_gain);
+            angle = encoder->unwrap.last;
+            valid = false;
+
+            if (NULL != magnitude)
+            {
+                valid = cordic_angle_polar_start(c, s, &angle);
+            }
+            else
+            {
+                angle = cordic_angle_vector(c, s, angle);
+            }
+
+            /* Period tracking while the peripheral is busy. The unwrapped
+             * angle counts one period as 2^32, so its upper bits are the
+             * periods and the fine bits follow below them. */
+            position[i] = (uint32_t)((uint64_t)cordic_angle_unwrap(&encoder->unwrap, angle) >>
+                                     (32U - encoder->fine_bits));
+
+            if (NULL != magnitude)
+            {
+                magnitude[i] = valid ? cordic_angle_polar_result() : 0;
+            }
+        }
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: encoder_float
+********************************************************************************
+* Summary:
+* Floating-point reference with the same correction and period tracking,
+* atan2f(), and sqrtf(), for the benchmark calibration.
+*
+* Parameters:
+*  const uint16_t *adc_sin  Sine channel samples
+*  const uint16_t *adc_cos  Cosine channel samples
+*  uint32_t *position       Positions
+*  float32_t *magnitude     Magnitudes, 1.0 = calibrated amplitude
+*  uint32_t count           Number of samples
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void encoder_float(const uint16_t *adc_sin, const uint16_t *adc_cos,
+                          uint32_t *position, float32_t *magnitude, uint32_t count)
+{
+    float32_t s       = 0.0f;
+    float32_t c       = 0.0f;
+    float32_t angle   = 0.0f;
+    float32_t last    = 0.0f;
+    int32_t   periods = 0;
+    uint32_t  i       = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        s     = ((float32_t)adc_sin[i] - (float32_t)ENCODER_BENCH_SIN_OFFSET) / (float32_t)ENCODER_BENCH_SIN_AMPL;
+        c     = ((float32_t)adc_cos[i] - (float32_t)ENCODER_BENCH_COS_OFFSET) / (float32_t)ENCODER_BENCH_COS_AMPL;
+        angle = atan2f(s, c) / (2.0f * PI);
+
+        if (0U == i)
+        {
+            periods = (angle < 0.0f) ? -1 : 0;
+        }
+        angle = (angle < 0.0f) ? (angle + 1.0f) : angle;
+        if (0U != i)
+        {
+            periods += ((angle - last) < -0.5f) ? 1 : (((angle - last) > 0.5f) ? -1 : 0);
+        }
+        last = angle;
+
+        position[i]  = ((uint32_t)periods << ENCODER_BENCH_FINE_BITS) +
+                       (uint32_t)(angle * (float32_t)(1UL << ENCODER_BENCH_FINE_BITS));
+        magnitude[i] = sqrtf((s * s) + (c * c));
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_encoder_benchmark
+********************************************************************************
+* Summary:
+* Interpolates a simulated 12-bit sin/cos encoder with offset and gain
+* mismatch that moves back and forth over 20 periods at up to a quarter period
+* per sample, with the CORDIC and with the floating-point reference. Prints the
+* cycles per sample, the sustainable sample rate, and the position error
+* against the simulated motion.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_encoder_benchmark(void)
+{
+    cordic_encoder_t encoder;
+    float32_t phase   = 0.0f;
+    uint32_t  start   = 0;
+    uint32_t  cordic  = 0;
+    uint32_t  library = 0;
+    int32_t   error   = 0;
+    int32_t   error_f = 0;
+    int32_t   delta   = 0;
+    float32_t ampl    = 0.0f;
+    uint32_t  i       = 0;
+
+    for (i = 0U; i < ENCODER_BENCH_COUNT; i++)
+    {
+        phase = ENCODER_BENCH_PERIODS * sinf((2.0f * PI * (float32_t)i) / (float32_t)ENCODER_BENCH_COUNT);
+        encoder_bench_sin[i]  = (uint16_t)lroundf((float32_t)ENCODER_BENCH_SIN_OFFSET +
+                                                  ((float32_t)ENCODER_BENCH_SIN_AMPL * sinf(2.0f * PI * phase)));
+        encoder_bench_cos[i]  = (uint16_t)lroundf((float32_t)ENCODER_BENCH_COS_OFFSET +
+                                                  ((float32_t)ENCODER_BENCH_COS_AMPL * cosf(2.0f * PI * phase)));
+        encoder_bench_true[i] = (uint32_t)(int32_t)lroundf(phase * (float32_t)(1UL << ENCODER_BENCH_FINE_BITS));
+    }
+
+    (void)cordic_encoder_init(&encoder, ENCODER_BENCH_FINE_BITS);
+    (void)cordic_encoder_calibrate(&encoder,
+                                   ENCODER_BENCH_SIN_OFFSET - ENCODER_BENCH_SIN_AMPL,
+                                   ENCODER_BENCH_SIN_OFFSET + ENCODER_BENCH_SIN_AMPL,
+                                   ENCODER_BENCH_COS_OFFSET - ENCODER_BENCH_COS_AMPL,
+                                   ENCODER_BENCH_COS_OFFSET + ENCODER_BENCH_COS_AMPL);
+
+    start  = cordic_benchmark_get_cycles();
+    for (i = 0U; i < ENCODER_BENCH_COUNT; i++)
+    {
+        /* One pair per call, as from the ADC interrupt */
+        (void)cordic_encoder_process(&encoder, &encoder_bench_sin[i], &encoder_bench_cos[i],
+                                     &encoder_bench_position[i], &encoder_bench_magnitude[i], 1U);
+    }
+    cordic = cordic_benchmark_get_cycles() - start;
+
+    start   = cordic_benchmark_get_cycles();
+    encoder_float(encoder_bench_sin, encoder_bench_cos, encoder_float_position,
+                  encoder_float_magnitude, ENCODER_BENCH_COUNT);
+    library = cordic_benchmark_get_cycles() - start;
+
+    for (i = 0U; i < ENCODER_BENCH_COUNT; i++)
+    {
+        delta   = (int32_t)(encoder_bench_position[i] - encoder_bench_true[i]);
+        error   = (((delta < 0) ? -delta : delta) > error) ? ((delta < 0) ? -delta : delta) : error;
+        delta   = (int32_t)(encoder_float_position[i] - encoder_bench_true[i]);
+        error_f = (((delta < 0) ? -delta : delta) > error_f) ? ((delta < 0) ? -delta : delta) : error_f;
+        ampl    = fmaxf(ampl, fabsf(((float32_t)encoder_bench_magnitude[i] / (float32_t)CORDIC_ENCODER_AMPLITUDE) -
+                                    encoder_float_magnitude[i]));
+    }
+
+    cordic  = (0U != cordic) ? cordic : 1U;
+    library = (0U != library) ? library : 1U;
+
+    printf("\r\n%u samples, %u interpolation bits per period\r\n",
+           (unsigned int)ENCODER_BENCH_COUNT, (unsigned int)ENCODER_BENCH_FINE_BITS);
+    printf("Method          | cycles/sample | samples/s | max position error\r\n");
+    printf("CORDIC          | %13u | %9u | %u\r\n", (unsigned int)(cordic / ENCODER_BENCH_COUNT),
+           (unsigned int)(((uint64_t)SystemCoreClock * ENCODER_BENCH_COUNT) / cordic), (unsigned int)error);
+    printf("atan2f + sqrtf  | %13u | %9u | %u\r\n", (unsigned int)(library / ENCODER_BENCH_COUNT),
+           (unsigned int)(((uint64_t)SystemCoreClock * ENCODER_BENCH_COUNT) / library), (unsigned int)error_f);
+    printf("Maximum magnitude deviation: %.2e of the calibrated amplitude\r\n", (double)ampl);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,93 @@
+/*******************************************************************************
+* File Name:   cordic_encoder.h
+*
+* Description: This header file contains the interface to the sin/cos
+* encoder interpolator. It corrects the offset and gain of the two ADC channels,
+* takes the angle and magnitude of the corrected pair on the CORDIC, and counts
+* the signal periods into a 32-bit position.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_ENCODER_H
+#define CORDIC_ENCODER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "cordic_angle.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Range of the number of interpolation bits per signal period */
+#define CORDIC_ENCODER_FINE_BITS_MIN   (8U)
+#define CORDIC_ENCODER_FINE_BITS_MAX   (24U)
+
+/* Corrected signal amplitude in Q31, also the magnitude unit */
+#define CORDIC_ENCODER_AMPLITUDE       (1L << 29)
+
+/* State of one encoder */
+typedef struct
+{
+    int32_t  sin_offset;     /* Twice the ADC offset of the sine channel */
+    int32_t  cos_offset;     /* Twice the ADC offset of the cosine channel */
+    int32_t  sin_gain;       /* Gain from twice the ADC counts to CORDIC_ENCODER_AMPLITUDE */
+    int32_t  cos_gain;       /* Gain from twice the ADC counts to CORDIC_ENCODER_AMPLITUDE */
+    uint32_t fine_bits;      /* Interpolation bits per signal period */
+    cordic_angle_unwrap_t unwrap;    /* Unwrapped angle, one period = 2^32 */
+} cordic_encoder_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_en_cordic_status_t cordic_encoder_init(cordic_encoder_t *encoder, uint32_t fine_bits);
+cy_en_cordic_status_t cordic_encoder_calibrate(cordic_encoder_t *encoder,
+                                               uint16_t sin_min, uint16_t sin_max,
+                                               uint16_t cos_min, uint16_t cos_max);
+/* position receives the periods in the upper and the interpolated angle in the
+ * lower fine_bits bits, wrapping. magnitude receives the corrected signal
+ * magnitude, CORDIC_ENCODER_AMPLITUDE = calibrated amplitude, and may be NULL. */
+cy_en_cordic_status_t cordic_encoder_process(cordic_encoder_t *encoder,
+                                             const uint16_t *adc_sin,
+                                             const uint16_t *adc_cos,
+                                             uint32_t *position,
+                                             CY_CORDIC_Q31_t *magnitude,
+                                             uint32_t count);
+void cordic_encoder_benchmark(void);
+
+#endif /*CORDIC_ENCODER_H*/
+/* [] END OF FILE */
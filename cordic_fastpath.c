@@ -0,0 +1,433 @@
+/*******************************************************************************
+* File Name:   cordic_fastpath.c
+*
+* Description: This file contains the fast paths placed ahead of the CORDIC
+* peripheral. A branch-light classification catches tiny angles, zero, +/-90
+* degrees and exact powers of four and answers them inline; all other operands
+* are passed to the peripheral. The file also contains the benchmark measuring
+* the saving per hit and the overhead per miss.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "arm_math.h"
+#include "cordic_benchmark.h"
+#include "cordic_fastpath.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* pi in Q29, converts a Q31 binary angle to Q31 radians */
+#define CORDIC_FAST_PI_Q29         (1686629713LL)
+
+/* Shifts converting angle * pi (Q29) to the Q31, 1Q30 and 20Q11 results */
+#define CORDIC_FAST_SHIFT_Q31      (29U)
+#define CORDIC_FAST_SHIFT_1Q30     (30U)
+#define CORDIC_FAST_SHIFT_20Q11    (49U)
+
+/* Rounding constant for a right shift by n */
+#define CORDIC_FAST_ROUND(n)       (1LL << ((n) - 1U))
+
+/* Number of operands per benchmark set */
+#define CORDIC_FAST_BENCH_OPERANDS (64U)
+
+/* Range of the benchmark angles passed to the peripheral: 1 to 60 degrees */
+#define CORDIC_FAST_BENCH_ANGLE_MIN  (11930465UL)
+#define CORDIC_FAST_BENCH_ANGLE_SPAN (703897417UL)
+
+/* Benchmark operation: a direct peripheral call and the fast-path call */
+typedef struct
+{
+    const char *name;
+    int32_t (*direct)(int32_t operand);
+    int32_t (*fast)(int32_t operand);
+    bool    sqrt_operands;
+    bool    quarter_turns;    /* +/-90 degrees are in the range of the operation */
+} cordic_fast_bench_op_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int32_t bench_direct_sin(int32_t operand);
+static int32_t bench_direct_tan(int32_t operand);
+static int32_t bench_direct_sinh(int32_t operand);
+static int32_t bench_direct_sqrt(int32_t operand);
+static int32_t bench_fast_sin(int32_t operand);
+static int32_t bench_fast_tan(int32_t operand);
+static int32_t bench_fast_sinh(int32_t operand);
+static int32_t bench_fast_sqrt(int32_t operand);
+static uint32_t bench_cycles(int32_t (*func)(int32_t), const int32_t *operands);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Operations covered by the benchmark */
+static const cordic_fast_bench_op_t cordic_fast_bench_ops[] =
+{
+    {"sin",  bench_direct_sin,  bench_fast_sin,  false, true},
+    {"tan",  bench_direct_tan,  bench_fast_tan,  false, true},
+    {"sinh", bench_direct_sinh, bench_fast_sinh, false, false},
+    {"sqrt", bench_direct_sqrt, bench_fast_sqrt, true,  false},
+};
+
+/* Operand sets answered by the fast path and passed to the peripheral */
+static int32_t cordic_fast_hit_operands[CORDIC_FAST_BENCH_OPERANDS];
+static int32_t cordic_fast_miss_operands[CORDIC_FAST_BENCH_OPERANDS];
+
+/* Keeps the benchmark results alive */
+static volatile int32_t cordic_fast_bench_sink;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_fast_sin
+********************************************************************************
+* Summary:
+* Sine with fast paths. Tiny angles return x, +/-90 degrees return the
+* saturated +/-1, all other angles are calculated by the CORDIC.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t angle  Q31 binary angle
+*
+* Return:
+*  CY_CORDIC_Q31_t        Sine in Q31
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+CY_CORDIC_Q31_t cordic_fast_sin(CY_CORDIC_Q31_t angle)
+{
+    CY_CORDIC_Q31_t result  = 0;
+    bool            tiny    = cordic_fast_is_tiny(angle, CORDIC_FAST_TINY_ANGLE);
+    bool            quarter = cordic_fast_is_quarter(angle);
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_SIN, 1U, angle, 0, 0);
+
+    /* A single test keeps the common path free of further branches */
+    if (tiny || quarter)
+    {
+        result = tiny ? (CY_CORDIC_Q31_t)((((int64_t)angle * CORDIC_FAST_PI_Q29) + CORDIC_FAST_ROUND(CORDIC_FAST_SHIFT_Q31)) >> CORDIC_FAST_SHIFT_Q31)
+                      : (CY_CORDIC_Q31_t)(INT32_MAX ^ (angle >> 31));
+    }
+    else
+    {
+        result = Cy_CORDIC_Sin(MXCORDIC, angle);
+    }
+
+    return result;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_fast_cos
+********************************************************************************
+* Summary:
+* Cosine with fast paths. Angles below 2^-16 rad return the Q31 maximum,
+* +/-90 degrees return zero, all other angles are calculated by the CORDIC.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t angle  Q31 binary angle
+*
+* Return:
+*  CY_CORDIC_Q31_t        Cosine in Q31
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+CY_CORDIC_Q31_t cordic_fast_cos(CY_CORDIC_Q31_t angle)
+{
+    CY_CORDIC_Q31_t result  = 0;
+    bool            tiny    = cordic_fast_is_tiny(angle, CORDIC_FAST_TINY_COS_ANGLE);
+    bool            quarter = cordic_fast_is_quarter(angle);
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_COS, 1U, angle, 0, 0);
+
+    if (tiny || quarter)
+    {
+        result = tiny ? INT32_MAX : 0;
+    }
+    else
+    {
+        result = Cy_CORDIC_Cos(MXCORDIC, angle);
+    }
+
+    return result;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_fast_tan
+********************************************************************************
+* Summary:
+* Tangent with fast path. Tiny angles return x, all other angles are
+* calculated by the CORDIC.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t angle  Q31 binary angle
+*
+* Return:
+*  CY_CORDIC_20Q11_t      Tangent in 20Q11
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+CY_CORDIC_20Q11_t cordic_fast_tan(CY_CORDIC_Q31_t angle)
+{
+    CY_CORDIC_20Q11_t result = 0;
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_TAN, 1U, angle, 0, 0);
+
+    if (cordic_fast_is_tiny(angle, CORDIC_FAST_TINY_ANGLE))
+    {
+        result = (CY_CORDIC_20Q11_t)((((int64_t)angle * CORDIC_FAST_PI_Q29) + CORDIC_FAST_ROUND(CORDIC_FAST_SHIFT_20Q11)) >> CORDIC_FAST_SHIFT_20Q11);
+    }
+    else
+    {
+        result = Cy_CORDIC_Tan(MXCORDIC, angle);
+    }
+
+    return result;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_fast_sinh
+********************************************************************************
+* Summary:
+* Hyperbolic sine with fast path. Tiny angles return x, all other angles are
+* calculated by the CORDIC.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t angle  Q31 binary angle
+*
+* Return:
+*  CY_CORDIC_1Q30_t       Hyperbolic sine in 1Q30
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+CY_CORDIC_1Q30_t cordic_fast_sinh(CY_CORDIC_Q31_t angle)
+{
+    CY_CORDIC_1Q30_t result = 0;
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_SINH, 1U, angle, 0, 0);
+
+    if (cordic_fast_is_tiny(angle, CORDIC_FAST_TINY_ANGLE))
+    {
+        result = (CY_CORDIC_1Q30_t)((((int64_t)angle * CORDIC_FAST_PI_Q29) + CORDIC_FAST_ROUND(CORDIC_FAST_SHIFT_1Q30)) >> CORDIC_FAST_SHIFT_1Q30);
+    }
+    else
+    {
+        result = Cy_CORDIC_Sinh(MXCORDIC, angle);
+    }
+
+    return result;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_fast_sqrt
+********************************************************************************
+* Summary:
+* Square root with fast path. Zero and exact powers of four return the exact
+* power of two, all other values are calculated by the CORDIC.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t value  Q31 value between 0 and 1
+*
+* Return:
+*  CY_CORDIC_Q31_t        Square root in Q31
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+CY_CORDIC_Q31_t cordic_fast_sqrt(CY_CORDIC_Q31_t value)
+{
+    CY_CORDIC_Q31_t result = 0;
+    uint32_t        u      = (uint32_t)value;
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_SQRT, 1U, value, 0, 0);
+
+    if (cordic_fast_is_power_of_four(value))
+    {
+        /* sqrt(2^(e - 31)) = 2^((e + 31) / 2 - 31) with e = 31 - CLZ, zero stays zero */
+        result = (CY_CORDIC_Q31_t)((uint32_t)(0U != u) << ((62U - (uint32_t)__CLZ(u)) >> 1U));
+    }
+    else
+    {
+        result = (CY_CORDIC_Q31_t)Cy_CORDIC_Sqrt(MXCORDIC, value);
+    }
+
+    return result;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: bench_direct_sin, bench_direct_tan, bench_direct_sinh,
+*                bench_direct_sqrt, bench_fast_sin, bench_fast_tan,
+*                bench_fast_sinh, bench_fast_sqrt
+********************************************************************************
+* Summary:
+* Adapters giving the direct peripheral calls and the fast-path calls the same
+* signature for the benchmark.
+*
+* Parameters:
+*  int32_t operand  Operand
+*
+* Return:
+*  int32_t          Result
+*
+*******************************************************************************/
+static int32_t bench_direct_sin(int32_t operand)  { return Cy_CORDIC_Sin(MXCORDIC, operand); }
+static int32_t bench_direct_tan(int32_t operand)  { return Cy_CORDIC_Tan(MXCORDIC, operand); }
+static int32_t bench_direct_sinh(int32_t operand) { return Cy_CORDIC_Sinh(MXCORDIC, operand); }
+static int32_t bench_direct_sqrt(int32_t operand) { return (int32_t)Cy_CORDIC_Sqrt(MXCORDIC, operand); }
+static int32_t bench_fast_sin(int32_t operand)    { return cordic_fast_sin(operand); }
+static int32_t bench_fast_tan(int32_t operand)    { return cordic_fast_tan(operand); }
+static int32_t bench_fast_sinh(int32_t operand)   { return cordic_fast_sinh(operand); }
+static int32_t bench_fast_sqrt(int32_t operand)   { return cordic_fast_sqrt(operand); }
+
+/*******************************************************************************
+* Function Name: bench_cycles
+********************************************************************************
+* Summary:
+* Measures the average cycles of one call over an operand set.
+*
+* Parameters:
+*  int32_t (*func)(int32_t)  Function to measure
+*  const int32_t *operands   CORDIC_FAST_BENCH_OPERANDS operands
+*
+* Return:
+*  uint32_t                  Cycles per call
+*
+*******************************************************************************/
+static uint32_t bench_cycles(int32_t (*func)(int32_t), const int32_t *operands)
+{
+    uint32_t start = 0;
+    uint32_t i     = 0;
+    int32_t  acc   = 0;
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < CORDIC_FAST_BENCH_OPERANDS; i++)
+    {
+        acc += func(operands[i]);
+    }
+    start = cordic_benchmark_get_cycles() - start;
+
+    cordic_fast_bench_sink = acc;
+
+    return start / CORDIC_FAST_BENCH_OPERANDS;
+}
+
+/*******************************************************************************
+* Function Name: cordic_fast_benchmark
+********************************************************************************
+* Summary:
+* Measures the cycles of the direct peripheral call and of the fast-path call
+* on operands answered inline (hit) and operands passed to the peripheral
+* (miss). From these the saving per hit, the overhead per miss and the hit rate
+* above which the fast path pays off are printed. The hit rate of real operand
+* streams is reported by the trace replay.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_fast_benchmark(void)
+{
+    uint32_t op        = 0;
+    uint32_t i         = 0;
+    uint32_t seed      = 0x12345678UL;
+    uint32_t direct    = 0;
+    uint32_t fast_hit  = 0;
+    uint32_t fast_miss = 0;
+    int32_t  saving    = 0;
+    int32_t  overhead  = 0;
+
+    printf("\r\noperation | direct | fast hit | fast miss | saving/hit | overhead/miss | break-even hit rate\r\n");
+
+    for (op = 0U; op < (sizeof(cordic_fast_bench_ops) / sizeof(cordic_fast_bench_ops[0])); op++)
+    {
+        for (i = 0U; i < CORDIC_FAST_BENCH_OPERANDS; i++)
+        {
+            seed = (seed * 1664525UL) + 1013904223UL;
+
+            if (cordic_fast_bench_ops[op].sqrt_operands)
+            {
+                /* Powers of four between 4^-15 and 1/4, and values in (1/16, 1) */
+                cordic_fast_hit_operands[i]  = (int32_t)(1UL << (1U + (2U * (i % 15U))));
+                cordic_fast_miss_operands[i] = (int32_t)((seed >> 1) | 0x08000000UL);
+            }
+            else
+            {
+                /* Tiny angles and, where in range, +/-90 degrees, and angles
+                 * between 1 and 60 degrees. Sinh is limited to +/-60 degrees. */
+                cordic_fast_hit_operands[i]  = ((0U == (i & 7U)) && cordic_fast_bench_ops[op].quarter_turns) ?
+                                               (int32_t)(0x40000000UL ^ (seed & 0x80000000UL)) :
+                                               (((int32_t)seed) >> 13);
+                cordic_fast_miss_operands[i] = (int32_t)(CORDIC_FAST_BENCH_ANGLE_MIN + ((seed >> 1) % CORDIC_FAST_BENCH_ANGLE_SPAN));
+                cordic_fast_miss_operands[i] = (0U != (seed & 1U)) ? -cordic_fast_miss_operands[i]
+                                                                   : cordic_fast_miss_operands[i];
+            }
+        }
+
+        direct    = bench_cycles(cordic_fast_bench_ops[op].direct, cordic_fast_miss_operands);
+        fast_hit  = bench_cycles(cordic_fast_bench_ops[op].fast, cordic_fast_hit_operands);
+        fast_miss = bench_cycles(cordic_fast_bench_ops[op].fast, cordic_fast_miss_operands);
+        saving    = (int32_t)direct - (int32_t)fast_hit;
+        overhead  = (int32_t)fast_miss - (int32_t)direct;
+
+        printf("%9s | %6u | %8u | %9u | %10d | %13d | ",
+               cordic_fast_bench_ops[op].name, (unsigned int)direct, (unsigned int)fast_hit,
+               (unsigned int)fast_miss, (int)saving, (int)overhead);
+
+        if (overhead <= 0)
+        {
+            printf("any\r\n");
+        }
+        else
+        {
+            printf("%.2f %%\r\n", (100.0 * (float64_t)overhead) / (float64_t)(saving + overhead));
+        }
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,136 @@
+/*******************************************************************************
+* File Name:   cordic_fastpath.h
+*
+* Description: This header file contains the interface to the fast paths placed
+* ahead of the CORDIC peripheral. Operands for which a shift or an identity
+* gives the exact fixed-point result are answered inline without a peripheral
+* round trip.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_FASTPATH_H
+#define CORDIC_FASTPATH_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* 2^-11 rad as Q31 binary angle. Below it sin(x), tan(x) and sinh(x) equal x
+ * within one LSB of their result formats. */
+#define CORDIC_FAST_TINY_ANGLE     (333772U)
+
+/* 2^-16 rad as Q31 binary angle. Below it cos(x) rounds to the Q31 maximum. */
+#define CORDIC_FAST_TINY_COS_ANGLE (10430U)
+
+/* Q31 binary angle of +/-pi/2 shifted left by one */
+#define CORDIC_FAST_QUARTER_SHL1   (0x80000000U)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+/*******************************************************************************
+* Function Name: cordic_fast_is_tiny
+********************************************************************************
+* Summary:
+* Checks if |angle| is below the given limit. Zero is included.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t angle  Q31 binary angle
+*  uint32_t limit         Limit as Q31 binary angle
+*
+* Return:
+*  bool                   true if the angle is below the limit
+*
+*******************************************************************************/
+__STATIC_INLINE bool cordic_fast_is_tiny(CY_CORDIC_Q31_t angle, uint32_t limit)
+{
+    return (((uint32_t)angle + limit) < (2U * limit));
+}
+
+/*******************************************************************************
+* Function Name: cordic_fast_is_quarter
+********************************************************************************
+* Summary:
+* Checks if the angle is exactly +90 or -90 degrees.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t angle  Q31 binary angle
+*
+* Return:
+*  bool                   true for +/-pi/2
+*
+*******************************************************************************/
+__STATIC_INLINE bool cordic_fast_is_quarter(CY_CORDIC_Q31_t angle)
+{
+    return (CORDIC_FAST_QUARTER_SHL1 == ((uint32_t)angle << 1U));
+}
+
+/*******************************************************************************
+* Function Name: cordic_fast_is_power_of_four
+********************************************************************************
+* Summary:
+* Checks if a non-negative Q31 value is zero or an exact power of four, for
+* which the square root is an exact power of two.
+*
+* Parameters:
+*  CY_CORDIC_Q31_t value  Q31 value
+*
+* Return:
+*  bool                   true for zero and powers of four
+*
+*******************************************************************************/
+__STATIC_INLINE bool cordic_fast_is_power_of_four(CY_CORDIC_Q31_t value)
+{
+    uint32_t u = (uint32_t)value;
+
+    /* 2^e represents 4^-m in Q31 when e is odd, that is when CLZ is even */
+    return ((0 <= value) && (0U == (u & (u - 1U))) && (0U == (__CLZ(u) & 1U)));
+}
+
+CY_CORDIC_Q31_t   cordic_fast_sin(CY_CORDIC_Q31_t angle);
+CY_CORDIC_Q31_t   cordic_fast_cos(CY_CORDIC_Q31_t angle);
+CY_CORDIC_20Q11_t cordic_fast_tan(CY_CORDIC_Q31_t angle);
+CY_CORDIC_1Q30_t  cordic_fast_sinh(CY_CORDIC_Q31_t angle);
+CY_CORDIC_Q31_t   cordic_fast_sqrt(CY_CORDIC_Q31_t value);
+void cordic_fast_benchmark(void);
+
+#endif /*CORDIC_FASTPATH_H*/
+/* [] END OF FILE */
@@ -51,6 +51,8 @@
 #include "arm_math.h"
 #include "cy_retarget_io.h"
 #include "cordic_functions.h"
+#include "cordic_benchmark.h"
+#include "cordic_trace.h"
 
 /******************************************************************************
 * Macros
@@ -67,7 +69,9 @@ typedef enum Ifx_CORDIC_functions
     Ifx_CORDIC_HYP_COSINE   = 6,
     Ifx_CORDIC_HYP_TAN      = 7,
     Ifx_CORDIC_HYP_ARC_TAN  = 8,
-    Ifx_CORDIC_SQRT         = 9
+    Ifx_CORDIC_SQRT         = 9,
+    Ifx_CORDIC_BENCHMARKS   = 10,
+    Ifx_CORDIC_TRACE_DUMP   = 11
 }Ifx_CORDIC_functions;
 
 /* Multiplier for Q format conversion */
@@ -175,6 +179,9 @@ cy_en_cordic_status_t check_range(float32_t low_limit,
 *******************************************************************************/
 void run_cordic_functions()
 {
+    /* Cycle counter for the trace timestamps and the benchmarks */
+    cordic_benchmark_init();
+
     /* Clear screen */
     printf("\x1b[2J\x1b[;H");
 
@@ -193,10 +200,18 @@ void run_cordic_functions()
         printf("7 - hyperbolic tangent \r\n");
         printf("8 - hyperbolic arc tangent \r\n");
         printf("9 - square root \r\n");
+        printf("10 - benchmarks \r\n");
+        printf("11 - dump operand trace \r\n");
         printf(">> \r\n");
 
         read_status = scanf("%120s", read_string);
 
+        /* End of input, only seen when the host build is driven by a script */
+        if(EOF == read_status)
+        {
+            break;
+        }
+
         if(0 < read_status)
         {
             cordic_function = (Ifx_CORDIC_functions)atoi((const char *)read_string);
@@ -264,6 +279,18 @@ void run_cordic_functions()
             }
             break;
 
+            case Ifx_CORDIC_BENCHMARKS:
+            {
+                run_cordic_benchmarks(); /* Benchmark menu */
+            }
+            break;
+
+            case Ifx_CORDIC_TRACE_DUMP:
+            {
+                cordic_trace_dump(); /* Operand trace for the host replay */
+            }
+            break;
+
             default:
             {
                 /* A value which is not present in the list is entered. */
@@ -386,6 +413,7 @@ void park_transform()
                             i_beta_q31  = FLOAT_TO_Q31(ibeta);
 
                             /* Starting park transform using CORDIC */
+                            CORDIC_TRACE(CORDIC_TRACE_OP_PARK, 3U, angle_q31, i_alpha_q31, i_beta_q31);
                             Cy_CORDIC_ParkTransformNB(MXCORDIC,
                                                       angle_q31,
                                                       i_alpha_q31,
@@ -476,6 +504,7 @@ void sine ()
             angle_q31 = FLOAT_DEG_TO_RAD_Q31(angle_deg);
 
             /* Calculating sine using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_SIN, 1U, angle_q31, 0, 0);
             result_q31 = Cy_CORDIC_Sin(MXCORDIC,
                                        angle_q31);
 
@@ -531,6 +560,7 @@ void cosine()
             angle_q31 = FLOAT_DEG_TO_RAD_Q31(angle_deg);
 
             /* Calculating cosine using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_COS, 1U, angle_q31, 0, 0);
             result_q31 = Cy_CORDIC_Cos(MXCORDIC,
                                        angle_q31);
 
@@ -586,6 +616,7 @@ void tangent()
             angle_q31 = FLOAT_DEG_TO_RAD_Q31(angle_deg);
 
             /* Calculating tangent using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_TAN, 1U, angle_q31, 0, 0);
             result_20q11 = Cy_CORDIC_Tan(MXCORDIC,
                                          angle_q31);
 
@@ -644,6 +675,7 @@ void arc_tangent()
             denominator_8q23 = FLOAT_TO_Q8_23(denominator);
 
             /* Calculating arc tangent using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_ARCTAN, 2U, denominator_8q23, numerator_8q23, 0);
             result_q31 = Cy_CORDIC_ArcTan(MXCORDIC,
                                           denominator_8q23,
                                           numerator_8q23);
@@ -707,6 +739,7 @@ void hyperbolic_sine()
             angle_q31 = FLOAT_DEG_TO_RAD_Q31(angle_deg);
 
             /* Calculating hyperbolic sine using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_SINH, 1U, angle_q31, 0, 0);
             result_1q30 = Cy_CORDIC_Sinh(MXCORDIC,
                                          angle_q31);
 
@@ -762,6 +795,7 @@ void hyperbolic_cosine()
             angle_q31 = FLOAT_DEG_TO_RAD_Q31(angle_deg);
 
             /* Calculating hyperbolic cosine using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_COSH, 1U, angle_q31, 0, 0);
             result_1q30 = Cy_CORDIC_Cosh(MXCORDIC,
                                          angle_q31);
 
@@ -817,6 +851,7 @@ void hyperbolic_tangent()
             angle_q31 = FLOAT_DEG_TO_RAD_Q31(angle_deg);
 
             /* Calculating hyperbolic tangent using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_TANH, 1U, angle_q31, 0, 0);
             result_20q11 = Cy_CORDIC_Tanh(MXCORDIC,
                                           angle_q31);
 
@@ -877,6 +912,7 @@ void hyperbolic_arc_tangent()
             denominator_8q23 = FLOAT_TO_Q8_23(denominator);
 
             /* Calculating hyperbolic arc tangent using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_ARCTANH, 2U, denominator_8q23, numerator_8q23, 0);
             result_q31 = Cy_CORDIC_ArcTanh(MXCORDIC,
                                            denominator_8q23,
                                            numerator_8q23);
@@ -939,6 +975,7 @@ void square_root()
             number_q31 = FLOAT_TO_Q31(number);
 
             /* Calculating square root using CORDIC */
+            CORDIC_TRACE(CORDIC_TRACE_OP_SQRT, 1U, number_q31, 0, 0);
             square_root_q31 = Cy_CORDIC_Sqrt(MXCORDIC,
                                              number_q31);
 
@@ -0,0 +1,91 @@
+/*******************************************************************************
+* File Name:   cordic_gain.h
+*
+* Description: This header file contains the gain compensation of the
+* Park transform results of the peripheral, shared by all modules that rotate
+* vectors with the CORDIC.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_GAIN_H
+#define CORDIC_GAIN_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Inverse of the circular CORDIC gain 1.646760258121 in Q31 */
+#define CORDIC_GAIN_INV_Q31     (1304065748LL)
+
+/* Fraction bits of the Park results of the peripheral */
+#define CORDIC_GAIN_Q23_SHIFT   (23U)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+
+/*******************************************************************************
+* Function Name: cordic_gain_remove
+********************************************************************************
+* Summary:
+* Converts a Park result of the peripheral from Q23 including the gain to Q31
+* without the gain, negates it for folded angles and saturates. Passing
+* value >> 31 as negate gives the magnitude.
+*
+* Parameters:
+*  int32_t value   Peripheral result in Q23
+*  int32_t negate  -1 to negate the result, 0 otherwise
+*
+* Return:
+*  int32_t         Result in Q31, limited to +/-INT32_MAX
+*
+*******************************************************************************/
+__STATIC_INLINE int32_t cordic_gain_remove(int32_t value, int32_t negate)
+{
+    int64_t result = (((int64_t)value * CORDIC_GAIN_INV_Q31) +
+                      (1LL << (CORDIC_GAIN_Q23_SHIFT - 1U))) >> CORDIC_GAIN_Q23_SHIFT;
+
+    result = (result ^ negate) - negate;
+
+    return (int32_t)((result > INT32_MAX) ? INT32_MAX : ((result < -INT32_MAX) ? -INT32_MAX : result));
+}
+
+#endif /*CORDIC_GAIN_H*/
+/* [] END OF FILE */
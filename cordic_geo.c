@@ -0,0 +1,602 @@
+/*******************************************************************************
+* File Name:   cordic_geo.c
+*
+* Description: This file contains the great-circle distance and bearing
+* kernel. The latitude terms of the geofence points are prepared once with
+* cordic_batch_rotate(). Per fix, the half differences of latitude and
+* longitude are rotated in batches, or expanded in a short series when they are
+* small. The haversine term is kept in Q62, so the distance resolution does not
+* suffer from squaring; its square root is taken on the CORDIC after an even
+* normalization shift. The bearing comes from the vectoring operation.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_batch.h"
+#include "cordic_geo.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Points per batch; each point needs up to two rotations */
+#define GEO_GROUP                (CORDIC_BATCH_CHUNK / 2U)
+
+/* Half angles below 2^27 (11.25 degrees) use the series, which covers the
+ * half differences of points within 800 km up to 70 degrees of latitude. The
+ * next terms of the series, x^9 / 362880 and x^8 / 40320, are below 2^-32. */
+#define GEO_SMALL_ANGLE          (1L << 27)
+
+/* pi in Q29: Q31 binary angles to radians in Q31 */
+#define GEO_PI_Q29               (1686629713LL)
+
+/* Central half angles with a sine below 1/8 (about 1600 km) use the arcsine
+ * series instead of the vectoring operation. The next term, 35 s^9 / 1152, is
+ * below 3 mm on the earth's surface. */
+#define GEO_NEAR_LIMIT           (1L << 28)
+
+/* pi times the earth radius in centimetres: distance of a central half angle
+ * in Q31 binary angle units, Q30 */
+#define GEO_PI_RADIUS_CM         (2001511444LL)
+
+/* One in Q62 */
+#define GEO_ONE_Q62              (1LL << 62)
+
+/* Shift from Q31 values to 8Q23 vectoring operands, with headroom for the gain */
+#define GEO_VECTOR_SHIFT         (2U)
+
+/* Benchmark: geofence points per set, degrees to Q31 binary angles */
+#define GEO_BENCH_POINTS         (256U)
+#define GEO_BENCH_DEG_TO_ANGLE   (11930464.711111112)
+#define GEO_BENCH_ANGLE_TO_RAD   (3.14159265358979323846 / 2147483648.0)
+
+/* Benchmark: number of sets, and the set placed on a ring around the fix */
+#define GEO_BENCH_SETS           (3U)
+#define GEO_BENCH_RING_SET       (1U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static void    geo_small_sincos(int32_t half, int64_t *s, int64_t *c);
+static int64_t geo_sqrt_q62(int64_t value);
+static void    geo_double(const cordic_geo_point_t *fix, const cordic_geo_point_t *point,
+                          double *distance, double *bearing);
+static void    geo_bench_set(double spread);
+static void    geo_bench_ring(double inner, double outer);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Operands and results of cordic_batch_rotate() */
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t geo_angle[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t geo_unit[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t geo_zero[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t geo_cos[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t geo_sin[CORDIC_BATCH_CHUNK];
+
+/* Destination of each batch result: point index times two, plus one for the
+ * latitude half difference */
+static uint8_t geo_slot[CORDIC_BATCH_CHUNK];
+
+/* Half-difference sines and cosines of a group: [0] longitude, [1] latitude */
+static int64_t geo_half_sin[2][GEO_GROUP];
+static int64_t geo_half_cos[2][GEO_GROUP];
+
+/* Benchmark points and results */
+static cordic_geo_point_t geo_bench_fix;
+static cordic_geo_point_t geo_bench_points[GEO_BENCH_POINTS];
+static uint32_t           geo_bench_distance[GEO_BENCH_POINTS];
+static CY_CORDIC_Q31_t    geo_bench_bearing[GEO_BENCH_POINTS];
+static double             geo_bench_ref_distance[GEO_BENCH_POINTS];
+static double             geo_bench_ref_bearing[GEO_BENCH_POINTS];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_geo_prepare
+********************************************************************************
+* Summary:
+* Computes the cosine and sine of the latitude of each point, once per
+* geofence and once per fix.
+*
+* Parameters:
+*  cordic_geo_point_t *points  Points, latitude and longitude set
+*  uint32_t count              Number of points
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when points is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_geo_prepare(cordic_geo_point_t *points, uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t start = 0;
+    uint32_t chunk = 0;
+    uint32_t i     = 0;
+
+    if (NULL != points)
+    {
+        for (start = 0U; start < count; start += chunk)
+        {
+            chunk = ((count - start) < CORDIC_BATCH_CHUNK) ? (count - start) : CORDIC_BATCH_CHUNK;
+
+            for (i = 0U; i < chunk; i++)
+            {
+                geo_angle[i] = points[start + i].latitude;
+                geo_unit[i]  = INT32_MAX;
+            }
+
+            (void)cordic_batch_rotate(geo_angle, geo_unit, geo_zero, geo_cos, geo_sin, chunk);
+
+            for (i = 0U; i < chunk; i++)
+            {
+                points[start + i].cos_lat = geo_cos[i];
+                points[start + i].sin_lat = geo_sin[i];
+            }
+        }
+
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: geo_small_sincos
+********************************************************************************
+* Summary:
+* Sine and cosine of a small angle from their series, x - x^3 / 6 + x^5 / 120
+* - x^7 / 5040 and 1 - x^2 / 2 + x^4 / 24 - x^6 / 720. The absolute error of
+* the CORDIC would be a large relative error for the half differences of
+* nearby points.
+*
+* Parameters:
+*  int32_t half  Angle below GEO_SMALL_ANGLE in magnitude, Q31 binary angle
+*  int64_t *s    Receives the sine in Q31
+*  int64_t *c    Receives the cosine in Q31
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void geo_small_sincos(int32_t half, int64_t *s, int64_t *c)
+{
+    int64_t x  = ((int64_t)half * GEO_PI_Q29) >> 29;
+    int64_t x2 = (x * x) >> 31;
+    int64_t x3 = (x2 * x) >> 31;
+    int64_t x4 = (x2 * x2) >> 31;
+    int64_t x5 = (x4 * x) >> 31;
+    int64_t x6 = (x4 * x2) >> 31;
+
+    *s = x - (x3 / 6) + (x5 / 120) - (((x6 * x) >> 31) / 5040);
+    *c = ((int64_t)1 << 31) - (x2 >> 1) + (x4 / 24) - (x6 / 720);
+}
+
+/*******************************************************************************
+* Function Name: geo_sqrt_q62
+********************************************************************************
+* Summary:
+* Square root of a Q62 value in [0, 1] with Cy_CORDIC_Sqrt(). The value is
+* shifted left by an even count until it fills the Q31 operand, and the root
+* is shifted right by half the count.
+*
+* Parameters:
+*  int64_t value  Operand in Q62
+*
+* Return:
+*  int64_t        Square root in Q31
+*
+*******************************************************************************/
+static int64_t geo_sqrt_q62(int64_t value)
+{
+    uint32_t high  = 0;
+    uint32_t zeros = 0;
+    uint32_t shift = 0;
+    int64_t  root  = 0;
+
+    value = (value < GEO_ONE_Q62) ? value : (GEO_ONE_Q62 - 1);
+    if (value > 0)
+    {
+        high  = (uint32_t)((uint64_t)value >> 32);
+        zeros = (0U != high) ? __CLZ(high) : (32U + __CLZ((uint32_t)value));
+        shift = (zeros - 2U) >> 1;
+
+        CORDIC_TRACE(CORDIC_TRACE_OP_SQRT, 1U, (int32_t)((value << (2U * shift)) >> 31), 0, 0);
+        root = Cy_CORDIC_Sqrt(MXCORDIC, (CY_CORDIC_Q31_t)((value << (2U * shift)) >> 31));
+        root = (0U != shift) ? ((root + (1LL << (shift - 1U))) >> shift) : root;
+    }
+
+    return root;
+}
+
+/*******************************************************************************
+* Function Name: cordic_geo_distance
+********************************************************************************
+* Summary:
+* Great-circle distance and initial bearing from a fix to each point:
+*   a = sin^2(dlat / 2) + cos(lat1) cos(lat2) sin^2(dlon / 2)
+*   distance = 2 R asin(sqrt(a))
+*   bearing = atan2(sin(dlon) cos(lat2), sin(dlat) + 2 sin(lat1) cos(lat2) sin^2(dlon / 2))
+* The bearing denominator is the usual cos(lat1) sin(lat2) - sin(lat1) cos(lat2)
+* cos(dlon), rearranged so that it does not cancel for nearby points. The
+* arcsine is a series up to GEO_NEAR_LIMIT and atan2(sqrt(a), sqrt(1 - a))
+* beyond, with 1 - a from the haversine term of the antipode so that it does
+* not cancel towards the antipode either.
+*
+* Parameters:
+*  const cordic_geo_point_t *fix     Current position, prepared
+*  const cordic_geo_point_t *points  Points, prepared
+*  uint32_t count                    Number of points
+*  uint32_t *distance                Distances in centimetres
+*  CY_CORDIC_Q31_t *bearing          Initial bearings, Q31 binary angle, or NULL
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when fix, points or distance is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_geo_distance(const cordic_geo_point_t *fix,
+                                          const cordic_geo_point_t *points,
+                                          uint32_t count,
+                                          uint32_t *distance,
+                                          CY_CORDIC_Q31_t *bearing)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    const cordic_geo_point_t *point = NULL;
+    int32_t  half[2]  = { 0, 0 };
+    int32_t  mean     = 0;
+    int64_t  a        = 0;
+    int64_t  s        = 0;
+    int64_t  x        = 0;
+    int64_t  y        = 0;
+    int64_t  central  = 0;
+    uint32_t zeros    = 0;
+    uint32_t angle    = 0;
+    uint32_t queued   = 0;
+    uint32_t start    = 0;
+    uint32_t group    = 0;
+    uint32_t i        = 0;
+    uint32_t d        = 0;
+
+    if ((NULL != fix) && (NULL != points) && (NULL != distance))
+    {
+        for (i = 0U; i < CORDIC_BATCH_CHUNK; i++)
+        {
+            geo_unit[i] = INT32_MAX;
+        }
+
+        for (start = 0U; start < count; start += group)
+        {
+            group  = ((count - start) < GEO_GROUP) ? (count - start) : GEO_GROUP;
+            queued = 0U;
+
+            /* Half differences; the longitude difference wraps into (-pi, pi] */
+            for (i = 0U; i < group; i++)
+            {
+                half[0] = (int32_t)((uint32_t)points[start + i].longitude - (uint32_t)fix->longitude) >> 1;
+                half[1] = (int32_t)((uint32_t)points[start + i].latitude - (uint32_t)fix->latitude) >> 1;
+
+                for (d = 0U; d < 2U; d++)
+                {
+                    if ((half[d] < GEO_SMALL_ANGLE) && (half[d] > -GEO_SMALL_ANGLE))
+                    {
+                        geo_small_sincos(half[d], &geo_half_sin[d][i], &geo_half_cos[d][i]);
+                    }
+                    else
+                    {
+                        geo_angle[queued] = half[d];
+                        geo_slot[queued]  = (uint8_t)((i << 1) | d);
+                        queued++;
+                    }
+                }
+            }
+
+            if (0U != queued)
+            {
+                (void)cordic_batch_rotate(geo_angle, geo_unit, geo_zero, geo_cos, geo_sin, queued);
+                for (i = 0U; i < queued; i++)
+                {
+                    geo_half_sin[geo_slot[i] & 1U][geo_slot[i] >> 1] = geo_sin[i];
+                    geo_half_cos[geo_slot[i] & 1U][geo_slot[i] >> 1] = geo_cos[i];
+                }
+            }
+
+            for (i = 0U; i < group; i++)
+            {
+                point = &points[start + i];
+
+                /* Haversine term in Q62. The sine is applied one factor at a
+                 * time, a Q31 square would lose the small differences. */
+                a = (geo_half_sin[1][i] * geo_half_sin[1][i]) +
+                    (((((int64_t)fix->cos_lat * point->cos_lat) >> 31) * geo_half_sin[0][i]) >> 31) *
+                    geo_half_sin[0][i];
+                s = geo_sqrt_q62(a);
+
+                if (s < GEO_NEAR_LIMIT)
+                {
+                    /* asin(s) = s + s^3 / 6 + 3 s^5 / 40 + 5 s^7 / 112 in Q31 radians */
+                    x       = (((s * s) >> 31) * s) >> 31;
+                    y       = (((x * s) >> 31) * s) >> 31;
+                    central = s + (x / 6) + ((3 * y) / 40) + ((5 * ((((y * s) >> 31) * s) >> 31)) / 112);
+                    distance[start + i] = (uint32_t)((central * (2LL * CORDIC_GEO_EARTH_RADIUS_CM) + (1LL << 30)) >> 31);
+                }
+                else
+                {
+                    /* 1 - a is the haversine term of the antipode of the
+                     * point, a sum that does not cancel towards the antipode:
+                     * sin^2((lat1 + lat2) / 2) + cos(lat1) cos(lat2) cos^2(dlon / 2) */
+                    mean  = (int32_t)(((int64_t)fix->latitude + point->latitude) >> 1);
+                    CORDIC_TRACE(CORDIC_TRACE_OP_SIN, 1U, mean, 0, 0);
+                    x     = Cy_CORDIC_Sin(MXCORDIC, mean);
+                    x     = (x * x) +
+                            (((((int64_t)fix->cos_lat * point->cos_lat) >> 31) * geo_half_cos[0][i]) >> 31) *
+                            geo_half_cos[0][i];
+                    x     = geo_sqrt_q62(x) >> GEO_VECTOR_SHIFT;
+                    y     = s >> GEO_VECTOR_SHIFT;
+                    CORDIC_TRACE(CORDIC_TRACE_OP_ARCTAN, 2U, (int32_t)x, (int32_t)y, 0);
+                    angle = (uint32_t)Cy_CORDIC_ArcTan(MXCORDIC, (CY_CORDIC_8Q23_t)x, (CY_CORDIC_8Q23_t)y);
+                    distance[start + i] = (uint32_t)((((int64_t)angle * GEO_PI_RADIUS_CM) + (1LL << 29)) >> 30);
+                }
+
+                if (NULL != bearing)
+                {
+                    /* East and north components, both up to 2 in Q31 */
+                    y = (((geo_half_sin[0][i] * geo_half_cos[0][i]) >> 31) * point->cos_lat) >> 30;
+                    x = ((geo_half_sin[1][i] * geo_half_cos[1][i]) >> 30) +
+                        (((((((int64_t)fix->sin_lat * point->cos_lat) >> 31) * geo_half_sin[0][i]) >> 31) *
+                          geo_half_sin[0][i]) >> 30);
+
+                    /* Common shift to the Q31 range, for the precision of nearby points */
+                    zeros = __CLZ((uint32_t)((x < 0) ? -x : x) | (uint32_t)((y < 0) ? -y : y));
+                    x     = (zeros > 1U) ? (x << (zeros - 1U)) : (x >> (1U - zeros));
+                    y     = (zeros > 1U) ? (y << (zeros - 1U)) : (y >> (1U - zeros));
+
+                    bearing[start + i] = (CY_CORDIC_Q31_t)cordic_angle_vector((CY_CORDIC_Q31_t)x,
+                                                                             (CY_CORDIC_Q31_t)y, 0U);
+                }
+            }
+        }
+
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: geo_double
+********************************************************************************
+* Summary:
+* Double-precision haversine reference with sin(), cos(), atan2(), and sqrt().
+*
+* Parameters:
+*  const cordic_geo_point_t *fix    Current position
+*  const cordic_geo_point_t *point  Point
+*  double *distance                 Receives the distance in centimetres
+*  double *bearing                  Receives the initial bearing in radians
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void geo_double(const cordic_geo_point_t *fix, const cordic_geo_point_t *point,
+                       double *distance, double *bearing)
+{
+    double lat1 = (double)fix->latitude * GEO_BENCH_ANGLE_TO_RAD;
+    double lat2 = (double)point->latitude * GEO_BENCH_ANGLE_TO_RAD;
+    double dlon = (double)(int32_t)((uint32_t)point->longitude - (uint32_t)fix->longitude) * GEO_BENCH_ANGLE_TO_RAD;
+    double dlat = lat2 - lat1;
+    double sdlat = sin(dlat / 2.0);
+    double sdlon = sin(dlon / 2.0);
+    double a     = (sdlat * sdlat) + (cos(lat1) * cos(lat2) * sdlon * sdlon);
+
+    *distance = 2.0 * (double)CORDIC_GEO_EARTH_RADIUS_CM * atan2(sqrt(a), sqrt(1.0 - a));
+    *bearing  = atan2(sin(dlon) * cos(lat2), (cos(lat1) * sin(lat2)) - (sin(lat1) * cos(lat2) * cos(dlon)));
+}
+
+/*******************************************************************************
+* Function Name: geo_bench_set
+********************************************************************************
+* Summary:
+* Places the benchmark points at random around the fix.
+*
+* Parameters:
+*  double spread  Largest latitude and longitude offset in degrees
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void geo_bench_set(double spread)
+{
+    uint32_t seed = 0x2545F491UL;
+    uint32_t i    = 0;
+
+    for (i = 0U; i < GEO_BENCH_POINTS; i++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        geo_bench_points[i].latitude = (CY_CORDIC_Q31_t)(geo_bench_fix.latitude +
+            ((((double)(int32_t)seed / 2147483648.0) * spread) * GEO_BENCH_DEG_TO_ANGLE));
+        geo_bench_points[i].latitude = (geo_bench_points[i].latitude > 1073741823L) ? 1073741823L :
+                                       ((geo_bench_points[i].latitude < -1073741823L) ? -1073741823L :
+                                        geo_bench_points[i].latitude);
+        seed = (seed * 1664525UL) + 1013904223UL;
+        geo_bench_points[i].longitude = (CY_CORDIC_Q31_t)((uint32_t)geo_bench_fix.longitude +
+            (uint32_t)(int32_t)((((double)(int32_t)seed / 2147483648.0) * spread * 2.0) * GEO_BENCH_DEG_TO_ANGLE));
+    }
+    (void)cordic_geo_prepare(geo_bench_points, GEO_BENCH_POINTS);
+}
+
+/*******************************************************************************
+* Function Name: geo_bench_ring
+********************************************************************************
+* Summary:
+* Places the benchmark points at a random distance and bearing from the fix,
+* with the double-precision destination formula.
+*
+* Parameters:
+*  double inner  Smallest distance in kilometres
+*  double outer  Largest distance in kilometres
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void geo_bench_ring(double inner, double outer)
+{
+    uint32_t seed    = 0x6C078965UL;
+    double   lat1    = (double)geo_bench_fix.latitude * GEO_BENCH_ANGLE_TO_RAD;
+    double   central = 0.0;
+    double   course  = 0.0;
+    double   lat2    = 0.0;
+    double   dlon    = 0.0;
+    uint32_t i       = 0;
+
+    for (i = 0U; i < GEO_BENCH_POINTS; i++)
+    {
+        seed    = (seed * 1664525UL) + 1013904223UL;
+        central = (inner + (((double)seed / 4294967296.0) * (outer - inner))) /
+                  ((double)CORDIC_GEO_EARTH_RADIUS_CM / 100000.0);
+        seed    = (seed * 1664525UL) + 1013904223UL;
+        course  = ((double)seed / 4294967296.0) * 2.0 * 3.14159265358979323846;
+
+        lat2 = asin((sin(lat1) * cos(central)) + (cos(lat1) * sin(central) * cos(course)));
+        dlon = atan2(sin(course) * sin(central) * cos(lat1), cos(central) - (sin(lat1) * sin(lat2)));
+
+        geo_bench_points[i].latitude  = (CY_CORDIC_Q31_t)(lat2 / GEO_BENCH_ANGLE_TO_RAD);
+        geo_bench_points[i].longitude = (CY_CORDIC_Q31_t)((uint32_t)geo_bench_fix.longitude +
+                                                          (uint32_t)(int32_t)(dlon / GEO_BENCH_ANGLE_TO_RAD));
+    }
+    (void)cordic_geo_prepare(geo_bench_points, GEO_BENCH_POINTS);
+}
+
+/*******************************************************************************
+* Function Name: cordic_geo_benchmark
+********************************************************************************
+* Summary:
+* Evaluates distance and bearing from a fix to 256 geofence points within
+* about 150 km, to 256 points between 300 and 800 km, and to 256 points
+* anywhere on the earth with the CORDIC kernel
+* and with the double-precision reference, and checks the results against
+* the tolerances.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_geo_benchmark(void)
+{
+    static const double spreads[GEO_BENCH_SETS] = { 0.9, 0.0, 90.0 };
+    static const char *const names[GEO_BENCH_SETS] = { "within 150 km", "300 to 800 km", "worldwide" };
+    uint32_t start   = 0;
+    uint32_t cordic  = 0;
+    uint32_t library = 0;
+    double   error   = 0.0;
+    double   bearing = 0.0;
+    double   delta   = 0.0;
+    uint32_t set     = 0;
+    uint32_t i       = 0;
+
+    /* Fix at 48.1351 N, 11.5820 E */
+    geo_bench_fix.latitude  = 574274112L;
+    geo_bench_fix.longitude = 138178642L;
+    (void)cordic_geo_prepare(&geo_bench_fix, 1U);
+
+    printf("\r\n%u points per set, distance and bearing\r\n", (unsigned int)GEO_BENCH_POINTS);
+    printf("Set            CORDIC points/s  double points/s  max error m  max error deg\r\n");
+
+    for (set = 0U; set < GEO_BENCH_SETS; set++)
+    {
+        if (GEO_BENCH_RING_SET == set)
+        {
+            geo_bench_ring(300.0, 800.0);
+        }
+        else
+        {
+            geo_bench_set(spreads[set]);
+        }
+
+        start  = cordic_benchmark_get_cycles();
+        (void)cordic_geo_distance(&geo_bench_fix, geo_bench_points, GEO_BENCH_POINTS,
+                                  geo_bench_distance, geo_bench_bearing);
+        cordic = cordic_benchmark_get_cycles() - start;
+
+        start  = cordic_benchmark_get_cycles();
+        for (i = 0U; i < GEO_BENCH_POINTS; i++)
+        {
+            geo_double(&geo_bench_fix, &geo_bench_points[i], &geo_bench_ref_distance[i], &geo_bench_ref_bearing[i]);
+        }
+        library = cordic_benchmark_get_cycles() - start;
+
+        error   = 0.0;
+        bearing = 0.0;
+        for (i = 0U; i < GEO_BENCH_POINTS; i++)
+        {
+            error = fmax(error, fabs((double)geo_bench_distance[i] - geo_bench_ref_distance[i]) / 100.0);
+            if (geo_bench_ref_distance[i] > 1000.0)
+            {
+                delta   = ((double)geo_bench_bearing[i] * GEO_BENCH_ANGLE_TO_RAD) - geo_bench_ref_bearing[i];
+                delta   = fabs(remainder(delta, 2.0 * 3.14159265358979323846)) * (180.0 / 3.14159265358979323846);
+                bearing = fmax(bearing, delta);
+            }
+        }
+
+        cordic  = (0U != cordic) ? cordic : 1U;
+        library = (0U != library) ? library : 1U;
+
+        printf("%-14s %16u %16u %12.3f %14.5f %s\r\n", names[set],
+               (unsigned int)(((uint64_t)SystemCoreClock * GEO_BENCH_POINTS) / cordic),
+               (unsigned int)(((uint64_t)SystemCoreClock * GEO_BENCH_POINTS) / library),
+               error, bearing,
+               ((error <= (double)(((GEO_BENCH_SETS - 1U) != set) ? CORDIC_GEO_TOLERANCE_NEAR_M : CORDIC_GEO_TOLERANCE_FAR_M)) &&
+                (bearing <= (double)CORDIC_GEO_TOLERANCE_DEG)) ? "within tolerance" : "OUT OF TOLERANCE");
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,96 @@
+/*******************************************************************************
+* File Name:   cordic_geo.h
+*
+* Description: This header file contains the interface to the
+* great-circle distance and bearing kernel for geofencing. It evaluates the
+* haversine formula in fixed point for arrays of points with batched CORDIC
+* rotations, square roots, and vectoring.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_GEO_H
+#define CORDIC_GEO_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "arm_math.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Mean earth radius in centimetres */
+#define CORDIC_GEO_EARTH_RADIUS_CM   (637100880UL)
+
+/* Maximum distance error against the double-precision haversine formula on
+ * the same sphere, for distances up to 800 km between latitudes of +/-75
+ * degrees, and beyond. Nearby points avoid the CORDIC for the coordinate
+ * differences and the central angle; beyond, and for the latitude cosines
+ * towards the poles, its resolution of about 2^-23 limits the result to
+ * metres and at long range to tens of metres. */
+#define CORDIC_GEO_TOLERANCE_NEAR_M  (1U)
+#define CORDIC_GEO_TOLERANCE_FAR_M   (50U)
+
+/* Bearing tolerance in degrees for points more than 10 m apart */
+#define CORDIC_GEO_TOLERANCE_DEG     (0.01f)
+
+/* A position on the sphere. Latitude and longitude are Q31 binary angles,
+ * 2^31 = 180 degrees. cos_lat and sin_lat are filled by cordic_geo_prepare(). */
+typedef struct
+{
+    CY_CORDIC_Q31_t latitude;
+    CY_CORDIC_Q31_t longitude;
+    q31_t cos_lat;
+    q31_t sin_lat;
+} cordic_geo_point_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_en_cordic_status_t cordic_geo_prepare(cordic_geo_point_t *points, uint32_t count);
+/* distance receives the great-circle distances in centimetres. bearing
+ * receives the initial bearings from the fix as Q31 binary angles, 0 = north,
+ * positive towards east, and may be NULL. */
+cy_en_cordic_status_t cordic_geo_distance(const cordic_geo_point_t *fix,
+                                          const cordic_geo_point_t *points,
+                                          uint32_t count,
+                                          uint32_t *distance,
+                                          CY_CORDIC_Q31_t *bearing);
+void cordic_geo_benchmark(void);
+
+#endif /*CORDIC_GEO_H*/
+/* [] END OF FILE */
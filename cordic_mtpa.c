@@ -0,0 +1,392 @@
+/*******************************************************************************
+* File Name:   cordic_mtpa.c
+*
+* Description: This file contains the MTPA and field-weakening reference generator.
+* The d current of maximum torque per ampere is the root of a quadratic in the
+* q current, taken with the CORDIC square root. The field-weakening loop
+* integrates the excess of the stator voltage magnitude, taken with the
+* vectoring operation and a Park transform, over its limit into a negative d
+* current. The q current is then limited to the current circle.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_gain.h"
+#include "cordic_mtpa.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* 1.0 in Q62 */
+#define MTPA_ONE_Q62          (1ULL << 62)
+
+/* Shifts from Q62 to Q48 and from Q24 to Q31 */
+#define MTPA_Q62_TO_Q48       (14U)
+#define MTPA_Q24_TO_Q31       (7U)
+
+/* Fractional bits of the field-weakening gain */
+#define MTPA_GAIN_SHIFT       (16U)
+
+/* Benchmark: updates, motor constant, voltage limit, and loop settings */
+#define MTPA_BENCH_COUNT      (256U)
+#define MTPA_BENCH_CONSTANT   (1.5f)
+#define MTPA_BENCH_LIMIT      (0.9f)
+#define MTPA_BENCH_GAIN       (0.05f)
+#define MTPA_BENCH_ID_MIN     (-0.7f)
+
+/* Float to Q31 with saturation */
+#define MTPA_FLOAT_TO_Q31(x)  ((CY_CORDIC_Q31_t)fmaxf(fminf((x) * 2147483648.0f, 2147483520.0f), -2147483520.0f))
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t mtpa_sqrt(uint64_t value);
+static void     mtpa_float(float32_t *fw_id, float32_t iq_demand, float32_t vd, float32_t vq,
+                           float32_t *id_ref, float32_t *iq_ref);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark operating points and results */
+static CY_CORDIC_Q31_t mtpa_bench_iq[MTPA_BENCH_COUNT];
+static CY_CORDIC_Q31_t mtpa_bench_vd[MTPA_BENCH_COUNT];
+static CY_CORDIC_Q31_t mtpa_bench_vq[MTPA_BENCH_COUNT];
+static CY_CORDIC_Q31_t mtpa_bench_id_ref[MTPA_BENCH_COUNT];
+static CY_CORDIC_Q31_t mtpa_bench_iq_ref[MTPA_BENCH_COUNT];
+static float32_t       mtpa_float_id_ref[MTPA_BENCH_COUNT];
+static float32_t       mtpa_float_iq_ref[MTPA_BENCH_COUNT];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_mtpa_init
+********************************************************************************
+* Summary:
+* Initializes the reference generator with the field-weakening current at 0.
+*
+* Parameters:
+*  cordic_mtpa_t *mtpa            Reference generator state
+*  uint32_t constant              psi / (2 (Lq - Ld)) in per-unit current, Q24,
+*                                 or 0 for a surface-magnet motor
+*  CY_CORDIC_Q31_t voltage_limit  Voltage magnitude limit, positive
+*  int32_t fw_gain                Field-weakening integral gain, Q16, positive
+*  CY_CORDIC_Q31_t fw_id_min      Most negative field-weakening d current
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL pointer or a parameter
+*                         out of range
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_mtpa_init(cordic_mtpa_t *mtpa, uint32_t constant,
+                                       CY_CORDIC_Q31_t voltage_limit, int32_t fw_gain,
+                                       CY_CORDIC_Q31_t fw_id_min)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+
+    if ((NULL != mtpa) && (constant <= CORDIC_MTPA_CONSTANT_MAX) && (voltage_limit > 0) &&
+        (fw_gain > 0) && (fw_id_min <= 0))
+    {
+        mtpa->constant      = constant;
+        mtpa->voltage_limit = voltage_limit;
+        mtpa->fw_gain       = fw_gain;
+        mtpa->fw_id_min     = fw_id_min;
+        mtpa->fw_id         = 0;
+        status              = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: mtpa_sqrt
+********************************************************************************
+* Summary:
+* Square root of a Q62 value in [0, 4) with Cy_CORDIC_Sqrt(). Values of 1 and
+* above are divided by 4 first. The value is then shifted left by an even count
+* until it fills the Q31 operand, and the root is shifted right by half the
+* count. A Q48 operand gives a Q24 root the same way.
+*
+* Parameters:
+*  uint64_t value  Operand in Q62
+*
+* Return:
+*  uint32_t        Square root in Q31
+*
+*******************************************************************************/
+static uint32_t mtpa_sqrt(uint64_t value)
+{
+    uint32_t high  = 0;
+    uint32_t zeros = 0;
+    uint32_t shift = 0;
+    uint32_t scale = (value >= MTPA_ONE_Q62) ? 1U : 0U;
+    uint64_t root  = 0;
+
+    value >>= 2U * scale;
+    value   = (value < MTPA_ONE_Q62) ? value : (MTPA_ONE_Q62 - 1U);
+    if (0U != value)
+    {
+        high  = (uint32_t)(value >> 32);
+        zeros = (0U != high) ? __CLZ(high) : (32U + __CLZ((uint32_t)value));
+        shift = (zeros - 2U) >> 1;
+
+        CORDIC_TRACE(CORDIC_TRACE_OP_SQRT, 1U, (int32_t)((value << (2U * shift)) >> 31), 0, 0);
+        root = (uint64_t)Cy_CORDIC_Sqrt(MXCORDIC, (CY_CORDIC_Q31_t)((value << (2U * shift)) >> 31));
+        root = (0U != shift) ? ((root + (1ULL << (shift - 1U))) >> shift) : root;
+    }
+
+    return (uint32_t)(root << scale);
+}
+
+/*******************************************************************************
+* Function Name: cordic_mtpa_update
+********************************************************************************
+* Summary:
+* One speed-loop update of the current references:
+*   id_mtpa = c - sqrt(c^2 + iq^2), c = psi / (2 (Lq - Ld))
+*   id_fw  += gain (voltage_limit - |v|), limited to [fw_id_min, 0]
+*   id_ref  = id_mtpa + id_fw, iq_ref = iq limited to sqrt(1 - id_ref^2)
+* The voltage magnitude comes from cordic_angle_polar_start() and
+* cordic_angle_polar_result(). The MTPA operand is prepared while the
+* peripheral computes it.
+*
+* Parameters:
+*  cordic_mtpa_t *mtpa        Reference generator state
+*  CY_CORDIC_Q31_t iq_demand  q current demand of the speed controller
+*  CY_CORDIC_Q31_t vd         d voltage reference
+*  CY_CORDIC_Q31_t vq         q voltage reference
+*  CY_CORDIC_Q31_t *id_ref    d current reference
+*  CY_CORDIC_Q31_t *iq_ref    q current reference
+*  CY_CORDIC_Q31_t *voltage   Voltage magnitude, or NULL
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_mtpa_update(cordic_mtpa_t *mtpa, CY_CORDIC_Q31_t iq_demand,
+                                         CY_CORDIC_Q31_t vd, CY_CORDIC_Q31_t vq,
+                                         CY_CORDIC_Q31_t *id_ref, CY_CORDIC_Q31_t *iq_ref,
+                                         CY_CORDIC_Q31_t *voltage)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    int64_t  magnitude = 0;
+    uint64_t square    = 0;
+    int64_t  id        = 0;
+    int64_t  iq_max    = 0;
+    int64_t  fw_id     = 0;
+    uint32_t angle     = 0;
+    bool     started   = false;
+
+    if ((NULL != mtpa) && (NULL != id_ref) && (NULL != iq_ref))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        started = cordic_angle_polar_start(vd, vq, &angle);
+
+        /* MTPA operand c^2 + iq^2 in Q48 while the peripheral is busy */
+        square = ((uint64_t)mtpa->constant * mtpa->constant) +
+                 (((uint64_t)((int64_t)iq_demand * iq_demand)) >> MTPA_Q62_TO_Q48);
+
+        magnitude = started ? cordic_angle_polar_result() : 0;
+
+        /* Maximum torque per ampere */
+        if (0U != mtpa->constant)
+        {
+            id = ((int64_t)mtpa->constant - (int64_t)mtpa_sqrt(square)) * (1LL << MTPA_Q24_TO_Q31);
+        }
+
+        /* Field weakening */
+        fw_id = (int64_t)mtpa->fw_id +
+                ((((int64_t)mtpa->voltage_limit - magnitude) * mtpa->fw_gain) >> MTPA_GAIN_SHIFT);
+        fw_id = (fw_id > 0) ? 0 : ((fw_id < mtpa->fw_id_min) ? mtpa->fw_id_min : fw_id);
+        mtpa->fw_id = (CY_CORDIC_Q31_t)fw_id;
+
+        /* Current circle */
+        id     = id + fw_id;
+        id     = (id < -INT32_MAX) ? -INT32_MAX : id;
+        iq_max = (int64_t)mtpa_sqrt(MTPA_ONE_Q62 - (uint64_t)(id * id));
+        iq_max = (iq_max > INT32_MAX) ? INT32_MAX : iq_max;
+
+        *id_ref = (CY_CORDIC_Q31_t)id;
+        *iq_ref = (iq_demand > iq_max) ? (CY_CORDIC_Q31_t)iq_max :
+                  ((iq_demand < -iq_max) ? (CY_CORDIC_Q31_t)-iq_max : iq_demand);
+        if (NULL != voltage)
+        {
+            *voltage = (CY_CORDIC_Q31_t)magnitude;
+        }
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: mtpa_float
+********************************************************************************
+* Summary:
+* Floating-point reference of cordic_mtpa_update() with sqrtf() and the
+* benchmark parameters.
+*
+* Parameters:
+*  float32_t *fw_id      Field-weakening d current, integrator state
+*  float32_t iq_demand   q current demand
+*  float32_t vd          d voltage reference
+*  float32_t vq          q voltage reference
+*  float32_t *id_ref     d current reference
+*  float32_t *iq_ref     q current reference
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void mtpa_float(float32_t *fw_id, float32_t iq_demand, float32_t vd, float32_t vq,
+                       float32_t *id_ref, float32_t *iq_ref)
+{
+    float32_t id     = MTPA_BENCH_CONSTANT - sqrtf((MTPA_BENCH_CONSTANT * MTPA_BENCH_CONSTANT) +
+                                                   (iq_demand * iq_demand));
+    float32_t iq_max = 0.0f;
+
+    *fw_id += MTPA_BENCH_GAIN * (MTPA_BENCH_LIMIT - sqrtf((vd * vd) + (vq * vq)));
+    *fw_id  = fminf(fmaxf(*fw_id, MTPA_BENCH_ID_MIN), 0.0f);
+
+    id      = fmaxf(id + *fw_id, -1.0f);
+    iq_max  = sqrtf(1.0f - (id * id));
+    *id_ref = id;
+    *iq_ref = fminf(fmaxf(iq_demand, -iq_max), iq_max);
+}
+
+/*******************************************************************************
+* Function Name: cordic_mtpa_benchmark
+********************************************************************************
+* Summary:
+* Runs the reference generator over an acceleration into field weakening and
+* back, with the CORDIC and with the floating-point reference, next to a Park
+* transform of the current loop. Prints the cycles per update and the largest
+* reference difference.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_mtpa_benchmark(void)
+{
+    cordic_mtpa_t mtpa;
+    cy_stc_cordic_parkTransform_result_t park;
+    float32_t       phase   = 0.0f;
+    float32_t       fw_id   = 0.0f;
+    float32_t       error   = 0.0f;
+    uint32_t        start   = 0;
+    uint32_t        cordic  = 0;
+    uint32_t        library = 0;
+    uint32_t        parks   = 0;
+    volatile int32_t sink   = 0;
+    uint32_t        i       = 0;
+
+    /* The voltage rises to 1.1 times the limit and falls back */
+    for (i = 0U; i < MTPA_BENCH_COUNT; i++)
+    {
+        phase = (PI * (float32_t)i) / (float32_t)MTPA_BENCH_COUNT;
+        mtpa_bench_iq[i] = MTPA_FLOAT_TO_Q31(0.9f * sinf(3.0f * phase));
+        mtpa_bench_vd[i] = MTPA_FLOAT_TO_Q31(-0.4f * sinf(phase));
+        mtpa_bench_vq[i] = MTPA_FLOAT_TO_Q31(0.9f * sinf(phase));
+    }
+
+    (void)cordic_mtpa_init(&mtpa, (uint32_t)(MTPA_BENCH_CONSTANT * 16777216.0f),
+                           MTPA_FLOAT_TO_Q31(MTPA_BENCH_LIMIT),
+                           (int32_t)(MTPA_BENCH_GAIN * 65536.0f),
+                           MTPA_FLOAT_TO_Q31(MTPA_BENCH_ID_MIN));
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < MTPA_BENCH_COUNT; i++)
+    {
+        (void)cordic_mtpa_update(&mtpa, mtpa_bench_iq[i], mtpa_bench_vd[i], mtpa_bench_vq[i],
+                                 &mtpa_bench_id_ref[i], &mtpa_bench_iq_ref[i], NULL);
+    }
+    cordic = cordic_benchmark_get_cycles() - start;
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < MTPA_BENCH_COUNT; i++)
+    {
+        mtpa_float(&fw_id, (float32_t)mtpa_bench_iq[i] / 2147483648.0f,
+                   (float32_t)mtpa_bench_vd[i] / 2147483648.0f, (float32_t)mtpa_bench_vq[i] / 2147483648.0f,
+                   &mtpa_float_id_ref[i], &mtpa_float_iq_ref[i]);
+    }
+    library = cordic_benchmark_get_cycles() - start;
+
+    /* Park transform as in park_transform(): start, wait, read, and convert */
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < MTPA_BENCH_COUNT; i++)
+    {
+        Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)(i << 23) - (CY_CORDIC_Q31_t)CORDIC_ANGLE_PI_2,
+                                  mtpa_bench_vd[i], mtpa_bench_vq[i]);
+        while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+        Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+        sink = cordic_gain_remove(park.parkTransformId, 0);
+        sink = cordic_gain_remove(park.parkTransformIq, 0);
+    }
+    parks = cordic_benchmark_get_cycles() - start;
+    (void)sink;
+
+    for (i = 0U; i < MTPA_BENCH_COUNT; i++)
+    {
+        error = fmaxf(error, fabsf(((float32_t)mtpa_bench_id_ref[i] / 2147483648.0f) - mtpa_float_id_ref[i]));
+        error = fmaxf(error, fabsf(((float32_t)mtpa_bench_iq_ref[i] / 2147483648.0f) - mtpa_float_iq_ref[i]));
+    }
+
+    printf("\r\n%u speed-loop updates, MTPA constant %.2f, voltage limit %.2f\r\n",
+           (unsigned int)MTPA_BENCH_COUNT, (double)MTPA_BENCH_CONSTANT, (double)MTPA_BENCH_LIMIT);
+    printf("Method                   | cycles/update\r\n");
+    printf("CORDIC                   | %13u\r\n", (unsigned int)(cordic / MTPA_BENCH_COUNT));
+    printf("sqrtf                    | %13u\r\n", (unsigned int)(library / MTPA_BENCH_COUNT));
+    printf("Park transform           | %13u\r\n", (unsigned int)(parks / MTPA_BENCH_COUNT));
+    printf("Largest reference difference: %.2e per unit\r\n", (double)error);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,83 @@
+/*******************************************************************************
+* File Name:   cordic_mtpa.h
+*
+* Description: This header file contains the interface to the maximum-torque-
+* per-ampere and field-weakening current reference generator of a PMSM speed
+* loop.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_MTPA_H
+#define CORDIC_MTPA_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Largest MTPA constant psi / (2 (Lq - Ld)) in per-unit current, Q24 */
+#define CORDIC_MTPA_CONSTANT_MAX   (255UL << 24)
+
+/* Reference generator state. All currents are per unit of the current limit
+ * and all voltages per unit of the voltage base, in Q31. */
+typedef struct
+{
+    uint32_t        constant;       /* psi / (2 (Lq - Ld)) in Q24, 0 for a surface-magnet motor */
+    CY_CORDIC_Q31_t voltage_limit;  /* Stator voltage magnitude at which field weakening starts */
+    int32_t         fw_gain;        /* Field-weakening integral gain per update, Q16 */
+    CY_CORDIC_Q31_t fw_id_min;      /* Most negative field-weakening d current */
+    CY_CORDIC_Q31_t fw_id;          /* Field-weakening d current, integrator state */
+} cordic_mtpa_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_en_cordic_status_t cordic_mtpa_init(cordic_mtpa_t *mtpa, uint32_t constant,
+                                       CY_CORDIC_Q31_t voltage_limit, int32_t fw_gain,
+                                       CY_CORDIC_Q31_t fw_id_min);
+/* vd and vq are the voltage references of the last current-loop cycle.
+ * voltage receives their magnitude and may be NULL. */
+cy_en_cordic_status_t cordic_mtpa_update(cordic_mtpa_t *mtpa, CY_CORDIC_Q31_t iq_demand,
+                                         CY_CORDIC_Q31_t vd, CY_CORDIC_Q31_t vq,
+                                         CY_CORDIC_Q31_t *id_ref, CY_CORDIC_Q31_t *iq_ref,
+                                         CY_CORDIC_Q31_t *voltage);
+void cordic_mtpa_benchmark(void);
+
+#endif /*CORDIC_MTPA_H*/
+/* [] END OF FILE */
@@ -0,0 +1,360 @@
+/*******************************************************************************
+* File Name:   cordic_placement.c
+*
+* Description: This file contains the benchmark of flash versus RAM execution
+* of the software side of the CORDIC operations. Each kernel body is forced
+* inline into one function linked to flash and one linked to RAM, so both
+* copies run the same instructions. The kernels are measured for the CLK_HF0
+* dividers 1, 2, 4 and 8 with the flash wait states set for each frequency.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "arm_math.h"
+#include "cordic_benchmark.h"
+#include "cordic_gain.h"
+#include "cordic_placement.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of operands per kernel run */
+#define PLACEMENT_OPERANDS       (64U)
+
+/* Number of CLK_HF0 dividers measured */
+#define PLACEMENT_CLOCKS         (4U)
+
+/* Number of measured kernels */
+#define PLACEMENT_KERNELS        (3U)
+
+/* Q31 to float scale */
+#define PLACEMENT_Q31_TO_FLOAT   (1.0f / 2147483648.0f)
+
+/* Kernel measured in both placements */
+typedef struct
+{
+    const char *name;
+    int32_t (*flash)(void);
+    int32_t (*ram)(void);
+} cordic_placement_kernel_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int32_t kernel_park_flash(void);
+static int32_t kernel_park_ram(void);
+static int32_t kernel_sin_flash(void);
+static int32_t kernel_sin_ram(void);
+static int32_t kernel_gain_flash(void);
+static int32_t kernel_gain_ram(void);
+static void    placement_set_divider(cy_en_clkhf_dividers_t divider, uint32_t base_hz);
+static uint32_t placement_cycles(int32_t (*kernel)(void));
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const cordic_placement_kernel_t cordic_placement_kernels[PLACEMENT_KERNELS] =
+{
+    {"park + gain removal", kernel_park_flash, kernel_park_ram},
+    {"sin + float convert", kernel_sin_flash,  kernel_sin_ram},
+    {"gain removal only",   kernel_gain_flash, kernel_gain_ram},
+};
+
+static const cy_en_clkhf_dividers_t cordic_placement_dividers[PLACEMENT_CLOCKS] =
+{
+    CY_SYSCLK_CLKHF_NO_DIVIDE,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_2,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_4,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_8
+};
+
+/* Kernel operands, in RAM for both placements */
+static CY_CORDIC_Q31_t placement_angle[PLACEMENT_OPERANDS];
+static CY_CORDIC_Q31_t placement_value[PLACEMENT_OPERANDS];
+
+/* Keeps the kernel results alive */
+static volatile int32_t placement_sink;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: kernel_park_body
+********************************************************************************
+* Summary:
+* Park transforms of the operands, blocking, with the gain removal and the
+* Q23 to Q31 conversion done by park_transform() on the CPU.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int32_t  Sum of the results
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE int32_t kernel_park_body(void)
+{
+    cy_stc_cordic_parkTransform_result_t park;
+    int32_t  acc = 0;
+    uint32_t i   = 0;
+
+    for (i = 0U; i < PLACEMENT_OPERANDS; i++)
+    {
+        Cy_CORDIC_ParkTransformNB(MXCORDIC, placement_angle[i], placement_value[i], placement_value[i] >> 1);
+        while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+        Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+
+        acc += cordic_gain_remove(park.parkTransformId, 0);
+        acc += cordic_gain_remove(park.parkTransformIq, 0);
+    }
+
+    return acc;
+}
+
+/*******************************************************************************
+* Function Name: kernel_sin_body
+********************************************************************************
+* Summary:
+* Sines of the operands with the conversion of the Q31 result to float.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int32_t  Sum of the results, truncated
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE int32_t kernel_sin_body(void)
+{
+    float32_t acc = 0.0f;
+    uint32_t  i   = 0;
+
+    for (i = 0U; i < PLACEMENT_OPERANDS; i++)
+    {
+        acc += (float32_t)Cy_CORDIC_Sin(MXCORDIC, placement_angle[i]) * PLACEMENT_Q31_TO_FLOAT;
+    }
+
+    return (int32_t)acc;
+}
+
+/*******************************************************************************
+* Function Name: kernel_gain_body
+********************************************************************************
+* Summary:
+* Gain removal and Q23 to Q31 conversion of the operands, no peripheral access.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int32_t  Sum of the results
+*
+*******************************************************************************/
+__STATIC_FORCEINLINE int32_t kernel_gain_body(void)
+{
+    int32_t  acc = 0;
+    uint32_t i   = 0;
+
+    for (i = 0U; i < PLACEMENT_OPERANDS; i++)
+    {
+        acc += cordic_gain_remove(placement_value[i] >> 8, 0);
+    }
+
+    return acc;
+}
+
+/*******************************************************************************
+* Function Name: kernel_park_flash, kernel_sin_flash, kernel_gain_flash,
+*                kernel_park_ram, kernel_sin_ram, kernel_gain_ram
+********************************************************************************
+* Summary:
+* The kernels linked to flash and to RAM. The RAM copies are placed in RAM
+* regardless of CORDIC_HOT_IN_RAM.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  int32_t  Kernel result
+*
+*******************************************************************************/
+static int32_t kernel_park_flash(void) { return kernel_park_body(); }
+static int32_t kernel_sin_flash(void)  { return kernel_sin_body(); }
+static int32_t kernel_gain_flash(void) { return kernel_gain_body(); }
+
+CY_RAMFUNC_BEGIN
+static int32_t kernel_park_ram(void) { return kernel_park_body(); }
+CY_RAMFUNC_END
+
+CY_RAMFUNC_BEGIN
+static int32_t kernel_sin_ram(void) { return kernel_sin_body(); }
+CY_RAMFUNC_END
+
+CY_RAMFUNC_BEGIN
+static int32_t kernel_gain_ram(void) { return kernel_gain_body(); }
+CY_RAMFUNC_END
+
+/*******************************************************************************
+* Function Name: placement_set_divider
+********************************************************************************
+* Summary:
+* Switches the CLK_HF0 divider and sets the flash wait states for the new
+* frequency. The wait states are raised before and lowered after a change, so
+* the flash is never accessed with too few of them.
+*
+* Parameters:
+*  cy_en_clkhf_dividers_t divider  New divider
+*  uint32_t base_hz                Undivided CLK_HF0 frequency
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void placement_set_divider(cy_en_clkhf_dividers_t divider, uint32_t base_hz)
+{
+    uint32_t new_mhz = (base_hz >> (uint32_t)divider) / 1000000UL;
+
+    if ((base_hz >> (uint32_t)divider) > SystemCoreClock)
+    {
+        Cy_SysLib_SetWaitStates(false, new_mhz);
+        (void)Cy_SysClk_ClkHfSetDivider(0U, divider);
+    }
+    else
+    {
+        (void)Cy_SysClk_ClkHfSetDivider(0U, divider);
+        Cy_SysLib_SetWaitStates(false, new_mhz);
+    }
+
+    SystemCoreClockUpdate();
+}
+
+/*******************************************************************************
+* Function Name: placement_cycles
+********************************************************************************
+* Summary:
+* Runs a kernel once to load the caches and the CORDIC, then measures it.
+*
+* Parameters:
+*  int32_t (*kernel)(void)  Kernel
+*
+* Return:
+*  uint32_t                 Cycles per operand
+*
+*******************************************************************************/
+static uint32_t placement_cycles(int32_t (*kernel)(void))
+{
+    uint32_t start = 0;
+
+    placement_sink = kernel();
+
+    start          = cordic_benchmark_get_cycles();
+    placement_sink = kernel();
+
+    return (cordic_benchmark_get_cycles() - start) / PLACEMENT_OPERANDS;
+}
+
+/*******************************************************************************
+* Function Name: cordic_placement_benchmark
+********************************************************************************
+* Summary:
+* Measures the cycles per operand of each kernel from flash and from RAM for
+* each CLK_HF0 divider. The debug UART is clocked from CLK_HF0 as well, so all
+* measurements are taken first and printed after the original clock is
+* restored.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_placement_benchmark(void)
+{
+    uint32_t               flash[PLACEMENT_CLOCKS][PLACEMENT_KERNELS];
+    uint32_t               ram[PLACEMENT_CLOCKS][PLACEMENT_KERNELS];
+    uint32_t               clock_hz[PLACEMENT_CLOCKS];
+    cy_en_clkhf_dividers_t original = Cy_SysClk_ClkHfGetDivider(0U);
+    uint32_t               base_hz  = SystemCoreClock << (uint32_t)original;
+    uint32_t               seed     = 0x9E3779B9UL;
+    uint32_t               c        = 0;
+    uint32_t               k        = 0;
+    uint32_t               i        = 0;
+
+    for (i = 0U; i < PLACEMENT_OPERANDS; i++)
+    {
+        /* Angles within +/-90 degrees and values within +/-0.5 */
+        seed = (seed * 1664525UL) + 1013904223UL;
+        placement_angle[i] = ((CY_CORDIC_Q31_t)seed) >> 1;
+        placement_value[i] = ((CY_CORDIC_Q31_t)(seed * 2654435761UL)) >> 1;
+    }
+
+    /* Wait for the last character of the banner before the clock changes */
+    Cy_SysLib_Delay(10U);
+
+    for (c = 0U; c < PLACEMENT_CLOCKS; c++)
+    {
+        placement_set_divider(cordic_placement_dividers[c], base_hz);
+        clock_hz[c] = SystemCoreClock;
+
+        for (k = 0U; k < PLACEMENT_KERNELS; k++)
+        {
+            flash[c][k] = placement_cycles(cordic_placement_kernels[k].flash);
+            ram[c][k]   = placement_cycles(cordic_placement_kernels[k].ram);
+        }
+    }
+
+    placement_set_divider(original, base_hz);
+
+    printf("\r\ncore clock | kernel              | flash | RAM | RAM saving\r\n");
+    for (c = 0U; c < PLACEMENT_CLOCKS; c++)
+    {
+        for (k = 0U; k < PLACEMENT_KERNELS; k++)
+        {
+            printf("%6u MHz | %-19s | %5u | %3u | %5.1f %%\r\n",
+                   (unsigned int)(clock_hz[c] / 1000000UL), cordic_placement_kernels[k].name,
+                   (unsigned int)flash[c][k], (unsigned int)ram[c][k],
+                   (0U != flash[c][k]) ? (100.0 * ((float64_t)flash[c][k] - (float64_t)ram[c][k]) / (float64_t)flash[c][k]) : 0.0);
+        }
+    }
+    printf("Hot paths of this build: %s.\r\n", (0 != CORDIC_HOT_IN_RAM) ? "RAM" : "flash");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,76 @@
+/*******************************************************************************
+* File Name:   cordic_placement.h
+*
+* Description: This header file contains the code placement of the hot CORDIC
+* paths. With CORDIC_HOT_IN_RAM set, the functions between CORDIC_HOT_BEGIN and
+* CORDIC_HOT_END are linked into the .cy_ramfunc section, which the startup code
+* copies to SRAM, so they run without flash wait states.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_PLACEMENT_H
+#define CORDIC_PLACEMENT_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 by the build (make CORDIC_HOT_IN_RAM=1) to run the hot paths from RAM */
+#ifndef CORDIC_HOT_IN_RAM
+#define CORDIC_HOT_IN_RAM (0)
+#endif
+
+/* Placement of the hot paths: the batch loops, the fast-path wrappers and
+ * their helpers */
+#if (CORDIC_HOT_IN_RAM)
+#define CORDIC_HOT_BEGIN  CY_RAMFUNC_BEGIN
+#define CORDIC_HOT_END    CY_RAMFUNC_END
+#else
+#define CORDIC_HOT_BEGIN
+#define CORDIC_HOT_END
+#endif
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void cordic_placement_benchmark(void);
+
+#endif /*CORDIC_PLACEMENT_H*/
+/* [] END OF FILE */
@@ -0,0 +1,648 @@
+/*******************************************************************************
+* File Name:   cordic_soft.c
+*
+* Description: This file contains the software CORDIC kernel. It implements the
+* circular and hyperbolic rotation and vectoring modes with a configurable
+* iteration count and a post-correction stage, which rotates the truncated
+* result by the residual angle using a small table indexed by the top bits of
+* the residual.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_benchmark.h"
+#include "cordic_soft.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Q31 binary angles of +pi/2 and pi */
+#define CORDIC_SOFT_ANGLE_PI_2     (0x40000000U)
+#define CORDIC_SOFT_ANGLE_PI       (0x80000000U)
+
+/* Unity in the Q30 working format of the kernel */
+#define CORDIC_SOFT_Q30_ONE        (1073741824L)
+
+/* pi in Q29, converts a Q31 binary angle to Q31 radians */
+#define CORDIC_SOFT_PI_Q29         (1686629713LL)
+
+/* The correction table covers |residual| < 2^(31 - CORDIC_SOFT_CORR_MIN_ITERATIONS),
+ * split into (1 << CORDIC_SOFT_CORR_BITS) buckets of equal width. */
+#define CORDIC_SOFT_CORR_SPAN      (1UL << (31U - CORDIC_SOFT_CORR_MIN_ITERATIONS))
+#define CORDIC_SOFT_CORR_SHIFT     (32U - CORDIC_SOFT_CORR_MIN_ITERATIONS - CORDIC_SOFT_CORR_BITS)
+#define CORDIC_SOFT_CORR_ENTRIES   (1U << (CORDIC_SOFT_CORR_BITS - 1U))
+#define CORDIC_SOFT_CORR_HALF_STEP (1L << (CORDIC_SOFT_CORR_SHIFT - 1U))
+
+/* Hyperbolic iterations 4 and 13 must be repeated for convergence */
+#define CORDIC_SOFT_HYP_REPEAT_1   (4U)
+#define CORDIC_SOFT_HYP_REPEAT_2   (13U)
+
+/* Number of angles used by the on-target benchmark */
+#define CORDIC_SOFT_BENCH_SAMPLES  (256U)
+
+/* Multiplication of two Q31 numbers */
+#define CORDIC_SOFT_MUL_Q31(a, b)  ((int32_t)(((int64_t)(a) * (b)) >> 31))
+
+/* Correction table entry: sine and (1 - cosine) of the bucket centre */
+typedef struct
+{
+    int32_t sin_q31;
+    int32_t one_minus_cos_q31;
+} cordic_soft_corr_entry_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* atan(2^-i) as Q31 binary angles, i = 0..30 */
+static const int32_t cordic_soft_atan_table[CORDIC_SOFT_MAX_ITERATIONS + 1U] =
+{
+    536870912, 316933406, 167458907, 85004756, 42667331, 21354465, 10679838,
+    5340245, 2670163, 1335087, 667544, 333772, 166886, 83443, 41722, 20861,
+    10430, 5215, 2608, 1304, 652, 326, 163, 81, 41, 20, 10, 5, 3, 1, 1
+};
+
+/* atanh(2^-i) as Q31 binary angles, i = 1..30 */
+static const int32_t cordic_soft_atanh_table[CORDIC_SOFT_MAX_ITERATIONS] =
+{
+    375486606, 174591329, 85894908, 42778589, 21368373, 10681577, 5340462,
+    2670190, 1335090, 667544, 333772, 166886, 83443, 41722, 20861, 10430,
+    5215, 2608, 1304, 652, 326, 163, 81, 41, 20, 10, 5, 3, 1, 1
+};
+
+/* Inverse circular gain in Q30 after k = 1..30 iterations */
+static const int32_t cordic_soft_gain_inv_table[CORDIC_SOFT_MAX_ITERATIONS] =
+{
+    759250125, 679093957, 658817909, 653730436, 652457347, 652138997,
+    652059405, 652039507, 652034532, 652033289, 652032978, 652032900,
+    652032881, 652032876, 652032874, 652032874, 652032874, 652032874,
+    652032874, 652032874, 652032874, 652032874, 652032874, 652032874,
+    652032874, 652032874, 652032874, 652032874, 652032874, 652032874
+};
+
+/* Inverse hyperbolic gain in Q30 after k = 1..30 iterations (repeats included) */
+static const int32_t cordic_soft_gain_inv_hyp_table[CORDIC_SOFT_MAX_ITERATIONS] =
+{
+    1239850262, 1280511845, 1290634625, 1293162805, 1295695938, 1296329066,
+    1296487338, 1296526905, 1296536797, 1296539270, 1296539888, 1296540043,
+    1296540081, 1296540091, 1296540101, 1296540103, 1296540104, 1296540104,
+    1296540104, 1296540104, 1296540104, 1296540104, 1296540104, 1296540104,
+    1296540104, 1296540104, 1296540104, 1296540104, 1296540104, 1296540104
+};
+
+/* Residual correction table for the positive half of the residual range.
+ * Entry i holds the rotation by the centre of bucket i. */
+static const cordic_soft_corr_entry_t cordic_soft_corr_table[CORDIC_SOFT_CORR_ENTRIES] =
+{
+    {   411775,     39}, {  1235324,    355}, {  2058874,    987},
+    {  2882423,   1934}, {  3705972,   3198}, {  4529520,   4777},
+    {  5353067,   6672}, {  6176614,   8883}, {  7000160,  11409},
+    {  7823705,  14252}, {  8647248,  17410}, {  9470790,  20884},
+    { 10294331,  24674}, { 11117871,  28780}, { 11941409,  33201},
+    { 12764945,  37939}, { 13588479,  42992}, { 14412011,  48361},
+    { 15235541,  54046}, { 16059069,  60046}, { 16882594,  66363},
+    { 17706117,  72995}, { 18529638,  79943}, { 19353155,  87207},
+    { 20176670,  94787}, { 21000182, 102683}, { 21823690, 110894},
+    { 22647196, 119421}, { 23470698, 128264}, { 24294197, 137423},
+    { 25117692, 146898}, { 25941183, 156688}
+};
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int32_t cordic_soft_q30_to_q31(int32_t value);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_soft_q30_to_q31
+********************************************************************************
+* Summary:
+* Converts a Q30 value of the kernel working format to Q31 with saturation.
+*
+* Parameters:
+*  int32_t value  Q30 value
+*
+* Return:
+*  int32_t        Saturated Q31 value
+*
+*******************************************************************************/
+static int32_t cordic_soft_q30_to_q31(int32_t value)
+{
+    int32_t result = INT32_MIN;
+
+    if (value >= CORDIC_SOFT_Q30_ONE)
+    {
+        result = INT32_MAX;
+    }
+    else if (value > -CORDIC_SOFT_Q30_ONE)
+    {
+        result = (int32_t)((uint32_t)value << 1);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_rotate
+********************************************************************************
+* Summary:
+* Circular rotation mode. Rotates the vector (x, y) by the given angle using the
+* requested number of iterations. The result is scaled by the circular gain of
+* that iteration count, so x and y need about one bit of headroom. Angles
+* outside +/-pi/2 are folded by a rotation by pi.
+*
+* Parameters:
+*  int32_t *x           Vector x component, in and out
+*  int32_t *y           Vector y component, in and out
+*  int32_t angle        Rotation angle, Q31 binary angle
+*  uint32_t iterations  Number of iterations, 0..CORDIC_SOFT_MAX_ITERATIONS
+*  int32_t *residual    Angle not yet rotated after the last iteration, may be NULL
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_soft_rotate(int32_t *x, int32_t *y, int32_t angle,
+                        uint32_t iterations, int32_t *residual)
+{
+    int32_t  xi = *x;
+    int32_t  yi = *y;
+    int32_t  z  = angle;
+    int32_t  xt = 0;
+    int32_t  d  = 0;
+    uint32_t i  = 0;
+
+    /* Folding the angle into the convergence range */
+    if (((uint32_t)z + CORDIC_SOFT_ANGLE_PI_2) >= CORDIC_SOFT_ANGLE_PI)
+    {
+        z  = (int32_t)((uint32_t)z + CORDIC_SOFT_ANGLE_PI);
+        xi = -xi;
+        yi = -yi;
+    }
+
+    if (iterations > CORDIC_SOFT_MAX_ITERATIONS)
+    {
+        iterations = CORDIC_SOFT_MAX_ITERATIONS;
+    }
+
+    for (i = 0U; i < iterations; i++)
+    {
+        /* d is 0 for a positive remaining angle and -1 for a negative one */
+        d  = z >> 31;
+        xt = xi;
+        xi -= ((yi >> i) ^ d) - d;
+        yi += ((xt >> i) ^ d) - d;
+        z  -= (cordic_soft_atan_table[i] ^ d) - d;
+    }
+
+    *x = xi;
+    *y = yi;
+
+    if (NULL != residual)
+    {
+        *residual = z;
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_vector
+********************************************************************************
+* Summary:
+* Circular vectoring mode. Rotates (x, y) onto the x axis and accumulates the
+* rotation angle, so that angle += atan2(y, x) and x = K * sqrt(x^2 + y^2).
+*
+* Parameters:
+*  int32_t *x           Vector x component, in and out
+*  int32_t *y           Vector y component, in and out
+*  int32_t *angle       Q31 binary angle accumulator, in and out
+*  uint32_t iterations  Number of iterations, 0..CORDIC_SOFT_MAX_ITERATIONS
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_soft_vector(int32_t *x, int32_t *y, int32_t *angle,
+                        uint32_t iterations)
+{
+    int32_t  xi = *x;
+    int32_t  yi = *y;
+    int32_t  z  = *angle;
+    int32_t  xt = 0;
+    int32_t  d  = 0;
+    uint32_t i  = 0;
+
+    /* Vectors in the left half plane are turned by pi first */
+    if (xi < 0)
+    {
+        xi = -xi;
+        yi = -yi;
+        z  = (int32_t)((uint32_t)z + CORDIC_SOFT_ANGLE_PI);
+    }
+
+    if (iterations > CORDIC_SOFT_MAX_ITERATIONS)
+    {
+        iterations = CORDIC_SOFT_MAX_ITERATIONS;
+    }
+
+    for (i = 0U; i < iterations; i++)
+    {
+        /* d is -1 while y is positive, so the vector is turned clockwise */
+        d  = ~(yi >> 31);
+        xt = xi;
+        xi -= ((yi >> i) ^ d) - d;
+        yi += ((xt >> i) ^ d) - d;
+        z  -= (cordic_soft_atan_table[i] ^ d) - d;
+    }
+
+    *x     = xi;
+    *y     = yi;
+    *angle = z;
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_rotate_hyp
+********************************************************************************
+* Summary:
+* Hyperbolic rotation mode. Starting with (x, y) = (1/Kh, 0) this gives
+* x = cosh(angle) and y = sinh(angle). The convergence range is about
+* +/-1.118 rad, no folding is done.
+*
+* Parameters:
+*  int32_t *x           Vector x component, in and out
+*  int32_t *y           Vector y component, in and out
+*  int32_t angle        Hyperbolic angle, Q31 binary angle (0x40000000 = pi/2)
+*  uint32_t iterations  Number of iterations including the repeated ones
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_soft_rotate_hyp(int32_t *x, int32_t *y, int32_t angle,
+                            uint32_t iterations)
+{
+    int32_t  xi     = *x;
+    int32_t  yi     = *y;
+    int32_t  z      = angle;
+    int32_t  xt     = 0;
+    int32_t  d      = 0;
+    uint32_t shift  = 1U;
+    uint32_t repeat = 0U;
+    uint32_t i      = 0;
+
+    for (i = 0U; (i < iterations) && (shift <= CORDIC_SOFT_MAX_ITERATIONS); i++)
+    {
+        d  = z >> 31;
+        xt = xi;
+        xi += ((yi >> shift) ^ d) - d;
+        yi += ((xt >> shift) ^ d) - d;
+        z  -= (cordic_soft_atanh_table[shift - 1U] ^ d) - d;
+
+        /* Iterations 4 and 13 are executed twice */
+        if ((0U == repeat) && ((CORDIC_SOFT_HYP_REPEAT_1 == shift) || (CORDIC_SOFT_HYP_REPEAT_2 == shift)))
+        {
+            repeat = 1U;
+        }
+        else
+        {
+            repeat = 0U;
+            shift++;
+        }
+    }
+
+    *x = xi;
+    *y = yi;
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_vector_hyp
+********************************************************************************
+* Summary:
+* Hyperbolic vectoring mode. Drives y to zero, so that angle += atanh(y / x)
+* and x = Kh * sqrt(x^2 - y^2). Requires x > |y|.
+*
+* Parameters:
+*  int32_t *x           Vector x component, in and out
+*  int32_t *y           Vector y component, in and out
+*  int32_t *angle       Q31 binary angle accumulator, in and out
+*  uint32_t iterations  Number of iterations including the repeated ones
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_soft_vector_hyp(int32_t *x, int32_t *y, int32_t *angle,
+                            uint32_t iterations)
+{
+    int32_t  xi     = *x;
+    int32_t  yi     = *y;
+    int32_t  z      = *angle;
+    int32_t  xt     = 0;
+    int32_t  d      = 0;
+    uint32_t shift  = 1U;
+    uint32_t repeat = 0U;
+    uint32_t i      = 0;
+
+    for (i = 0U; (i < iterations) && (shift <= CORDIC_SOFT_MAX_ITERATIONS); i++)
+    {
+        d  = ~(yi >> 31);
+        xt = xi;
+        xi += ((yi >> shift) ^ d) - d;
+        yi += ((xt >> shift) ^ d) - d;
+        z  -= (cordic_soft_atanh_table[shift - 1U] ^ d) - d;
+
+        if ((0U == repeat) && ((CORDIC_SOFT_HYP_REPEAT_1 == shift) || (CORDIC_SOFT_HYP_REPEAT_2 == shift)))
+        {
+            repeat = 1U;
+        }
+        else
+        {
+            repeat = 0U;
+            shift++;
+        }
+    }
+
+    *x     = xi;
+    *y     = yi;
+    *angle = z;
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_correct
+********************************************************************************
+* Summary:
+* Post-correction of a truncated circular rotation. The vector is rotated by
+* the residual angle left after the last iteration. With the table correction
+* the top bits of |residual| select a bucket whose centre rotation is read from
+* the table, and the remainder inside the bucket is applied to second order.
+* The linear correction applies the whole residual to first order, which
+* requires |residual| < pi/4.
+*
+* Parameters:
+*  int32_t *x               Vector x component, in and out
+*  int32_t *y               Vector y component, in and out
+*  int32_t residual         Residual Q31 binary angle from cordic_soft_rotate()
+*  cordic_soft_corr_t corr  Correction method
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_soft_correct(int32_t *x, int32_t *y, int32_t residual,
+                         cordic_soft_corr_t corr)
+{
+    int32_t  xi   = *x;
+    int32_t  yi   = *y;
+    int32_t  eps  = residual;
+    int32_t  xt   = 0;
+    int32_t  sign = residual >> 31;
+    uint32_t mag  = (uint32_t)((residual ^ sign) - sign);
+    uint32_t idx  = 0;
+    int32_t  s    = 0;
+    int32_t  m    = 0;
+    int32_t  e    = 0;
+
+    /* Residuals outside the table span fall back to the linear correction */
+    if ((CORDIC_SOFT_CORR_TABLE == corr) && (mag >= CORDIC_SOFT_CORR_SPAN))
+    {
+        corr = CORDIC_SOFT_CORR_LINEAR;
+    }
+
+    if (CORDIC_SOFT_CORR_TABLE == corr)
+    {
+        /* Rotation by the bucket centre, the table is symmetric in the residual sign */
+        idx = mag >> CORDIC_SOFT_CORR_SHIFT;
+        s   = (cordic_soft_corr_table[idx].sin_q31 ^ sign) - sign;
+        m   = cordic_soft_corr_table[idx].one_minus_cos_q31;
+
+        xt = xi;
+        xi = xi - CORDIC_SOFT_MUL_Q31(xi, m) - CORDIC_SOFT_MUL_Q31(yi, s);
+        yi = yi - CORDIC_SOFT_MUL_Q31(yi, m) + CORDIC_SOFT_MUL_Q31(xt, s);
+
+        /* Remainder inside the bucket */
+        e   = (int32_t)(idx << CORDIC_SOFT_CORR_SHIFT) + CORDIC_SOFT_CORR_HALF_STEP;
+        eps = residual - ((e ^ sign) - sign);
+    }
+
+    if (CORDIC_SOFT_CORR_NONE != corr)
+    {
+        /* Remaining angle converted to Q31 radians */
+        e = (int32_t)(((int64_t)eps * CORDIC_SOFT_PI_Q29) >> 29);
+
+        /* Second-order term e^2/2 after a table rotation, where e is always small */
+        if (CORDIC_SOFT_CORR_TABLE == corr)
+        {
+            m  = (int32_t)(((int64_t)e * e) >> 32);
+            xi -= CORDIC_SOFT_MUL_Q31(xi, m);
+            yi -= CORDIC_SOFT_MUL_Q31(yi, m);
+        }
+
+        xt = xi;
+        xi -= CORDIC_SOFT_MUL_Q31(yi, e);
+        yi += CORDIC_SOFT_MUL_Q31(xt, e);
+    }
+
+    *x = xi;
+    *y = yi;
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_sincos
+********************************************************************************
+* Summary:
+* Calculates the sine and cosine of a Q31 binary angle with the given number of
+* iterations and residual correction. The gain is compensated by starting from
+* the inverse gain of the selected iteration count.
+*
+* Parameters:
+*  int32_t angle            Q31 binary angle
+*  uint32_t iterations      Number of iterations
+*  cordic_soft_corr_t corr  Correction method
+*  int32_t *sin_q31         Sine result in Q31
+*  int32_t *cos_q31         Cosine result in Q31
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_soft_sincos(int32_t angle, uint32_t iterations,
+                        cordic_soft_corr_t corr,
+                        int32_t *sin_q31, int32_t *cos_q31)
+{
+    int32_t x        = cordic_soft_gain_inverse(iterations);
+    int32_t y        = 0;
+    int32_t residual = 0;
+
+    cordic_soft_rotate(&x, &y, angle, iterations, &residual);
+    cordic_soft_correct(&x, &y, residual, corr);
+
+    *sin_q31 = cordic_soft_q30_to_q31(y);
+    *cos_q31 = cordic_soft_q30_to_q31(x);
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_gain_inverse
+********************************************************************************
+* Summary:
+* Returns the inverse of the circular CORDIC gain for an iteration count.
+*
+* Parameters:
+*  uint32_t iterations  Number of iterations
+*
+* Return:
+*  int32_t              Inverse gain in Q30
+*
+*******************************************************************************/
+int32_t cordic_soft_gain_inverse(uint32_t iterations)
+{
+    int32_t result = CORDIC_SOFT_Q30_ONE;
+
+    if (iterations > CORDIC_SOFT_MAX_ITERATIONS)
+    {
+        iterations = CORDIC_SOFT_MAX_ITERATIONS;
+    }
+    if (0U != iterations)
+    {
+        result = cordic_soft_gain_inv_table[iterations - 1U];
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_gain_inverse_hyp
+********************************************************************************
+* Summary:
+* Returns the inverse of the hyperbolic CORDIC gain for an iteration count.
+*
+* Parameters:
+*  uint32_t iterations  Number of iterations including the repeated ones
+*
+* Return:
+*  int32_t              Inverse gain in Q30
+*
+*******************************************************************************/
+int32_t cordic_soft_gain_inverse_hyp(uint32_t iterations)
+{
+    int32_t result = CORDIC_SOFT_Q30_ONE;
+
+    if (iterations > CORDIC_SOFT_MAX_ITERATIONS)
+    {
+        iterations = CORDIC_SOFT_MAX_ITERATIONS;
+    }
+    if (0U != iterations)
+    {
+        result = cordic_soft_gain_inv_hyp_table[iterations - 1U];
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: cordic_soft_benchmark
+********************************************************************************
+* Summary:
+* Measures the cycles per sine/cosine evaluation and the maximum error against
+* the math library for a range of iteration counts and all correction methods.
+* The printed table gives the cycles versus accuracy curve of the kernel.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_soft_benchmark(void)
+{
+    static const uint32_t iteration_list[] = {8U, 10U, 12U, 14U, 16U, 20U, 24U};
+    static const char *corr_names[] = {"none", "linear", "table"};
+    uint32_t  k          = 0;
+    uint32_t  corr       = 0;
+    uint32_t  i          = 0;
+    uint32_t  start      = 0;
+    uint32_t  cycles     = 0;
+    int32_t   angle      = 0;
+    int32_t   sin_q31    = 0;
+    int32_t   cos_q31    = 0;
+    float64_t angle_rad  = 0;
+    float64_t error      = 0;
+    float64_t max_error  = 0;
+
+    printf("\r\nSoftware CORDIC sine/cosine, %u angles per point.", (unsigned int)CORDIC_SOFT_BENCH_SAMPLES);
+    printf("\r\niterations | correction | cycles/op | max error | bits\r\n");
+
+    for (k = 0U; k < (sizeof(iteration_list) / sizeof(iteration_list[0])); k++)
+    {
+        for (corr = CORDIC_SOFT_CORR_NONE; corr <= CORDIC_SOFT_CORR_TABLE; corr++)
+        {
+            /* Timing of the kernel alone */
+            start = cordic_benchmark_get_cycles();
+            for (i = 0U; i < CORDIC_SOFT_BENCH_SAMPLES; i++)
+            {
+                angle = (int32_t)(i * (0xFFFFFFFFUL / CORDIC_SOFT_BENCH_SAMPLES));
+                cordic_soft_sincos(angle, iteration_list[k], (cordic_soft_corr_t)corr, &sin_q31, &cos_q31);
+            }
+            cycles = (cordic_benchmark_get_cycles() - start) / CORDIC_SOFT_BENCH_SAMPLES;
+
+            /* Accuracy against the math library on the same angles */
+            max_error = 0;
+            for (i = 0U; i < CORDIC_SOFT_BENCH_SAMPLES; i++)
+            {
+                angle = (int32_t)(i * (0xFFFFFFFFUL / CORDIC_SOFT_BENCH_SAMPLES));
+                cordic_soft_sincos(angle, iteration_list[k], (cordic_soft_corr_t)corr, &sin_q31, &cos_q31);
+
+                angle_rad = (float64_t)angle * (3.141592653589793 / 2147483648.0);
+                error = fabs(((float64_t)sin_q31 / 2147483648.0) - sin(angle_rad));
+                max_error = (error > max_error) ? error : max_error;
+                error = fabs(((float64_t)cos_q31 / 2147483648.0) - cos(angle_rad));
+                max_error = (error > max_error) ? error : max_error;
+            }
+
+            printf("%10u | %10s | %9u | %9.3e | %4.1f\r\n",
+                   (unsigned int)iteration_list[k], corr_names[corr], (unsigned int)cycles,
+                   max_error, -log2(max_error));
+        }
+    }
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,98 @@
+/*******************************************************************************
+* File Name:   cordic_soft.h
+*
+* Description: This header file contains the interface to the software CORDIC
+* kernel. The kernel runs a configurable number of iterations in circular and
+* hyperbolic mode and provides a residual-error correction stage, so that a
+* truncated iteration count can still reach the required accuracy.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_SOFT_H
+#define CORDIC_SOFT_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Highest iteration count supported by the software kernel. Beyond this the
+ * elementary angles are below one LSB of the Q31 angle format. */
+#define CORDIC_SOFT_MAX_ITERATIONS      (30U)
+
+/* Number of index bits of the residual correction table. The table is
+ * symmetric, so only (1 << CORDIC_SOFT_CORR_BITS) / 2 entries are stored. */
+#define CORDIC_SOFT_CORR_BITS           (6U)
+
+/* Minimum iteration count for which the residual angle is guaranteed to fall
+ * inside the correction table (|residual| < 2^(31 - 8) in Q31 angle units). */
+#define CORDIC_SOFT_CORR_MIN_ITERATIONS (8U)
+
+/* Residual-error correction applied after the truncated iterations. */
+typedef enum
+{
+    CORDIC_SOFT_CORR_NONE   = 0, /* Plain truncated CORDIC */
+    CORDIC_SOFT_CORR_LINEAR = 1, /* First-order rotation by the residual angle */
+    CORDIC_SOFT_CORR_TABLE  = 2  /* Table rotation by the residual bucket + second-order remainder */
+} cordic_soft_corr_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* All angles are Q31 binary angles, where 0x80000000 represents -pi, which is
+ * the same format the CORDIC peripheral uses for its angle operands. */
+void cordic_soft_rotate(int32_t *x, int32_t *y, int32_t angle,
+                        uint32_t iterations, int32_t *residual);
+void cordic_soft_vector(int32_t *x, int32_t *y, int32_t *angle,
+                        uint32_t iterations);
+void cordic_soft_rotate_hyp(int32_t *x, int32_t *y, int32_t angle,
+                            uint32_t iterations);
+void cordic_soft_vector_hyp(int32_t *x, int32_t *y, int32_t *angle,
+                            uint32_t iterations);
+void cordic_soft_correct(int32_t *x, int32_t *y, int32_t residual,
+                         cordic_soft_corr_t corr);
+void cordic_soft_sincos(int32_t angle, uint32_t iterations,
+                        cordic_soft_corr_t corr,
+                        int32_t *sin_q31, int32_t *cos_q31);
+int32_t cordic_soft_gain_inverse(uint32_t iterations);
+int32_t cordic_soft_gain_inverse_hyp(uint32_t iterations);
+void cordic_soft_benchmark(void);
+
+#endif /*CORDIC_SOFT_H*/
+/* [] END OF FILE */
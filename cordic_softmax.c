@@ -0,0 +1,489 @@
+/*******************************************************************************
+* File Name:   cordic_softmax.c
+*
+* Description: This file contains the exponential and softmax kernels. The
+* argument of exp is split into n * ln2 + r with r in [0, ln2), exp(r) is the
+* sum of the sinh and cosh results of the CORDIC, and the power of two is a
+* shift. The softmax subtracts the maximum logit, so all arguments are
+* non-positive, and normalizes with a single reciprocal of the sum.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_softmax.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* ln(2) in Q27 and 1 / ln(2) in Q30 */
+#define SOFTMAX_LN2_Q27          (93032641LL)
+#define SOFTMAX_INV_LN2_Q30      (1549082005LL)
+
+/* Benchmark: vector lengths, runs per length, logit format */
+#define SOFTMAX_BENCH_SIZES      (3U)
+#define SOFTMAX_BENCH_MAX        (100U)
+#define SOFTMAX_BENCH_IMPLS      (4U)
+#define SOFTMAX_BENCH_INT_WIDTH  (3U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static q31_t softmax_exp(int32_t x_q27);
+static void  softmax_normalize(q31_t *exps, int64_t sum, uint32_t size);
+static void  softmax_float(const float32_t *in, float32_t *out, uint32_t size);
+static void  softmax_lut_q7(const q7_t *in, q7_t *out, uint32_t size);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Exponentials of the q7 softmax */
+static q31_t softmax_scratch[CORDIC_SOFTMAX_MAX_Q7];
+
+/* exp(-d / 16) in Q31 for the lookup-table baseline, logits in Q3.4 */
+static q31_t softmax_lut[256];
+
+/* Benchmark vectors */
+static q31_t     softmax_bench_q31[SOFTMAX_BENCH_MAX];
+static q31_t     softmax_bench_q31_out[SOFTMAX_BENCH_MAX];
+static q7_t      softmax_bench_q7[SOFTMAX_BENCH_MAX];
+static q7_t      softmax_bench_q7_out[SOFTMAX_BENCH_MAX];
+static float32_t softmax_bench_float[SOFTMAX_BENCH_MAX];
+static float32_t softmax_bench_float_out[SOFTMAX_BENCH_MAX];
+
+/* Vector lengths of the benchmark */
+static const uint32_t softmax_bench_size[SOFTMAX_BENCH_SIZES] = {10U, 32U, SOFTMAX_BENCH_MAX};
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: softmax_exp
+********************************************************************************
+* Summary:
+* exp of a non-positive argument. With n = floor(x / ln2) and r = x - n * ln2,
+* exp(x) = 2^n * (sinh(r) + cosh(r)); r is inside the hyperbolic range of the
+* peripheral.
+*
+* Parameters:
+*  int32_t x_q27  Argument in Q27, at most 0
+*
+* Return:
+*  q31_t          exp(x) in Q31, saturated to INT32_MAX for x = 0
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static q31_t softmax_exp(int32_t x_q27)
+{
+    int32_t         n      = (int32_t)(((int64_t)x_q27 * SOFTMAX_INV_LN2_Q30) >> 57);
+    int64_t         r      = (int64_t)x_q27 - ((int64_t)n * SOFTMAX_LN2_Q27);
+    CY_CORDIC_Q31_t angle  = (CY_CORDIC_Q31_t)((r * CORDIC_ANGLE_PER_RAD) >> 27);
+    int64_t         e      = 0;
+    uint32_t        shift  = 0;
+    q31_t           result = INT32_MAX;
+
+    if (x_q27 < 0)
+    {
+        /* exp(r) in [1, 2) in Q30, scaled by 2^(n + 1) to Q31 with n <= -1 */
+        CORDIC_TRACE(CORDIC_TRACE_OP_SINH, 1U, angle, 0, 0);
+        CORDIC_TRACE(CORDIC_TRACE_OP_COSH, 1U, angle, 0, 0);
+        e     = (int64_t)Cy_CORDIC_Sinh(MXCORDIC, angle) + Cy_CORDIC_Cosh(MXCORDIC, angle);
+        shift = (uint32_t)(-n) - 1U;
+        e     = (shift < 32U) ? ((e + ((1LL << shift) >> 1)) >> shift) : 0;
+        result = (e > INT32_MAX) ? INT32_MAX : (q31_t)e;
+    }
+
+    return result;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: softmax_normalize
+********************************************************************************
+* Summary:
+* Divides the exponentials by their sum with one reciprocal and one multiply
+* per element.
+*
+* Parameters:
+*  q31_t *exps    Exponentials in Q31, replaced by the probabilities in Q31
+*  int64_t sum    Sum of the exponentials, at least 2^30
+*  uint32_t size  Number of elements
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static void softmax_normalize(q31_t *exps, int64_t sum, uint32_t size)
+{
+    int64_t  reciprocal = ((int64_t)1 << 62) / sum;   /* 2^31 / sum in Q31 */
+    int64_t  p          = 0;
+    uint32_t i          = 0;
+
+    for (i = 0U; i < size; i++)
+    {
+        p       = (((int64_t)exps[i] * reciprocal) + (1LL << 30)) >> 31;
+        exps[i] = (p > INT32_MAX) ? INT32_MAX : (q31_t)p;
+    }
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_exp_q31
+********************************************************************************
+* Summary:
+* exp of a vector of non-positive arguments with int_width integer bits.
+*
+* Parameters:
+*  const q31_t *in      Arguments, at most 0
+*  q31_t *out           exp in Q31, may be the same array as in
+*  uint32_t size        Number of elements
+*  uint32_t int_width   Integer bits of the arguments, 0 to CORDIC_SOFTMAX_INT_WIDTH_MAX_Q31
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for NULL vectors or an unsupported int_width
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_exp_q31(const q31_t *in, q31_t *out, uint32_t size,
+                                     uint32_t int_width)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t              i      = 0;
+
+    if ((NULL != in) && (NULL != out) && (int_width <= CORDIC_SOFTMAX_INT_WIDTH_MAX_Q31))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (i = 0U; i < size; i++)
+        {
+            out[i] = softmax_exp(in[i] >> (CORDIC_SOFTMAX_INT_WIDTH_MAX_Q31 - int_width));
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_softmax_q31
+********************************************************************************
+* Summary:
+* Softmax of q31 logits with int_width integer bits. Differences to the
+* maximum below -16 give probabilities below 2^-23 and are set to zero.
+*
+* Parameters:
+*  const q31_t *in      Logits
+*  q31_t *out           Probabilities in Q0.31, may be the same array as in
+*  uint32_t size        Number of elements
+*  uint32_t int_width   Integer bits of the logits, 0 to CORDIC_SOFTMAX_INT_WIDTH_MAX_Q31
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for NULL vectors or an unsupported int_width
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_softmax_q31(const q31_t *in, q31_t *out, uint32_t size,
+                                         uint32_t int_width)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t              shift  = CORDIC_SOFTMAX_INT_WIDTH_MAX_Q31 - int_width;
+    q31_t                 max    = INT32_MIN;
+    int64_t               diff   = 0;
+    int64_t               sum    = 0;
+    uint32_t              i      = 0;
+
+    if ((NULL != in) && (NULL != out) && (int_width <= CORDIC_SOFTMAX_INT_WIDTH_MAX_Q31))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (i = 0U; i < size; i++)
+        {
+            max = (in[i] > max) ? in[i] : max;
+        }
+
+        for (i = 0U; i < size; i++)
+        {
+            diff   = ((int64_t)in[i] - max) >> shift;
+            out[i] = (diff >= INT32_MIN) ? softmax_exp((int32_t)diff) : 0;
+            sum   += out[i];
+        }
+
+        if (0U != size)
+        {
+            softmax_normalize(out, sum, size);
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_softmax_q7
+********************************************************************************
+* Summary:
+* Softmax of q7 logits with int_width integer bits. The exponentials are kept
+* in Q31 in a scratch buffer, so the vector is limited to CORDIC_SOFTMAX_MAX_Q7
+* elements.
+*
+* Parameters:
+*  const q7_t *in       Logits
+*  q7_t *out            Probabilities in Q0.7, may be the same array as in
+*  uint32_t size        Number of elements, at most CORDIC_SOFTMAX_MAX_Q7
+*  uint32_t int_width   Integer bits of the logits, 0 to CORDIC_SOFTMAX_INT_WIDTH_MAX
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for NULL vectors, an unsupported
+*                         int_width or a vector that is too long
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_softmax_q7(const q7_t *in, q7_t *out, uint32_t size,
+                                        uint32_t int_width)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    int32_t               max    = INT8_MIN;
+    int64_t               sum    = 0;
+    int32_t               p      = 0;
+    uint32_t              i      = 0;
+
+    if ((NULL != in) && (NULL != out) && (int_width <= CORDIC_SOFTMAX_INT_WIDTH_MAX) &&
+        (size <= CORDIC_SOFTMAX_MAX_Q7))
+    {
+        status = CY_CORDIC_SUCCESS;
+
+        for (i = 0U; i < size; i++)
+        {
+            max = (in[i] > max) ? in[i] : max;
+        }
+
+        for (i = 0U; i < size; i++)
+        {
+            softmax_scratch[i] = softmax_exp(((int32_t)in[i] - max) * (1L << (20U + int_width)));
+            sum += softmax_scratch[i];
+        }
+
+        if (0U != size)
+        {
+            softmax_normalize(softmax_scratch, sum, size);
+        }
+
+        for (i = 0U; i < size; i++)
+        {
+            p      = (softmax_scratch[i] >> 24) + ((softmax_scratch[i] >> 23) & 1);
+            out[i] = (q7_t)((p > INT8_MAX) ? INT8_MAX : p);
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: softmax_float
+********************************************************************************
+* Summary:
+* Floating-point reference softmax with expf(), with the max subtraction.
+*
+* Parameters:
+*  const float32_t *in  Logits
+*  float32_t *out       Probabilities
+*  uint32_t size        Number of elements, at least 1
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void softmax_float(const float32_t *in, float32_t *out, uint32_t size)
+{
+    float32_t max = in[0];
+    float32_t sum = 0.0f;
+    uint32_t  i   = 0;
+
+    for (i = 1U; i < size; i++)
+    {
+        max = (in[i] > max) ? in[i] : max;
+    }
+
+    for (i = 0U; i < size; i++)
+    {
+        out[i] = expf(in[i] - max);
+        sum   += out[i];
+    }
+
+    sum = 1.0f / sum;
+    for (i = 0U; i < size; i++)
+    {
+        out[i] *= sum;
+    }
+}
+
+/*******************************************************************************
+* Function Name: softmax_lut_q7
+********************************************************************************
+* Summary:
+* Baseline in the style of the CMSIS-NN q7 softmax: exp of the difference to
+* the maximum from a 256-entry table, logits in Q3.4, and one reciprocal.
+*
+* Parameters:
+*  const q7_t *in   Logits
+*  q7_t *out        Probabilities in Q0.7
+*  uint32_t size    Number of elements, at most CORDIC_SOFTMAX_MAX_Q7
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void softmax_lut_q7(const q7_t *in, q7_t *out, uint32_t size)
+{
+    int32_t  max = INT8_MIN;
+    int64_t  sum = 0;
+    int32_t  p   = 0;
+    uint32_t i   = 0;
+
+    for (i = 0U; i < size; i++)
+    {
+        max = (in[i] > max) ? in[i] : max;
+    }
+
+    for (i = 0U; i < size; i++)
+    {
+        softmax_scratch[i] = softmax_lut[max - in[i]];
+        sum += softmax_scratch[i];
+    }
+
+    softmax_normalize(softmax_scratch, sum, size);
+
+    for (i = 0U; i < size; i++)
+    {
+        p      = (softmax_scratch[i] >> 24) + ((softmax_scratch[i] >> 23) & 1);
+        out[i] = (q7_t)((p > INT8_MAX) ? INT8_MAX : p);
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_softmax_benchmark
+********************************************************************************
+* Summary:
+* Runs the softmax over logit vectors of 10, 32 and 100 classes with the CORDIC
+* kernels in q31 and q7, the expf() reference, and the lookup-table baseline
+* in q7, and prints the cycles and the maximum probability error of each.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_softmax_benchmark(void)
+{
+    static const char *impl_names[SOFTMAX_BENCH_IMPLS] =
+    {
+        "CORDIC q31  ", "CORDIC q7   ", "expf float  ", "table q7    "
+    };
+    uint32_t  seed   = 0x85EBCA6BUL;
+    uint32_t  start  = 0;
+    uint32_t  cycles = 0;
+    float32_t error  = 0.0f;
+    float32_t value  = 0.0f;
+    uint32_t  size   = 0;
+    uint32_t  s      = 0;
+    uint32_t  impl   = 0;
+    uint32_t  i      = 0;
+
+    for (i = 0U; i < 256U; i++)
+    {
+        softmax_lut[i] = (q31_t)fminf(expf(-(float32_t)i / 16.0f) * 2147483648.0f, 2147483520.0f);
+    }
+
+    /* Logits uniform over +/-8, in Q3.4 for all formats so that the results are comparable */
+    for (i = 0U; i < SOFTMAX_BENCH_MAX; i++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        softmax_bench_q7[i]    = (q7_t)(seed >> 24);
+        softmax_bench_q31[i]   = (q31_t)softmax_bench_q7[i] << 23;
+        softmax_bench_float[i] = (float32_t)softmax_bench_q7[i] / 16.0f;
+    }
+
+    printf("\r\nLogits uniform in +/-8\r\n");
+    printf("classes | implementation | cycles | max error\r\n");
+
+    for (s = 0U; s < SOFTMAX_BENCH_SIZES; s++)
+    {
+        size = softmax_bench_size[s];
+
+        /* Reference probabilities in float, the error of the expf() row is 0 by definition */
+        softmax_float(softmax_bench_float, softmax_bench_float_out, size);
+
+        for (impl = 0U; impl < SOFTMAX_BENCH_IMPLS; impl++)
+        {
+            start = cordic_benchmark_get_cycles();
+            switch (impl)
+            {
+                case 0U:
+                    (void)cordic_softmax_q31(softmax_bench_q31, softmax_bench_q31_out, size, CORDIC_SOFTMAX_INT_WIDTH_MAX_Q31);
+                    break;
+                case 1U:
+                    (void)cordic_softmax_q7(softmax_bench_q7, softmax_bench_q7_out, size, SOFTMAX_BENCH_INT_WIDTH);
+                    break;
+                case 2U:
+                    softmax_float(softmax_bench_float, softmax_bench_float_out, size);
+                    break;
+                default:
+                    softmax_lut_q7(softmax_bench_q7, softmax_bench_q7_out, size);
+                    break;
+            }
+            cycles = cordic_benchmark_get_cycles() - start;
+
+            error = 0.0f;
+            for (i = 0U; (2U != impl) && (i < size); i++)
+            {
+                value = (0U == impl) ? ((float32_t)softmax_bench_q31_out[i] / 2147483648.0f) :
+                                       ((float32_t)softmax_bench_q7_out[i] / 128.0f);
+                error = fmaxf(error, fabsf(value - softmax_bench_float_out[i]));
+            }
+
+            printf("%7u | %s   | %6u | %.2e\r\n", (unsigned int)size, impl_names[impl],
+                   (unsigned int)cycles, (double)error);
+        }
+    }
+}
+
+/* [] END OF FILE */
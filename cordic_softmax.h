@@ -0,0 +1,78 @@
+/*******************************************************************************
+* File Name:   cordic_softmax.h
+*
+* Description: This header file contains the interface to the exponential
+* and softmax kernels for neural-network inference, based on the hyperbolic mode
+* of the CORDIC: exp(r) = sinh(r) + cosh(r).
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_SOFTMAX_H
+#define CORDIC_SOFTMAX_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "arm_math.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Highest number of integer bits of the arguments, q7 tensors cover +/-8 and
+ * q31 tensors +/-16 */
+#define CORDIC_SOFTMAX_INT_WIDTH_MAX      (3U)
+#define CORDIC_SOFTMAX_INT_WIDTH_MAX_Q31  (4U)
+
+/* Longest q7 vector, the exponentials are kept in a Q31 scratch buffer */
+#define CORDIC_SOFTMAX_MAX_Q7             (256U)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* exp of non-positive arguments, as left by the max subtraction of a softmax;
+ * the result is Q31 and positive arguments saturate to 1.0. */
+cy_en_cordic_status_t cordic_exp_q31(const q31_t *in, q31_t *out, uint32_t size,
+                                     uint32_t int_width);
+/* Softmax of a logit vector; the probabilities are Q0.31 or Q0.7. */
+cy_en_cordic_status_t cordic_softmax_q31(const q31_t *in, q31_t *out, uint32_t size,
+                                         uint32_t int_width);
+cy_en_cordic_status_t cordic_softmax_q7(const q7_t *in, q7_t *out, uint32_t size,
+                                        uint32_t int_width);
+void cordic_softmax_benchmark(void);
+
+#endif /*CORDIC_SOFTMAX_H*/
+/* [] END OF FILE */
@@ -0,0 +1,255 @@
+/*******************************************************************************
+* File Name:   cordic_suite.c
+*
+* Description: This file contains the CORDIC operation suite. Each operation
+* takes a float operand, converts it to the fixed-point format of the driver,
+* calls the peripheral and converts the result back, the code path of the
+* interactive operations without the user input. The code generated for these
+* functions is what differs between toolchains and optimization levels; the
+* suite prints cycles per operation in a fixed layout that
+* host/toolchain_compare.sh parses, and the suite_op_ symbols give the code
+* size per operation.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "arm_math.h"
+#include "cordic_benchmark.h"
+#include "cordic_suite.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of operands per operation */
+#define SUITE_OPERANDS         (64U)
+
+/* Conversions between float and the driver formats */
+#define SUITE_RAD_TO_Q31       (683565275.6f)   /* 2^31 / pi */
+#define SUITE_Q31_TO_FLOAT     (1.0f / 2147483648.0f)
+#define SUITE_Q30_TO_FLOAT     (1.0f / 1073741824.0f)
+#define SUITE_Q23_TO_FLOAT     (1.0f / 8388608.0f)
+#define SUITE_Q11_TO_FLOAT     (1.0f / 2048.0f)
+#define SUITE_FLOAT_TO_Q31     (2147483648.0f)
+#define SUITE_FLOAT_TO_8Q23    (8388608.0f)
+#define SUITE_Q31_TO_RAD       (1.0f / 683565275.6f)
+#define SUITE_GAIN_INV         (0.607252935f)
+
+/* Operation of the suite */
+typedef struct
+{
+    const char *name;
+    float32_t (*run)(float32_t operand);
+    float32_t scale;   /* Operand range is +/-scale, or (0, scale) for sqrt */
+} cordic_suite_op_t;
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static float32_t suite_op_park(float32_t operand);
+static float32_t suite_op_sin(float32_t operand);
+static float32_t suite_op_cos(float32_t operand);
+static float32_t suite_op_tan(float32_t operand);
+static float32_t suite_op_arctan(float32_t operand);
+static float32_t suite_op_sinh(float32_t operand);
+static float32_t suite_op_cosh(float32_t operand);
+static float32_t suite_op_tanh(float32_t operand);
+static float32_t suite_op_arctanh(float32_t operand);
+static float32_t suite_op_sqrt(float32_t operand);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const cordic_suite_op_t cordic_suite_ops[] =
+{
+    {"park",    suite_op_park,    1.5f},
+    {"sin",     suite_op_sin,     1.5f},
+    {"cos",     suite_op_cos,     1.5f},
+    {"tan",     suite_op_tan,     1.5f},
+    {"arctan",  suite_op_arctan,  100.0f},
+    {"sinh",    suite_op_sinh,    1.0f},
+    {"cosh",    suite_op_cosh,    1.0f},
+    {"tanh",    suite_op_tanh,    1.0f},
+    {"arctanh", suite_op_arctanh, 0.8f},
+    {"sqrt",    suite_op_sqrt,    1.0f},
+};
+
+/* Operands, uniform in [-1, 1) */
+static float32_t suite_operands[SUITE_OPERANDS];
+
+/* Keeps the results alive */
+static volatile float32_t suite_sink;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: suite_op_park, suite_op_sin, suite_op_cos, suite_op_tan,
+*                suite_op_arctan, suite_op_sinh, suite_op_cosh, suite_op_tanh,
+*                suite_op_arctanh, suite_op_sqrt
+********************************************************************************
+* Summary:
+* One operation with its conversions. The Park transform uses the operand as
+* the angle in radians and rotates the current (0.5, 0.25); arctan and arctanh
+* use it as the ratio y / x.
+*
+* Parameters:
+*  float32_t operand  Operand
+*
+* Return:
+*  float32_t          Result, for the Park transform id + iq
+*
+*******************************************************************************/
+static float32_t suite_op_park(float32_t operand)
+{
+    cy_stc_cordic_parkTransform_result_t park;
+
+    Cy_CORDIC_ParkTransformNB(MXCORDIC, (CY_CORDIC_Q31_t)(operand * SUITE_RAD_TO_Q31),
+                              (CY_CORDIC_Q31_t)(0.5f * SUITE_FLOAT_TO_Q31),
+                              (CY_CORDIC_Q31_t)(0.25f * SUITE_FLOAT_TO_Q31));
+    while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+    Cy_CORDIC_GetParkResult(MXCORDIC, &park);
+
+    return ((float32_t)park.parkTransformId * (SUITE_Q23_TO_FLOAT * SUITE_GAIN_INV)) +
+           ((float32_t)park.parkTransformIq * (SUITE_Q23_TO_FLOAT * SUITE_GAIN_INV));
+}
+
+static float32_t suite_op_sin(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_Sin(MXCORDIC, (CY_CORDIC_Q31_t)(operand * SUITE_RAD_TO_Q31)) * SUITE_Q31_TO_FLOAT;
+}
+
+static float32_t suite_op_cos(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_Cos(MXCORDIC, (CY_CORDIC_Q31_t)(operand * SUITE_RAD_TO_Q31)) * SUITE_Q31_TO_FLOAT;
+}
+
+static float32_t suite_op_tan(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_Tan(MXCORDIC, (CY_CORDIC_Q31_t)(operand * SUITE_RAD_TO_Q31)) * SUITE_Q11_TO_FLOAT;
+}
+
+static float32_t suite_op_arctan(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_ArcTan(MXCORDIC, (CY_CORDIC_8Q23_t)SUITE_FLOAT_TO_8Q23 / 128,
+                                       (CY_CORDIC_8Q23_t)(operand * (SUITE_FLOAT_TO_8Q23 / 128.0f))) * SUITE_Q31_TO_RAD;
+}
+
+static float32_t suite_op_sinh(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_Sinh(MXCORDIC, (CY_CORDIC_Q31_t)(operand * SUITE_RAD_TO_Q31)) * SUITE_Q30_TO_FLOAT;
+}
+
+static float32_t suite_op_cosh(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_Cosh(MXCORDIC, (CY_CORDIC_Q31_t)(operand * SUITE_RAD_TO_Q31)) * SUITE_Q30_TO_FLOAT;
+}
+
+static float32_t suite_op_tanh(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_Tanh(MXCORDIC, (CY_CORDIC_Q31_t)(operand * SUITE_RAD_TO_Q31)) * SUITE_Q11_TO_FLOAT;
+}
+
+static float32_t suite_op_arctanh(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_ArcTanh(MXCORDIC, (CY_CORDIC_8Q23_t)SUITE_FLOAT_TO_8Q23,
+                                        (CY_CORDIC_8Q23_t)(operand * SUITE_FLOAT_TO_8Q23)) * SUITE_Q31_TO_RAD;
+}
+
+static float32_t suite_op_sqrt(float32_t operand)
+{
+    return (float32_t)Cy_CORDIC_Sqrt(MXCORDIC, (CY_CORDIC_Q31_t)(operand * SUITE_FLOAT_TO_Q31)) * SUITE_Q31_TO_FLOAT;
+}
+
+/*******************************************************************************
+* Function Name: cordic_suite_benchmark
+********************************************************************************
+* Summary:
+* Measures the average cycles of each operation of the suite and prints one
+* "suite | <operation> | <cycles>" line per operation.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_suite_benchmark(void)
+{
+    uint32_t  seed    = 0x3C6EF372UL;
+    uint32_t  op      = 0;
+    uint32_t  i       = 0;
+    uint32_t  start   = 0;
+    uint32_t  cycles  = 0;
+    float32_t operand = 0.0f;
+    float32_t acc     = 0.0f;
+
+    for (i = 0U; i < SUITE_OPERANDS; i++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        suite_operands[i] = (float32_t)(int32_t)seed * SUITE_Q31_TO_FLOAT;
+    }
+
+    printf("\r\nsuite | operation | cycles\r\n");
+
+    for (op = 0U; op < (sizeof(cordic_suite_ops) / sizeof(cordic_suite_ops[0])); op++)
+    {
+        start = cordic_benchmark_get_cycles();
+        for (i = 0U; i < SUITE_OPERANDS; i++)
+        {
+            operand = suite_operands[i] * cordic_suite_ops[op].scale;
+
+            /* The square root takes (0, scale) */
+            if (cordic_suite_ops[op].run == suite_op_sqrt)
+            {
+                operand = (operand < 0.0f) ? -operand : operand;
+            }
+            acc += cordic_suite_ops[op].run(operand);
+        }
+        cycles = (cordic_benchmark_get_cycles() - start) / SUITE_OPERANDS;
+
+        printf("suite | %-9s | %u\r\n", cordic_suite_ops[op].name, (unsigned int)cycles);
+    }
+
+    suite_sink = acc;
+    printf("suite | done\r\n");
+}
+
+/* [] END OF FILE */
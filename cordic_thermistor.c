@@ -0,0 +1,416 @@
+/*******************************************************************************
+* File Name:   cordic_thermistor.c
+*
+* Description: This file contains the thermistor linearization. The
+* resistance of a divider follows from the ratio of the ADC count to the
+* remaining counts, so its logarithm is the logarithm of a ratio. Both counts
+* are normalized by their exponents, which contribute a multiple of ln(2), and
+* one hyperbolic vectoring operation gives the logarithm of the ratio of the
+* mantissas as 2 atanh((u - v) / (u + v)). The Steinhart-Hart polynomial and
+* the reciprocal for the temperature run in fixed point.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "math.h"
+#include "arm_math.h"
+#include "cordic_benchmark.h"
+#include "cordic_thermistor.h"
+#include "cordic_placement.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* ln(2) in Q24 and pi in Q29, from the Q31 binary angle of atanh to Q24 */
+#define THERMISTOR_LN2_Q24          (11629080L)
+#define THERMISTOR_PI_Q29           (1686629713LL)
+#define THERMISTOR_ANGLE_SHIFT      (35U)
+
+/* Leading zeros of the normalized mantissas, [2^28, 2^29), so that their sum
+ * stays inside the 8Q23 operand range */
+#define THERMISTOR_MANTISSA_ZEROS   (3U)
+
+/* Largest number of leading zeros of 1 / T in Q44 with T inside Q16 kelvin */
+#define THERMISTOR_RECIP_ZEROS_MAX  (34U)
+
+/* Benchmark: channels and frames, 12-bit ADC, 10 kohm NTC and series resistor */
+#define THERMISTOR_BENCH_CHANNELS   (16U)
+#define THERMISTOR_BENCH_FRAMES     (64U)
+#define THERMISTOR_BENCH_COUNT      (THERMISTOR_BENCH_CHANNELS * THERMISTOR_BENCH_FRAMES)
+#define THERMISTOR_BENCH_BITS       (12U)
+#define THERMISTOR_BENCH_SERIES     (10000U)
+#define THERMISTOR_BENCH_A          (1.009249522e-3)
+#define THERMISTOR_BENCH_B          (2.378405444e-4)
+#define THERMISTOR_BENCH_C          (2.019202697e-7)
+#define THERMISTOR_BENCH_KELVIN     (65536.0)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static int32_t thermistor_ln_ratio(uint32_t u, uint32_t v);
+static int32_t thermistor_kelvin(const cordic_thermistor_t *thermistor, int32_t ln_r);
+static void    thermistor_float(const uint16_t *adc, float32_t *kelvin, uint32_t count);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Benchmark frames of 16 channels and their temperatures */
+static uint16_t  thermistor_bench_adc[THERMISTOR_BENCH_COUNT];
+static int32_t   thermistor_bench_kelvin[THERMISTOR_BENCH_COUNT];
+static float32_t thermistor_bench_float[THERMISTOR_BENCH_COUNT];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: thermistor_ln_ratio
+********************************************************************************
+* Summary:
+* ln(u / v). With u = mu 2^eu and v = mv 2^ev for mantissas of the same
+* exponent, ln(u / v) = (eu - ev) ln(2) + 2 atanh((mu - mv) / (mu + mv)). The
+* mantissa ratio lies in (1/2, 2), so the atanh argument stays within 1/3 and
+* inside the convergence range of the hyperbolic vectoring operation.
+*
+* Parameters:
+*  uint32_t u  Numerator, at least 1
+*  uint32_t v  Denominator, at least 1
+*
+* Return:
+*  int32_t     ln(u / v) in Q24
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static int32_t thermistor_ln_ratio(uint32_t u, uint32_t v)
+{
+    uint32_t         zu    = __CLZ(u);
+    uint32_t         zv    = __CLZ(v);
+    CY_CORDIC_8Q23_t mu    = (CY_CORDIC_8Q23_t)((zu >= THERMISTOR_MANTISSA_ZEROS) ?
+                                                (u << (zu - THERMISTOR_MANTISSA_ZEROS)) :
+                                                (u >> (THERMISTOR_MANTISSA_ZEROS - zu)));
+    CY_CORDIC_8Q23_t mv    = (CY_CORDIC_8Q23_t)((zv >= THERMISTOR_MANTISSA_ZEROS) ?
+                                                (v << (zv - THERMISTOR_MANTISSA_ZEROS)) :
+                                                (v >> (THERMISTOR_MANTISSA_ZEROS - zv)));
+    CY_CORDIC_Q31_t  angle = 0;
+
+    CORDIC_TRACE(CORDIC_TRACE_OP_ARCTANH, 2U, mu + mv, mu - mv, 0);
+    angle = Cy_CORDIC_ArcTanh(MXCORDIC, mu + mv, mu - mv);
+
+    /* 2 atanh in Q24 = angle * 2 pi / 2^31 * 2^24 = angle * pi / 2^6 */
+    return (((int32_t)zv - (int32_t)zu) * THERMISTOR_LN2_Q24) +
+           (int32_t)((((int64_t)angle * THERMISTOR_PI_Q29) + (1LL << (THERMISTOR_ANGLE_SHIFT - 1U))) >>
+                     THERMISTOR_ANGLE_SHIFT);
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: thermistor_kelvin
+********************************************************************************
+* Summary:
+* Steinhart-Hart equation. 1 / T is evaluated in Q44 and its reciprocal is
+* taken from the normalized 31-bit mantissa, as one 64 by 32-bit division.
+*
+* Parameters:
+*  const cordic_thermistor_t *thermistor  Sensor coefficients
+*  int32_t ln_r                           ln of the resistance in ohms, Q24
+*
+* Return:
+*  int32_t                                Temperature in Q16 kelvin, saturated
+*                                         to INT32_MAX
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static int32_t thermistor_kelvin(const cordic_thermistor_t *thermistor, int32_t ln_r)
+{
+    int64_t  cube    = (((((int64_t)ln_r * ln_r) >> CORDIC_THERMISTOR_LN_SHIFT) * ln_r) >>
+                        CORDIC_THERMISTOR_LN_SHIFT);
+    int64_t  inverse = thermistor->a + ((thermistor->b * ln_r) >> CORDIC_THERMISTOR_LN_SHIFT) +
+                       ((thermistor->c * cube) >> CORDIC_THERMISTOR_LN_SHIFT);
+    int64_t  kelvin  = INT32_MAX;
+    uint32_t high    = 0;
+    uint32_t zeros   = 0;
+    uint32_t shift   = 0;
+
+    if (inverse > 0)
+    {
+        high  = (uint32_t)((uint64_t)inverse >> 32);
+        zeros = (0U != high) ? __CLZ(high) : (32U + __CLZ((uint32_t)inverse));
+
+        if (zeros <= THERMISTOR_RECIP_ZEROS_MAX)
+        {
+            /* 1 / T = m 2^(33 - zeros) with m in [2^30, 2^31), so
+             * T = 2^(44 + 16) / (1 / T) = (2^61 / m) >> (34 - zeros) */
+            shift  = THERMISTOR_RECIP_ZEROS_MAX - zeros;
+            kelvin = (int64_t)(1ULL << 61) / (int64_t)(((uint64_t)inverse << (zeros - 1U)) >> 32);
+            kelvin = (kelvin + ((1LL << shift) >> 1)) >> shift;
+            kelvin = (kelvin > INT32_MAX) ? INT32_MAX : kelvin;
+        }
+    }
+
+    return (int32_t)kelvin;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_thermistor_init
+********************************************************************************
+* Summary:
+* Sets the Steinhart-Hart coefficients and the divider of a sensor type.
+* CORDIC_THERMISTOR_COEF() converts constant coefficients.
+*
+* Parameters:
+*  cordic_thermistor_t *thermistor  Sensor state
+*  int64_t a                        Steinhart-Hart a in 1/K, Q44
+*  int64_t b                        Steinhart-Hart b in 1/K, Q44
+*  int64_t c                        Steinhart-Hart c in 1/K, Q44
+*  uint32_t series_ohms             Series resistance in ohms
+*  uint32_t adc_bits                ADC resolution
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL pointer, a series
+*                         resistance of 0, or adc_bits out of range
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_thermistor_init(cordic_thermistor_t *thermistor, int64_t a, int64_t b, int64_t c,
+                                             uint32_t series_ohms, uint32_t adc_bits)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+
+    if ((NULL != thermistor) && (0U != series_ohms) && (adc_bits >= CORDIC_THERMISTOR_ADC_BITS_MIN) &&
+        (adc_bits <= CORDIC_THERMISTOR_ADC_BITS_MAX))
+    {
+        thermistor->a          = a;
+        thermistor->b          = b;
+        thermistor->c          = c;
+        thermistor->ln_series  = thermistor_ln_ratio(series_ohms, 1U);
+        thermistor->full_scale = 1UL << adc_bits;
+        status                 = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_thermistor_ln
+********************************************************************************
+* Summary:
+* Natural logarithms of a buffer of integers, one hyperbolic vectoring
+* operation each.
+*
+* Parameters:
+*  const uint32_t *value  Values
+*  int32_t *ln            ln(value) in Q24, INT32_MIN for 0
+*  uint32_t count         Number of values
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_thermistor_ln(const uint32_t *value, int32_t *ln, uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t i = 0;
+
+    if ((NULL != value) && (NULL != ln))
+    {
+        for (i = 0U; i < count; i++)
+        {
+            ln[i] = (0U != value[i]) ? thermistor_ln_ratio(value[i], 1U) : INT32_MIN;
+        }
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_thermistor_convert
+********************************************************************************
+* Summary:
+* Converts a buffer of ADC counts of one sensor type to temperatures. For n
+* counts, ln(R) = ln(R_series) + ln(n / (2^bits - n)), one CORDIC operation
+* per sample. The PDL has no non-blocking hyperbolic vectoring, so unlike the
+* Park batches of cordic_batch.c the CPU waits for each operation.
+*
+* Parameters:
+*  const cordic_thermistor_t *thermistor  Sensor state
+*  const uint16_t *adc                    ADC counts
+*  int32_t *kelvin                        Temperatures in Q16 kelvin
+*  uint32_t count                         Number of samples
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+cy_en_cordic_status_t cordic_thermistor_convert(const cordic_thermistor_t *thermistor, const uint16_t *adc,
+                                                int32_t *kelvin, uint32_t count)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t n = 0;
+    uint32_t i = 0;
+
+    if ((NULL != thermistor) && (NULL != adc) && (NULL != kelvin))
+    {
+        for (i = 0U; i < count; i++)
+        {
+            n         = (0U != adc[i]) ? adc[i] : 1U;
+            n         = (n < thermistor->full_scale) ? n : (thermistor->full_scale - 1U);
+            kelvin[i] = thermistor_kelvin(thermistor,
+                                          thermistor->ln_series + thermistor_ln_ratio(n, thermistor->full_scale - n));
+        }
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: thermistor_float
+********************************************************************************
+* Summary:
+* Floating-point reference conversion of the benchmark sensor with logf().
+*
+* Parameters:
+*  const uint16_t *adc  ADC counts, 1 to 2^bits - 1
+*  float32_t *kelvin    Temperatures in kelvin
+*  uint32_t count       Number of samples
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void thermistor_float(const uint16_t *adc, float32_t *kelvin, uint32_t count)
+{
+    float32_t ln_r = 0.0f;
+    uint32_t  i    = 0;
+
+    for (i = 0U; i < count; i++)
+    {
+        ln_r      = logf(((float32_t)THERMISTOR_BENCH_SERIES * (float32_t)adc[i]) /
+                         (float32_t)((1UL << THERMISTOR_BENCH_BITS) - adc[i]));
+        kelvin[i] = 1.0f / ((float32_t)THERMISTOR_BENCH_A + ((float32_t)THERMISTOR_BENCH_B * ln_r) +
+                            ((float32_t)THERMISTOR_BENCH_C * ln_r * ln_r * ln_r));
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_thermistor_benchmark
+********************************************************************************
+* Summary:
+* Converts 64 frames of 16 channels of a 10 kohm NTC divider on a 12-bit ADC,
+* swept from 5 % to 95 % of full scale, frame by frame with the CORDIC and with
+* the floating-point reference with logf(). Prints the conversion rates and
+* the largest errors against a double-precision evaluation.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_thermistor_benchmark(void)
+{
+    cordic_thermistor_t thermistor;
+    float64_t ln_r       = 0.0;
+    float64_t reference  = 0.0;
+    float64_t error      = 0.0;
+    float64_t error_f    = 0.0;
+    uint32_t  full_scale = 1UL << THERMISTOR_BENCH_BITS;
+    uint32_t  start      = 0;
+    uint32_t  cordic     = 0;
+    uint32_t  library    = 0;
+    uint32_t  i          = 0;
+
+    (void)cordic_thermistor_init(&thermistor, CORDIC_THERMISTOR_COEF(THERMISTOR_BENCH_A),
+                                 CORDIC_THERMISTOR_COEF(THERMISTOR_BENCH_B),
+                                 CORDIC_THERMISTOR_COEF(THERMISTOR_BENCH_C),
+                                 THERMISTOR_BENCH_SERIES, THERMISTOR_BENCH_BITS);
+
+    for (i = 0U; i < THERMISTOR_BENCH_COUNT; i++)
+    {
+        thermistor_bench_adc[i] = (uint16_t)((full_scale / 20U) +
+                                             ((i * ((full_scale * 9U) / 10U)) / THERMISTOR_BENCH_COUNT));
+    }
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < THERMISTOR_BENCH_COUNT; i += THERMISTOR_BENCH_CHANNELS)
+    {
+        (void)cordic_thermistor_convert(&thermistor, &thermistor_bench_adc[i], &thermistor_bench_kelvin[i],
+                                        THERMISTOR_BENCH_CHANNELS);
+    }
+    cordic = cordic_benchmark_get_cycles() - start;
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < THERMISTOR_BENCH_COUNT; i += THERMISTOR_BENCH_CHANNELS)
+    {
+        thermistor_float(&thermistor_bench_adc[i], &thermistor_bench_float[i], THERMISTOR_BENCH_CHANNELS);
+    }
+    library = cordic_benchmark_get_cycles() - start;
+
+    for (i = 0U; i < THERMISTOR_BENCH_COUNT; i++)
+    {
+        ln_r      = log(((float64_t)THERMISTOR_BENCH_SERIES * (float64_t)thermistor_bench_adc[i]) /
+                        (float64_t)(full_scale - thermistor_bench_adc[i]));
+        reference = 1.0 / (THERMISTOR_BENCH_A + (THERMISTOR_BENCH_B * ln_r) + (THERMISTOR_BENCH_C * ln_r * ln_r * ln_r));
+        error     = fmax(error, fabs(((float64_t)thermistor_bench_kelvin[i] / THERMISTOR_BENCH_KELVIN) - reference));
+        error_f   = fmax(error_f, fabs((float64_t)thermistor_bench_float[i] - reference));
+    }
+
+    cordic  = (0U != cordic) ? cordic : 1U;
+    library = (0U != library) ? library : 1U;
+
+    printf("\r\n%u channels x %u frames, %u-bit ADC, 10 kohm NTC from %.1f to %.1f degC\r\n",
+           (unsigned int)THERMISTOR_BENCH_CHANNELS, (unsigned int)THERMISTOR_BENCH_FRAMES,
+           (unsigned int)THERMISTOR_BENCH_BITS,
+           ((float64_t)thermistor_bench_kelvin[THERMISTOR_BENCH_COUNT - 1U] / THERMISTOR_BENCH_KELVIN) - 273.15,
+           ((float64_t)thermistor_bench_kelvin[0] / THERMISTOR_BENCH_KELVIN) - 273.15);
+    printf("Method          | conversions/s | max error (mK)\r\n");
+    printf("CORDIC ln       | %13u | %14.3f\r\n",
+           (unsigned int)(((uint64_t)SystemCoreClock * THERMISTOR_BENCH_COUNT) / cordic), error * 1000.0);
+    printf("logf            | %13u | %14.3f\r\n",
+           (unsigned int)(((uint64_t)SystemCoreClock * THERMISTOR_BENCH_COUNT) / library), error_f * 1000.0);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,94 @@
+/*******************************************************************************
+* File Name:   cordic_thermistor.h
+*
+* Description: This header file contains the interface to the thermistor
+* linearization: ADC counts of an NTC voltage divider to temperature with the
+* Steinhart-Hart equation and the CORDIC natural logarithm.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_THERMISTOR_H
+#define CORDIC_THERMISTOR_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Logarithms are Q24, temperatures Q16 kelvin */
+#define CORDIC_THERMISTOR_LN_SHIFT      (24U)
+#define CORDIC_THERMISTOR_KELVIN_SHIFT  (16U)
+
+/* Steinhart-Hart coefficients are Q44; converts a constant coefficient */
+#define CORDIC_THERMISTOR_COEF_SHIFT    (44U)
+#define CORDIC_THERMISTOR_COEF(x)       ((int64_t)((x) * 17592186044416.0))
+
+/* Supported ADC resolutions */
+#define CORDIC_THERMISTOR_ADC_BITS_MIN  (8U)
+#define CORDIC_THERMISTOR_ADC_BITS_MAX  (16U)
+
+/* Linearization of one sensor type. The thermistor is connected from the ADC
+ * input to ground and the series resistor to the ADC reference, so
+ * R = R_series * n / (2^bits - n) for n counts. */
+typedef struct
+{
+    int64_t  a;             /* Steinhart-Hart a in 1/K, Q44 */
+    int64_t  b;             /* Steinhart-Hart b in 1/K, Q44 */
+    int64_t  c;             /* Steinhart-Hart c in 1/K, Q44 */
+    int32_t  ln_series;     /* ln of the series resistance in ohms, Q24 */
+    uint32_t full_scale;    /* ADC counts of the reference voltage, 2^bits */
+} cordic_thermistor_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* 1 / T = a + b ln(R) + c ln(R)^3 with T in kelvin and R in ohms */
+cy_en_cordic_status_t cordic_thermistor_init(cordic_thermistor_t *thermistor, int64_t a, int64_t b, int64_t c,
+                                             uint32_t series_ohms, uint32_t adc_bits);
+/* ln receives ln(value) in Q24, INT32_MIN for a value of 0 */
+cy_en_cordic_status_t cordic_thermistor_ln(const uint32_t *value, int32_t *ln, uint32_t count);
+/* kelvin receives the temperatures in Q16 kelvin. Counts of 0 and of full
+ * scale and above, a shorted or an open sensor, are clamped to the nearest
+ * valid count. */
+cy_en_cordic_status_t cordic_thermistor_convert(const cordic_thermistor_t *thermistor, const uint16_t *adc,
+                                                int32_t *kelvin, uint32_t count);
+void cordic_thermistor_benchmark(void);
+
+#endif /*CORDIC_THERMISTOR_H*/
+/* [] END OF FILE */
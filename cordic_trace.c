@@ -0,0 +1,476 @@
+/*******************************************************************************
+* File Name:   cordic_trace.c
+*
+* Description: This file contains the CORDIC operand trace: a RAM ring buffer
+* filled by the CORDIC_TRACE() hooks, the encoder and decoder of the compact
+* binary trace format, and the hex dump of the trace over the UART.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "cordic_benchmark.h"
+#include "cordic_trace.h"
+#include "cordic_placement.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Index mask of the ring buffer */
+#define CORDIC_TRACE_MASK          (CORDIC_TRACE_DEPTH - 1U)
+
+/* Fields of the first record byte */
+#define CORDIC_TRACE_OP_MASK       (0x0FU)
+#define CORDIC_TRACE_COUNT_SHIFT   (4U)
+#define CORDIC_TRACE_COUNT_MASK    (0x03U)
+#define CORDIC_TRACE_LONG_DELTA    (0x80U)
+
+/* Largest timestamp delta stored in the 2-byte form */
+#define CORDIC_TRACE_SHORT_DELTA_MAX (0xFFFFU)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static void     trace_put_u32(uint8_t *buffer, uint32_t value);
+static uint32_t trace_get_u32(const uint8_t *buffer);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Ring buffer and the number of records written since the last clear */
+static cordic_trace_record_t cordic_trace_ring[CORDIC_TRACE_DEPTH];
+static uint32_t              cordic_trace_written = 0;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: trace_put_u32
+********************************************************************************
+* Summary:
+* Stores a 32-bit value in little-endian byte order.
+*
+* Parameters:
+*  uint8_t *buffer  Destination, 4 bytes
+*  uint32_t value   Value to store
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void trace_put_u32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)value;
+    buffer[1] = (uint8_t)(value >> 8);
+    buffer[2] = (uint8_t)(value >> 16);
+    buffer[3] = (uint8_t)(value >> 24);
+}
+
+/*******************************************************************************
+* Function Name: trace_get_u32
+********************************************************************************
+* Summary:
+* Loads a 32-bit value stored in little-endian byte order.
+*
+* Parameters:
+*  const uint8_t *buffer  Source, 4 bytes
+*
+* Return:
+*  uint32_t               Loaded value
+*
+*******************************************************************************/
+static uint32_t trace_get_u32(const uint8_t *buffer)
+{
+    return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) |
+           ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+/*******************************************************************************
+* Function Name: cordic_trace_clear
+********************************************************************************
+* Summary:
+* Discards all recorded operations.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_trace_clear(void)
+{
+    cordic_trace_written = 0U;
+}
+
+/*******************************************************************************
+* Function Name: cordic_trace_record
+********************************************************************************
+* Summary:
+* Records one CORDIC call. The record overwrites the oldest one when the ring
+* is full. Only raw values are stored here, the encoding is done at dump time
+* so that the hook costs a few stores. Records are written from the thread
+* context only, the application does not use the CORDIC from interrupts.
+*
+* Parameters:
+*  cordic_trace_op_t op  Operation
+*  uint32_t count        Number of operands, 1..CORDIC_TRACE_MAX_OPERANDS
+*  int32_t a             First operand
+*  int32_t b             Second operand, ignored when count < 2
+*  int32_t c             Third operand, ignored when count < 3
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+void cordic_trace_record(cordic_trace_op_t op, uint32_t count,
+                         int32_t a, int32_t b, int32_t c)
+{
+    cordic_trace_record_t *record = &cordic_trace_ring[cordic_trace_written & CORDIC_TRACE_MASK];
+
+    record->timestamp     = cordic_benchmark_get_cycles();
+    record->op            = (uint8_t)op;
+    record->operand_count = (uint8_t)count;
+    record->operand[0]    = a;
+    record->operand[1]    = b;
+    record->operand[2]    = c;
+
+    cordic_trace_written++;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: cordic_trace_count
+********************************************************************************
+* Summary:
+* Returns the number of records available in the ring buffer.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t  Number of records, at most CORDIC_TRACE_DEPTH
+*
+*******************************************************************************/
+uint32_t cordic_trace_count(void)
+{
+    return (cordic_trace_written < CORDIC_TRACE_DEPTH) ? cordic_trace_written : CORDIC_TRACE_DEPTH;
+}
+
+/*******************************************************************************
+* Function Name: cordic_trace_get
+********************************************************************************
+* Summary:
+* Reads a record from the ring buffer, index 0 being the oldest one.
+*
+* Parameters:
+*  uint32_t index                  Record index
+*  cordic_trace_record_t *record   Copy of the record
+*
+* Return:
+*  bool  false when the index is out of range
+*
+*******************************************************************************/
+bool cordic_trace_get(uint32_t index, cordic_trace_record_t *record)
+{
+    uint32_t count  = cordic_trace_count();
+    bool     status = false;
+
+    if (index < count)
+    {
+        *record = cordic_trace_ring[(cordic_trace_written - count + index) & CORDIC_TRACE_MASK];
+        status  = true;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_trace_encode_header
+********************************************************************************
+* Summary:
+* Encodes the trace header in the binary format.
+*
+* Parameters:
+*  uint8_t *buffer                       Destination, CORDIC_TRACE_HEADER_SIZE bytes
+*  const cordic_trace_header_t *header   Header to encode
+*
+* Return:
+*  uint32_t  Number of bytes written
+*
+*******************************************************************************/
+uint32_t cordic_trace_encode_header(uint8_t *buffer, const cordic_trace_header_t *header)
+{
+    buffer[0] = (uint8_t)'C';
+    buffer[1] = (uint8_t)'T';
+    buffer[2] = (uint8_t)'R';
+    buffer[3] = (uint8_t)'C';
+    buffer[4] = header->version;
+    buffer[5] = (uint8_t)CORDIC_TRACE_HEADER_SIZE;
+    buffer[6] = header->flags;
+    buffer[7] = 0U;
+    trace_put_u32(&buffer[8], header->record_count);
+    trace_put_u32(&buffer[12], header->clock_hz);
+
+    return CORDIC_TRACE_HEADER_SIZE;
+}
+
+/*******************************************************************************
+* Function Name: cordic_trace_encode_record
+********************************************************************************
+* Summary:
+* Encodes a record in the binary format. The timestamp is stored as the
+* delta to the previous record, in 2 bytes when it fits.
+*
+* Parameters:
+*  uint8_t *buffer                       Destination, CORDIC_TRACE_RECORD_MAX bytes
+*  const cordic_trace_record_t *record   Record to encode
+*  uint32_t previous_timestamp           Timestamp of the previous record
+*
+* Return:
+*  uint32_t  Number of bytes written
+*
+*******************************************************************************/
+uint32_t cordic_trace_encode_record(uint8_t *buffer, const cordic_trace_record_t *record,
+                                    uint32_t previous_timestamp)
+{
+    uint32_t delta  = record->timestamp - previous_timestamp;
+    uint32_t length = 1U;
+    uint32_t i      = 0;
+
+    buffer[0] = (uint8_t)((record->op & CORDIC_TRACE_OP_MASK) |
+                          ((record->operand_count & CORDIC_TRACE_COUNT_MASK) << CORDIC_TRACE_COUNT_SHIFT));
+
+    if (delta > CORDIC_TRACE_SHORT_DELTA_MAX)
+    {
+        buffer[0] |= CORDIC_TRACE_LONG_DELTA;
+        trace_put_u32(&buffer[length], delta);
+        length += 4U;
+    }
+    else
+    {
+        buffer[length]      = (uint8_t)delta;
+        buffer[length + 1U] = (uint8_t)(delta >> 8);
+        length += 2U;
+    }
+
+    for (i = 0U; i < record->operand_count; i++)
+    {
+        trace_put_u32(&buffer[length], (uint32_t)record->operand[i]);
+        length += 4U;
+    }
+
+    return length;
+}
+
+/*******************************************************************************
+* Function Name: cordic_trace_decode_header
+********************************************************************************
+* Summary:
+* Decodes the trace header from the binary format.
+*
+* Parameters:
+*  const uint8_t *buffer           Source
+*  uint32_t length                 Number of bytes available
+*  cordic_trace_header_t *header   Decoded header
+*
+* Return:
+*  uint32_t  Number of bytes consumed, 0 when the header is not valid
+*
+*******************************************************************************/
+uint32_t cordic_trace_decode_header(const uint8_t *buffer, uint32_t length,
+                                    cordic_trace_header_t *header)
+{
+    uint32_t consumed = 0U;
+
+    if ((length >= CORDIC_TRACE_HEADER_SIZE) &&
+        ('C' == buffer[0]) && ('T' == buffer[1]) && ('R' == buffer[2]) && ('C' == buffer[3]) &&
+        (CORDIC_TRACE_VERSION == buffer[4]) && (buffer[5] >= CORDIC_TRACE_HEADER_SIZE) &&
+        (buffer[5] <= length))
+    {
+        header->version      = buffer[4];
+        header->flags        = buffer[6];
+        header->record_count = trace_get_u32(&buffer[8]);
+        header->clock_hz     = trace_get_u32(&buffer[12]);
+
+        /* Later versions may append fields to the header */
+        consumed = buffer[5];
+    }
+
+    return consumed;
+}
+
+/*******************************************************************************
+* Function Name: cordic_trace_decode_record
+********************************************************************************
+* Summary:
+* Decodes one record from the binary format.
+*
+* Parameters:
+*  const uint8_t *buffer           Source
+*  uint32_t length                 Number of bytes available
+*  cordic_trace_record_t *record   Decoded record
+*  uint32_t previous_timestamp     Timestamp of the previous record
+*
+* Return:
+*  uint32_t  Number of bytes consumed, 0 when the record is truncated or invalid
+*
+*******************************************************************************/
+uint32_t cordic_trace_decode_record(const uint8_t *buffer, uint32_t length,
+                                    cordic_trace_record_t *record,
+                                    uint32_t previous_timestamp)
+{
+    uint32_t consumed = 0U;
+    uint32_t needed   = 0U;
+    uint32_t delta    = 0U;
+    uint32_t count    = 0U;
+    uint32_t i        = 0;
+
+    if (length > 0U)
+    {
+        count  = ((uint32_t)buffer[0] >> CORDIC_TRACE_COUNT_SHIFT) & CORDIC_TRACE_COUNT_MASK;
+        needed = 1U + ((0U != (buffer[0] & CORDIC_TRACE_LONG_DELTA)) ? 4U : 2U) + (4U * count);
+
+        if ((needed <= length) && ((buffer[0] & CORDIC_TRACE_OP_MASK) < (uint32_t)CORDIC_TRACE_OP_COUNT))
+        {
+            consumed = 1U;
+
+            if (0U != (buffer[0] & CORDIC_TRACE_LONG_DELTA))
+            {
+                delta     = trace_get_u32(&buffer[consumed]);
+                consumed += 4U;
+            }
+            else
+            {
+                delta     = (uint32_t)buffer[consumed] | ((uint32_t)buffer[consumed + 1U] << 8);
+                consumed += 2U;
+            }
+
+            record->timestamp     = previous_timestamp + delta;
+            record->op            = (uint8_t)(buffer[0] & CORDIC_TRACE_OP_MASK);
+            record->operand_count = (uint8_t)count;
+
+            for (i = 0U; i < CORDIC_TRACE_MAX_OPERANDS; i++)
+            {
+                record->operand[i] = 0;
+            }
+
+            for (i = 0U; i < count; i++)
+            {
+                record->operand[i] = (int32_t)trace_get_u32(&buffer[consumed]);
+                consumed += 4U;
+            }
+        }
+    }
+
+    return consumed;
+}
+
+/*******************************************************************************
+* Function Name: cordic_trace_dump
+********************************************************************************
+* Summary:
+* Prints the recorded operations as hex between the dump markers, the header
+* on the first line and one record per line, and clears the trace. The host
+* replay tool reads the captured terminal output directly.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_trace_dump(void)
+{
+    uint8_t               buffer[CORDIC_TRACE_HEADER_SIZE + CORDIC_TRACE_RECORD_MAX];
+    cordic_trace_header_t header;
+    cordic_trace_record_t record   = {0};
+    uint32_t              previous = 0U;
+    uint32_t              length   = 0U;
+    uint32_t              index    = 0;
+    uint32_t              i        = 0;
+
+    header.version      = (uint8_t)CORDIC_TRACE_VERSION;
+    header.flags        = (cordic_trace_written > CORDIC_TRACE_DEPTH) ? (uint8_t)CORDIC_TRACE_FLAG_WRAPPED : 0U;
+    header.record_count = cordic_trace_count();
+    header.clock_hz     = SystemCoreClock;
+
+    if (0U == CORDIC_TRACE_ENABLED)
+    {
+        printf("\r\nTracing is not compiled in, build with CORDIC_TRACE=1.\r\n");
+    }
+
+    printf("\r\n%s\r\n", CORDIC_TRACE_DUMP_BEGIN);
+
+    length = cordic_trace_encode_header(buffer, &header);
+    for (i = 0U; i < length; i++)
+    {
+        printf("%02X", buffer[i]);
+    }
+    printf("\r\n");
+
+    for (index = 0U; index < header.record_count; index++)
+    {
+        (void)cordic_trace_get(index, &record);
+
+        /* The first record is the time origin */
+        if (0U == index)
+        {
+            previous = record.timestamp;
+        }
+
+        length   = cordic_trace_encode_record(buffer, &record, previous);
+        previous = record.timestamp;
+
+        for (i = 0U; i < length; i++)
+        {
+            printf("%02X", buffer[i]);
+        }
+        printf("\r\n");
+    }
+
+    printf("%s\r\n", CORDIC_TRACE_DUMP_END);
+    printf("%lu records dumped, trace cleared.\r\n", (unsigned long)header.record_count);
+
+    cordic_trace_clear();
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,154 @@
+/*******************************************************************************
+* File Name:   cordic_trace.h
+*
+* Description: This header file contains the interface of the CORDIC operand
+* trace. When CORDIC_TRACE_ENABLED is set, every CORDIC call of the application
+* records its operation, operands and a cycle timestamp in a RAM ring buffer.
+* The trace is dumped over the UART in a compact binary format and replayed on
+* the host against the emulated peripheral and the software kernels.
+*
+* Binary format, all fields little-endian:
+*   Header, CORDIC_TRACE_HEADER_SIZE bytes
+*     [0..3]   magic "CTRC"
+*     [4]      format version, CORDIC_TRACE_VERSION
+*     [5]      header size in bytes
+*     [6]      flags, CORDIC_TRACE_FLAG_WRAPPED when older records were lost
+*     [7]      reserved, 0
+*     [8..11]  record count
+*     [12..15] core clock in Hz
+*   Record, 3 to 17 bytes
+*     [0]      bits 0..3 operation, bits 4..5 operand count,
+*              bit 7 set when the timestamp delta takes 4 bytes instead of 2
+*     [1..]    cycles since the previous record, the first record has 0
+*     [..]     operands, 4 bytes each
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_TRACE_H
+#define CORDIC_TRACE_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Set to 1 by the build (make CORDIC_TRACE=1) to record the CORDIC calls */
+#ifndef CORDIC_TRACE_ENABLED
+#define CORDIC_TRACE_ENABLED       (0)
+#endif
+
+/* Number of records kept in RAM, must be a power of two */
+#define CORDIC_TRACE_DEPTH         (256U)
+
+/* Largest operand count of a traced operation */
+#define CORDIC_TRACE_MAX_OPERANDS  (3U)
+
+/* Binary format, see the file description */
+#define CORDIC_TRACE_VERSION       (1U)
+#define CORDIC_TRACE_HEADER_SIZE   (16U)
+#define CORDIC_TRACE_RECORD_MAX    (1U + 4U + (4U * CORDIC_TRACE_MAX_OPERANDS))
+#define CORDIC_TRACE_FLAG_WRAPPED  (0x01U)
+
+/* Markers around the hex dump, the host replay tool searches for them */
+#define CORDIC_TRACE_DUMP_BEGIN    "CORDIC TRACE BEGIN"
+#define CORDIC_TRACE_DUMP_END      "CORDIC TRACE END"
+
+/* Records the operands of a CORDIC call. Compiles to nothing unless enabled. */
+#if (CORDIC_TRACE_ENABLED)
+#define CORDIC_TRACE(op, count, a, b, c) cordic_trace_record((op), (count), (a), (b), (c))
+#else
+#define CORDIC_TRACE(op, count, a, b, c)
+#endif
+
+/* Traced operations. The operands are recorded in the order of the driver
+ * function parameters. */
+typedef enum
+{
+    CORDIC_TRACE_OP_PARK    = 0,  /* theta, i alpha, i beta */
+    CORDIC_TRACE_OP_SIN     = 1,  /* angle */
+    CORDIC_TRACE_OP_COS     = 2,  /* angle */
+    CORDIC_TRACE_OP_TAN     = 3,  /* angle */
+    CORDIC_TRACE_OP_ARCTAN  = 4,  /* x, y */
+    CORDIC_TRACE_OP_SINH    = 5,  /* angle */
+    CORDIC_TRACE_OP_COSH    = 6,  /* angle */
+    CORDIC_TRACE_OP_TANH    = 7,  /* angle */
+    CORDIC_TRACE_OP_ARCTANH = 8,  /* x, y */
+    CORDIC_TRACE_OP_SQRT    = 9,  /* value */
+    CORDIC_TRACE_OP_COUNT   = 10
+} cordic_trace_op_t;
+
+/* Trace record as kept in RAM */
+typedef struct
+{
+    uint32_t timestamp;
+    uint8_t  op;
+    uint8_t  operand_count;
+    int32_t  operand[CORDIC_TRACE_MAX_OPERANDS];
+} cordic_trace_record_t;
+
+/* Trace header as decoded from the binary format */
+typedef struct
+{
+    uint8_t  version;
+    uint8_t  flags;
+    uint32_t record_count;
+    uint32_t clock_hz;
+} cordic_trace_header_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void     cordic_trace_clear(void);
+void     cordic_trace_record(cordic_trace_op_t op, uint32_t count,
+                             int32_t a, int32_t b, int32_t c);
+uint32_t cordic_trace_count(void);
+bool     cordic_trace_get(uint32_t index, cordic_trace_record_t *record);
+uint32_t cordic_trace_encode_header(uint8_t *buffer, const cordic_trace_header_t *header);
+uint32_t cordic_trace_encode_record(uint8_t *buffer, const cordic_trace_record_t *record,
+                                    uint32_t previous_timestamp);
+uint32_t cordic_trace_decode_header(const uint8_t *buffer, uint32_t length,
+                                    cordic_trace_header_t *header);
+uint32_t cordic_trace_decode_record(const uint8_t *buffer, uint32_t length,
+                                    cordic_trace_record_t *record,
+                                    uint32_t previous_timestamp);
+void     cordic_trace_dump(void);
+
+#endif /*CORDIC_TRACE_H*/
+/* [] END OF FILE */
@@ -0,0 +1,572 @@
+/*******************************************************************************
+* File Name:   cordic_vocoder.c
+*
+* Description: This file contains the phase-vocoder stage. The phase of
+* every bin comes from the CORDIC vectoring operation. The phase advance is
+* evaluated in binary angles, where the wrap into (-pi, pi] is the natural
+* overflow of 32-bit arithmetic. The bins are rotated back to rectangular form
+* with cordic_batch_rotate() or, for the magnitudes, measured with
+* cordic_batch_park(), in chunks of CORDIC_BATCH_CHUNK bins.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "string.h"
+#include "math.h"
+#include "cordic_angle.h"
+#include "cordic_benchmark.h"
+#include "cordic_batch.h"
+#include "cordic_vocoder.h"
+#include "cordic_placement.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Fraction bits of the hop ratio */
+#define VOCODER_RATIO_SHIFT      (16U)
+
+/* Frame sizes of the benchmark and the frames per measurement */
+#define VOCODER_BENCH_SIZES      (3U)
+#define VOCODER_BENCH_BINS       (1024U)
+#define VOCODER_BENCH_FRAMES     (4U)
+
+/* Bins compared with the floating-point reference */
+#define VOCODER_BENCH_COMPARE    (256U)
+
+/* Conversions of the benchmark */
+#define VOCODER_Q31_TO_FLOAT     (1.0f / 2147483648.0f)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static uint32_t vocoder_advance(cordic_vocoder_t *vocoder, uint32_t k, uint32_t phase);
+static uint32_t vocoder_chunk(uint32_t bins, uint32_t start);
+static void     vocoder_float(uint32_t bins, uint32_t fft_length, float32_t *spectrum,
+                              float32_t *last_phase, float32_t *synth_phase, bool started);
+static void     vocoder_bench_spectrum(uint32_t bins, uint32_t frame, bool as_float);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Operands and results of the batch calls */
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t vocoder_angle[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t vocoder_re[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t vocoder_im[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t vocoder_out_re[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t vocoder_out_im[CORDIC_BATCH_CHUNK];
+
+/* Benchmark buffers. The fixed-point and the floating-point runs share the
+ * memory; the fixed-point result to compare is copied aside. */
+static union
+{
+    struct
+    {
+        q31_t    spectrum[2U * VOCODER_BENCH_BINS];
+        uint32_t last_phase[VOCODER_BENCH_BINS];
+        uint32_t synth_phase[VOCODER_BENCH_BINS];
+    } fixed;
+    struct
+    {
+        float32_t spectrum[2U * VOCODER_BENCH_BINS];
+        float32_t last_phase[VOCODER_BENCH_BINS];
+        float32_t synth_phase[VOCODER_BENCH_BINS];
+    } flt;
+} vocoder_bench;
+static q31_t vocoder_bench_magnitude[VOCODER_BENCH_BINS];
+static q31_t vocoder_bench_result[2U * VOCODER_BENCH_COMPARE];
+
+/* Frame sizes of the benchmark */
+static const uint32_t vocoder_bench_bins[VOCODER_BENCH_SIZES] = { 256U, 512U, 1024U };
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cordic_vocoder_init
+********************************************************************************
+* Summary:
+* Initializes a phase vocoder. The phase advance of bin k per hop is
+* k * 2 * pi * hop / fft_length, which is exact in binary angles for a
+* power-of-two FFT length.
+*
+* Parameters:
+*  cordic_vocoder_t *vocoder  Vocoder state
+*  uint32_t bins              Number of bins of a frame
+*  uint32_t fft_length        FFT length, a power of two
+*  uint32_t analysis_hop      Hop between the analysis frames in samples
+*  uint32_t synthesis_hop     Hop between the synthesis frames in samples
+*  uint32_t *last_phase       bins values for the analysis phases
+*  uint32_t *synth_phase      bins values for the synthesis phases
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for NULL pointers, a zero hop or
+*                         bin count, or an FFT length that is not a power of two
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_vocoder_init(cordic_vocoder_t *vocoder, uint32_t bins,
+                                          uint32_t fft_length, uint32_t analysis_hop,
+                                          uint32_t synthesis_hop, uint32_t *last_phase,
+                                          uint32_t *synth_phase)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint64_t ratio = 0;
+
+    if ((NULL != vocoder) && (NULL != last_phase) && (NULL != synth_phase) && (0U != bins) &&
+        (0U != analysis_hop) && (0U != synthesis_hop) &&
+        (0U != fft_length) && (0U == (fft_length & (fft_length - 1U))))
+    {
+        ratio = ((uint64_t)synthesis_hop << VOCODER_RATIO_SHIFT) / analysis_hop;
+        if (ratio <= (uint64_t)INT32_MAX)
+        {
+            vocoder->bins           = bins;
+            vocoder->analysis_step  = (uint32_t)(((uint64_t)analysis_hop << 32) / fft_length);
+            vocoder->synthesis_step = (uint32_t)(((uint64_t)synthesis_hop << 32) / fft_length);
+            vocoder->ratio          = (int32_t)ratio;
+            vocoder->last_phase     = last_phase;
+            vocoder->synth_phase    = synth_phase;
+            vocoder->started        = false;
+            status                  = CY_CORDIC_SUCCESS;
+
+            (void)memset(last_phase, 0, bins * sizeof(uint32_t));
+            (void)memset(synth_phase, 0, bins * sizeof(uint32_t));
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: vocoder_advance
+********************************************************************************
+* Summary:
+* Phase propagation of one bin. The deviation of the measured phase step from
+* the bin centre wraps into (-pi, pi] as a 32-bit difference and is scaled by
+* the hop ratio; the bin centre advance of the synthesis hop is exact. The
+* first frame takes the analysis phases unchanged.
+*
+* Parameters:
+*  cordic_vocoder_t *vocoder  Vocoder state
+*  uint32_t k                 Bin index
+*  uint32_t phase             Analysis phase of the bin
+*
+* Return:
+*  uint32_t                   Synthesis phase of the bin
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static uint32_t vocoder_advance(cordic_vocoder_t *vocoder, uint32_t k, uint32_t phase)
+{
+    int32_t  delta = cordic_angle_diff(phase, vocoder->last_phase[k] + (k * vocoder->analysis_step));
+    uint32_t synth = vocoder->synth_phase[k] + (k * vocoder->synthesis_step) +
+                     (uint32_t)(((int64_t)delta * vocoder->ratio) >> VOCODER_RATIO_SHIFT);
+
+    synth                   = vocoder->started ? synth : phase;
+    vocoder->last_phase[k]  = phase;
+    vocoder->synth_phase[k] = synth;
+
+    return synth;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: vocoder_chunk
+********************************************************************************
+* Summary:
+* Number of bins of the chunk that starts at a bin.
+*
+* Parameters:
+*  uint32_t bins   Number of bins of the frame
+*  uint32_t start  First bin of the chunk
+*
+* Return:
+*  uint32_t        At most CORDIC_BATCH_CHUNK
+*
+*******************************************************************************/
+static uint32_t vocoder_chunk(uint32_t bins, uint32_t start)
+{
+    return ((bins - start) < CORDIC_BATCH_CHUNK) ? (bins - start) : CORDIC_BATCH_CHUNK;
+}
+
+/*******************************************************************************
+* Function Name: cordic_vocoder_analyze
+********************************************************************************
+* Summary:
+* Converts a frame to magnitudes and advances the synthesis phases. The
+* magnitude is the d component of a Park transform by the phase of the bin.
+*
+* Parameters:
+*  cordic_vocoder_t *vocoder  Vocoder state
+*  const q31_t *spectrum      bins interleaved {re, im} pairs
+*  q31_t *magnitude           bins magnitudes in Q31
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_vocoder_analyze(cordic_vocoder_t *vocoder, const q31_t *spectrum,
+                                             q31_t *magnitude)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t start = 0;
+    uint32_t count = 0;
+    uint32_t k     = 0;
+    uint32_t i     = 0;
+    uint32_t phase = 0;
+
+    if ((NULL != vocoder) && (NULL != spectrum) && (NULL != magnitude))
+    {
+        for (start = 0U; start < vocoder->bins; start += count)
+        {
+            count = vocoder_chunk(vocoder->bins, start);
+
+            for (i = 0U; i < count; i++)
+            {
+                k                = start + i;
+                vocoder_re[i]    = spectrum[2U * k];
+                vocoder_im[i]    = spectrum[(2U * k) + 1U];
+                phase            = cordic_angle_vector(vocoder_re[i], vocoder_im[i],
+                                                       vocoder->last_phase[k] + (k * vocoder->analysis_step));
+                vocoder_angle[i] = (CY_CORDIC_Q31_t)phase;
+                (void)vocoder_advance(vocoder, k, phase);
+            }
+
+            (void)cordic_batch_park(vocoder_angle, vocoder_re, vocoder_im,
+                                    vocoder_out_re, vocoder_out_im, count);
+            (void)memcpy(&magnitude[start], vocoder_out_re, count * sizeof(q31_t));
+        }
+
+        vocoder->started = true;
+        status           = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_vocoder_synthesize
+********************************************************************************
+* Summary:
+* Converts magnitudes and the synthesis phases of the last analyzed frame back
+* to rectangular form.
+*
+* Parameters:
+*  const cordic_vocoder_t *vocoder  Vocoder state
+*  const q31_t *magnitude           bins magnitudes in Q31
+*  q31_t *spectrum                  bins interleaved {re, im} pairs
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_vocoder_synthesize(const cordic_vocoder_t *vocoder,
+                                                const q31_t *magnitude, q31_t *spectrum)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t start = 0;
+    uint32_t count = 0;
+    uint32_t i     = 0;
+
+    if ((NULL != vocoder) && (NULL != magnitude) && (NULL != spectrum))
+    {
+        for (start = 0U; start < vocoder->bins; start += count)
+        {
+            count = vocoder_chunk(vocoder->bins, start);
+
+            (void)memcpy(vocoder_re, &magnitude[start], count * sizeof(q31_t));
+            (void)memcpy(vocoder_angle, &vocoder->synth_phase[start], count * sizeof(uint32_t));
+            (void)memset(vocoder_im, 0, count * sizeof(q31_t));
+
+            (void)cordic_batch_rotate(vocoder_angle, vocoder_re, vocoder_im,
+                                      vocoder_out_re, vocoder_out_im, count);
+
+            for (i = 0U; i < count; i++)
+            {
+                spectrum[2U * (start + i)]        = vocoder_out_re[i];
+                spectrum[(2U * (start + i)) + 1U] = vocoder_out_im[i];
+            }
+        }
+
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_vocoder_process
+********************************************************************************
+* Summary:
+* Analysis and synthesis of a frame in place, for when the magnitudes are not
+* modified. Rotating each bin by the difference of its synthesis and analysis
+* phase keeps the magnitude, so one vectoring and one rotation per bin are
+* enough.
+*
+* Parameters:
+*  cordic_vocoder_t *vocoder  Vocoder state
+*  q31_t *spectrum            bins interleaved {re, im} pairs, in place
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM when a pointer is NULL
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_vocoder_process(cordic_vocoder_t *vocoder, q31_t *spectrum)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    uint32_t start = 0;
+    uint32_t count = 0;
+    uint32_t k     = 0;
+    uint32_t i     = 0;
+    uint32_t phase = 0;
+
+    if ((NULL != vocoder) && (NULL != spectrum))
+    {
+        for (start = 0U; start < vocoder->bins; start += count)
+        {
+            count = vocoder_chunk(vocoder->bins, start);
+
+            for (i = 0U; i < count; i++)
+            {
+                k                = start + i;
+                vocoder_re[i]    = spectrum[2U * k];
+                vocoder_im[i]    = spectrum[(2U * k) + 1U];
+                phase            = cordic_angle_vector(vocoder_re[i], vocoder_im[i],
+                                                       vocoder->last_phase[k] + (k * vocoder->analysis_step));
+                vocoder_angle[i] = (CY_CORDIC_Q31_t)(vocoder_advance(vocoder, k, phase) - phase);
+            }
+
+            (void)cordic_batch_rotate(vocoder_angle, vocoder_re, vocoder_im,
+                                      vocoder_out_re, vocoder_out_im, count);
+
+            for (i = 0U; i < count; i++)
+            {
+                spectrum[2U * (start + i)]        = vocoder_out_re[i];
+                spectrum[(2U * (start + i)) + 1U] = vocoder_out_im[i];
+            }
+        }
+
+        vocoder->started = true;
+        status           = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: vocoder_float
+********************************************************************************
+* Summary:
+* Floating-point reference of cordic_vocoder_process() with atan2f(), sqrtf(),
+* cosf(), and sinf(). The hops are a quarter and three eighths of the FFT
+* length, as in the benchmark.
+*
+* Parameters:
+*  uint32_t bins            Number of bins
+*  uint32_t fft_length      FFT length
+*  float32_t *spectrum      Interleaved {re, im} pairs, in place
+*  float32_t *last_phase    Analysis phases of the previous frame
+*  float32_t *synth_phase   Synthesis phases
+*  bool started             false for the first frame
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void vocoder_float(uint32_t bins, uint32_t fft_length, float32_t *spectrum,
+                          float32_t *last_phase, float32_t *synth_phase, bool started)
+{
+    float32_t omega = 2.0f * PI / (float32_t)fft_length;
+    float32_t phase = 0.0f;
+    float32_t delta = 0.0f;
+    float32_t mag   = 0.0f;
+    uint32_t  k     = 0;
+
+    for (k = 0U; k < bins; k++)
+    {
+        phase = atan2f(spectrum[(2U * k) + 1U], spectrum[2U * k]);
+        mag   = sqrtf((spectrum[2U * k] * spectrum[2U * k]) +
+                      (spectrum[(2U * k) + 1U] * spectrum[(2U * k) + 1U]));
+        delta = phase - last_phase[k] - (omega * (float32_t)k * (float32_t)(fft_length / 4U));
+        delta = delta - (2.0f * PI * roundf(delta / (2.0f * PI)));
+
+        synth_phase[k] = started ? (synth_phase[k] + (omega * (float32_t)k * (float32_t)((3U * fft_length) / 8U)) +
+                                    (delta * 1.5f)) : phase;
+        synth_phase[k] = synth_phase[k] - (2.0f * PI * roundf(synth_phase[k] / (2.0f * PI)));
+        last_phase[k]  = phase;
+
+        spectrum[2U * k]        = mag * cosf(synth_phase[k]);
+        spectrum[(2U * k) + 1U] = mag * sinf(synth_phase[k]);
+    }
+}
+
+/*******************************************************************************
+* Function Name: vocoder_bench_spectrum
+********************************************************************************
+* Summary:
+* Fills the benchmark frame with bins of a magnitude below 0.71, in Q31 or
+* converted in place to float. Each frame number gives other bins.
+*
+* Parameters:
+*  uint32_t bins   Number of bins
+*  uint32_t frame  Frame number
+*  bool as_float   true for the floating-point reference
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void vocoder_bench_spectrum(uint32_t bins, uint32_t frame, bool as_float)
+{
+    uint32_t seed = 0x9E3779B9UL + frame;
+    uint32_t i    = 0;
+
+    for (i = 0U; i < (2U * bins); i++)
+    {
+        seed = (seed * 1664525UL) + 1013904223UL;
+        vocoder_bench.fixed.spectrum[i] = (q31_t)seed >> 1;
+        if (as_float)
+        {
+            vocoder_bench.flt.spectrum[i] = (float32_t)((q31_t)seed >> 1) * VOCODER_Q31_TO_FLOAT;
+        }
+    }
+}
+
+/*******************************************************************************
+* Function Name: cordic_vocoder_benchmark
+********************************************************************************
+* Summary:
+* Measures the frames per second of a time stretch by 1.5 (hops of a quarter
+* and three eighths of the FFT length) at 256, 512, and 1024 bins with
+* cordic_vocoder_process(), with cordic_vocoder_analyze() followed by
+* cordic_vocoder_synthesize(), and with the floating-point reference. The
+* output of two frames is compared with the reference at 256 bins.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_vocoder_benchmark(void)
+{
+    cordic_vocoder_t vocoder;
+    uint32_t  bins    = 0;
+    uint32_t  start   = 0;
+    uint32_t  process = 0;
+    uint32_t  polar   = 0;
+    uint32_t  libm    = 0;
+    float32_t error   = 0.0f;
+    uint32_t  s       = 0;
+    uint32_t  f       = 0;
+    uint32_t  i       = 0;
+
+    printf("\r\nTime stretch by 1.5, frames per second\r\n");
+    printf("Bins   process   analyze+synthesize   float\r\n");
+
+    for (s = 0U; s < VOCODER_BENCH_SIZES; s++)
+    {
+        bins = vocoder_bench_bins[s];
+
+        (void)cordic_vocoder_init(&vocoder, bins, 2U * bins, bins / 2U, (3U * bins) / 4U,
+                                  vocoder_bench.fixed.last_phase, vocoder_bench.fixed.synth_phase);
+        vocoder_bench_spectrum(bins, 0U, false);
+        start = cordic_benchmark_get_cycles();
+        for (f = 0U; f < VOCODER_BENCH_FRAMES; f++)
+        {
+            (void)cordic_vocoder_process(&vocoder, vocoder_bench.fixed.spectrum);
+        }
+        process = cordic_benchmark_get_cycles() - start;
+
+        vocoder_bench_spectrum(bins, 0U, false);
+        start = cordic_benchmark_get_cycles();
+        for (f = 0U; f < VOCODER_BENCH_FRAMES; f++)
+        {
+            (void)cordic_vocoder_analyze(&vocoder, vocoder_bench.fixed.spectrum, vocoder_bench_magnitude);
+            (void)cordic_vocoder_synthesize(&vocoder, vocoder_bench_magnitude, vocoder_bench.fixed.spectrum);
+        }
+        polar = cordic_benchmark_get_cycles() - start;
+
+        vocoder_bench_spectrum(bins, 0U, true);
+        start = cordic_benchmark_get_cycles();
+        for (f = 0U; f < VOCODER_BENCH_FRAMES; f++)
+        {
+            vocoder_float(bins, 2U * bins, vocoder_bench.flt.spectrum, vocoder_bench.flt.last_phase,
+                          vocoder_bench.flt.synth_phase, (0U != f));
+        }
+        libm = cordic_benchmark_get_cycles() - start;
+
+        process = (0U != process) ? process : 1U;
+        polar   = (0U != polar) ? polar : 1U;
+        libm    = (0U != libm) ? libm : 1U;
+
+        printf("%4u %9u %20u %7u\r\n", (unsigned int)bins,
+               (unsigned int)(((uint64_t)SystemCoreClock * VOCODER_BENCH_FRAMES) / process),
+               (unsigned int)(((uint64_t)SystemCoreClock * VOCODER_BENCH_FRAMES) / polar),
+               (unsigned int)(((uint64_t)SystemCoreClock * VOCODER_BENCH_FRAMES) / libm));
+    }
+
+    /* Two frames through both implementations */
+    (void)cordic_vocoder_init(&vocoder, VOCODER_BENCH_COMPARE, 2U * VOCODER_BENCH_COMPARE,
+                              VOCODER_BENCH_COMPARE / 2U, (3U * VOCODER_BENCH_COMPARE) / 4U,
+                              vocoder_bench.fixed.last_phase, vocoder_bench.fixed.synth_phase);
+    for (f = 0U; f < 2U; f++)
+    {
+        vocoder_bench_spectrum(VOCODER_BENCH_COMPARE, f, false);
+        (void)cordic_vocoder_process(&vocoder, vocoder_bench.fixed.spectrum);
+    }
+    (void)memcpy(vocoder_bench_result, vocoder_bench.fixed.spectrum, sizeof(vocoder_bench_result));
+
+    for (f = 0U; f < 2U; f++)
+    {
+        vocoder_bench_spectrum(VOCODER_BENCH_COMPARE, f, true);
+        vocoder_float(VOCODER_BENCH_COMPARE, 2U * VOCODER_BENCH_COMPARE, vocoder_bench.flt.spectrum,
+                      vocoder_bench.flt.last_phase, vocoder_bench.flt.synth_phase, (0U != f));
+    }
+
+    for (i = 0U; i < (2U * VOCODER_BENCH_COMPARE); i++)
+    {
+        error = fmaxf(error, fabsf(((float32_t)vocoder_bench_result[i] * VOCODER_Q31_TO_FLOAT) -
+                                   vocoder_bench.flt.spectrum[i]));
+    }
+
+    printf("Maximum deviation from the float reference after two frames: %.2e\r\n", (double)error);
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,86 @@
+/*******************************************************************************
+* File Name:   cordic_vocoder.h
+*
+* Description: This header file contains the interface to the
+* phase-vocoder stage. It converts the bins of an FFT frame to magnitude and
+* phase on the CORDIC, advances the phases for a new synthesis hop in binary
+* angle arithmetic, and converts the bins back to rectangular form.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_VOCODER_H
+#define CORDIC_VOCODER_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "arm_math.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* State of one phase vocoder. The per-bin arrays are provided by the caller. */
+typedef struct
+{
+    uint32_t  bins;             /* Number of bins of a frame */
+    uint32_t  analysis_step;    /* Phase advance of bin 1 per analysis hop, Q31 binary angle */
+    uint32_t  synthesis_step;   /* Phase advance of bin 1 per synthesis hop, Q31 binary angle */
+    int32_t   ratio;            /* Synthesis hop over analysis hop, Q16 */
+    uint32_t *last_phase;       /* Analysis phase of the previous frame per bin */
+    uint32_t *synth_phase;      /* Synthesis phase of the current frame per bin */
+    bool      started;          /* false until the first frame has been analyzed */
+} cordic_vocoder_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+/* Spectra are interleaved {re, im} pairs in Q31 with a magnitude of at most 1,
+ * as produced by the CMSIS-DSP FFT functions. fft_length must be a power of
+ * two, the hops are in samples. */
+cy_en_cordic_status_t cordic_vocoder_init(cordic_vocoder_t *vocoder, uint32_t bins,
+                                          uint32_t fft_length, uint32_t analysis_hop,
+                                          uint32_t synthesis_hop, uint32_t *last_phase,
+                                          uint32_t *synth_phase);
+cy_en_cordic_status_t cordic_vocoder_analyze(cordic_vocoder_t *vocoder, const q31_t *spectrum,
+                                             q31_t *magnitude);
+cy_en_cordic_status_t cordic_vocoder_synthesize(const cordic_vocoder_t *vocoder,
+                                                const q31_t *magnitude, q31_t *spectrum);
+cy_en_cordic_status_t cordic_vocoder_process(cordic_vocoder_t *vocoder, q31_t *spectrum);
+void cordic_vocoder_benchmark(void);
+
+#endif /*CORDIC_VOCODER_H*/
+/* [] END OF FILE */
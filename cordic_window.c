@@ -0,0 +1,532 @@
+/*******************************************************************************
+* File Name:   cordic_window.c
+*
+* Description: This file contains the window generator. The cosine of
+* the fundamental comes from cordic_batch_rotate() in chunks of
+* CORDIC_BATCH_CHUNK, the higher harmonics of the multi-term windows from the
+* Chebyshev recurrence cos(k x) = 2 cos(x) cos((k - 1) x) - cos((k - 2) x). Only
+* the first half of a window is computed; the second half is its mirror image.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "math.h"
+#include "cordic_benchmark.h"
+#include "cordic_batch.h"
+#include "cordic_window.h"
+#include "cordic_placement.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Highest number of cosine terms of a window */
+#define WINDOW_TERMS             (5U)
+
+/* Number of window types */
+#define WINDOW_TYPES             (4U)
+
+/* Number of values of the first half of a cached window */
+#define WINDOW_CACHE_HALF        ((CORDIC_WINDOW_CACHE_LENGTH / 2U) + 1U)
+
+/* 2 * pi for the double-precision reference */
+#define WINDOW_TWO_PI            (6.283185307179586)
+
+/* Longest window of the benchmark */
+#define WINDOW_BENCH_LENGTH      (512U)
+
+/*******************************************************************************
+* Function Prototypes
+*******************************************************************************/
+static const q31_t *window_chunk(cordic_window_type_t type, uint32_t length,
+                                 uint32_t start, uint32_t count);
+static const q31_t *window_cached(cordic_window_type_t type, uint32_t length);
+static cy_en_cordic_status_t window_generate(cordic_window_type_t type, uint32_t length,
+                                             q31_t *window_q31, q15_t *window_q15);
+static q31_t window_libm(cordic_window_type_t type, uint32_t length, uint32_t n);
+static q31_t window_cmsis(cordic_window_type_t type, uint32_t length, uint32_t n);
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+/* Cosine term weights in Q31, with the sign of the term */
+static const q31_t window_terms[WINDOW_TYPES][WINDOW_TERMS] =
+{
+    { 1073741824L, -1073741824L,          0L,          0L,        0L },  /* Hann     */
+    { 1159641170L,  -987842478L,          0L,          0L,        0L },  /* Hamming  */
+    {  901943132L, -1073741824L,  171798692L,          0L,        0L },  /* Blackman */
+    {  462952270L,  -894709505L,  595418098L, -179484422L, 14919359L }   /* Flat top */
+};
+
+/* Number of cosine terms per window type */
+static const uint8_t window_term_count[WINDOW_TYPES] = { 2U, 2U, 3U, 5U };
+
+/* Operands and results of cordic_batch_rotate() */
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t window_angle[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t window_unit[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t window_zero[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t window_cos[CORDIC_BATCH_CHUNK];
+static CORDIC_BATCH_ALIGNED CY_CORDIC_Q31_t window_sin[CORDIC_BATCH_CHUNK];
+
+#if (CORDIC_WINDOW_CACHE_ENTRIES > 0U)
+/* Cached first halves, their keys, and the last use for the replacement */
+static q31_t    window_cache[CORDIC_WINDOW_CACHE_ENTRIES][WINDOW_CACHE_HALF];
+static uint32_t window_cache_length[CORDIC_WINDOW_CACHE_ENTRIES];
+static uint8_t  window_cache_type[CORDIC_WINDOW_CACHE_ENTRIES];
+static uint32_t window_cache_used[CORDIC_WINDOW_CACHE_ENTRIES];
+static uint32_t window_cache_clock;
+#endif
+
+/* Benchmark outputs */
+static q31_t window_bench_cordic[WINDOW_BENCH_LENGTH];
+static q31_t window_bench_ref[WINDOW_BENCH_LENGTH];
+static q15_t window_bench_q15[WINDOW_BENCH_LENGTH];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: window_chunk
+********************************************************************************
+* Summary:
+* Computes up to CORDIC_BATCH_CHUNK consecutive window values. The angles
+* 2 * pi * n / length are stepped with a 64-bit phase increment, so no division
+* is needed per value. The fundamental is rotated on the CORDIC and the higher
+* harmonics follow from the recurrence in Q31 with 64-bit products.
+*
+* Parameters:
+*  cordic_window_type_t type  Window type
+*  uint32_t length            Window length
+*  uint32_t start             Index of the first value, at most length / 2
+*  uint32_t count             Number of values, at most CORDIC_BATCH_CHUNK
+*
+* Return:
+*  const q31_t *              Window values in Q31, valid until the next call
+*
+*******************************************************************************/
+CORDIC_HOT_BEGIN
+static const q31_t *window_chunk(cordic_window_type_t type, uint32_t length,
+                                 uint32_t start, uint32_t count)
+{
+    const q31_t *terms = window_terms[type];
+    uint32_t     last  = window_term_count[type];
+    uint64_t     step  = UINT64_MAX / length;
+    uint64_t     phase = step * start;
+    int64_t      c[WINDOW_TERMS];
+    int64_t      sum   = 0;
+    uint32_t     i     = 0;
+    uint32_t     k     = 0;
+
+    /* start + count - 1 <= length / 2, so the phase stays below 2^63 */
+    for (i = 0U; i < count; i++)
+    {
+        window_angle[i] = (CY_CORDIC_Q31_t)(uint32_t)(phase >> 32);
+        window_unit[i]  = INT32_MAX;
+        phase          += step;
+    }
+
+    (void)cordic_batch_rotate(window_angle, window_unit, window_zero, window_cos, window_sin, count);
+
+    for (i = 0U; i < count; i++)
+    {
+        c[0] = (int64_t)1 << 31;
+        c[1] = window_cos[i];
+        sum  = ((int64_t)terms[0] << 31) + ((int64_t)terms[1] * c[1]);
+
+        for (k = 2U; k < last; k++)
+        {
+            c[k] = ((c[1] * c[k - 1U]) >> 30) - c[k - 2U];
+            sum += (int64_t)terms[k] * c[k];
+        }
+
+        sum            = (sum + (1LL << 30)) >> 31;
+        window_cos[i]  = (sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : (q31_t)sum);
+    }
+
+    return window_cos;
+}
+CORDIC_HOT_END
+
+/*******************************************************************************
+* Function Name: window_cached
+********************************************************************************
+* Summary:
+* Looks up the first half of a window in the cache. On a miss, the least
+* recently used entry is refilled, unless the window is longer than
+* CORDIC_WINDOW_CACHE_LENGTH.
+*
+* Parameters:
+*  cordic_window_type_t type  Window type
+*  uint32_t length            Window length
+*
+* Return:
+*  const q31_t *              First half of the window, NULL when not cached
+*
+*******************************************************************************/
+static const q31_t *window_cached(cordic_window_type_t type, uint32_t length)
+{
+    const q31_t *half  = NULL;
+#if (CORDIC_WINDOW_CACHE_ENTRIES > 0U)
+    uint32_t     entry = 0;
+    uint32_t     start = 0;
+    uint32_t     count = 0;
+    uint32_t     i     = 0;
+
+    if (length <= CORDIC_WINDOW_CACHE_LENGTH)
+    {
+        for (i = 0U; i < CORDIC_WINDOW_CACHE_ENTRIES; i++)
+        {
+            if ((length == window_cache_length[i]) && ((uint8_t)type == window_cache_type[i]))
+            {
+                entry = i;
+                half  = window_cache[i];
+                break;
+            }
+            entry = (window_cache_used[i] < window_cache_used[entry]) ? i : entry;
+        }
+
+        if (NULL == half)
+        {
+            half = window_cache[entry];
+            for (start = 0U; start <= (length / 2U); start += count)
+            {
+                count = (((length / 2U) + 1U - start) < CORDIC_BATCH_CHUNK) ?
+                        ((length / 2U) + 1U - start) : CORDIC_BATCH_CHUNK;
+                (void)memcpy(&window_cache[entry][start], window_chunk(type, length, start, count),
+                             count * sizeof(q31_t));
+            }
+            window_cache_length[entry] = length;
+            window_cache_type[entry]   = (uint8_t)type;
+        }
+
+        window_cache_used[entry] = ++window_cache_clock;
+    }
+#else
+    (void)type;
+    (void)length;
+#endif
+
+    return half;
+}
+
+/*******************************************************************************
+* Function Name: window_generate
+********************************************************************************
+* Summary:
+* Writes a window in Q31 or Q15 from the cache or from the CORDIC. Value n of
+* the first half is also stored at length - n.
+*
+* Parameters:
+*  cordic_window_type_t type  Window type
+*  uint32_t length            Window length
+*  q31_t *window_q31          Q31 output, or NULL
+*  q15_t *window_q15          Q15 output, or NULL
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for an unknown type or a zero length
+*
+*******************************************************************************/
+static cy_en_cordic_status_t window_generate(cordic_window_type_t type, uint32_t length,
+                                             q31_t *window_q31, q15_t *window_q15)
+{
+    cy_en_cordic_status_t status = CY_CORDIC_BAD_PARAM;
+    const q31_t *half   = NULL;
+    const q31_t *values = NULL;
+    uint32_t     start  = 0;
+    uint32_t     count  = 0;
+    uint32_t     n      = 0;
+    uint32_t     i      = 0;
+    q15_t        value  = 0;
+
+    if (((uint32_t)type < WINDOW_TYPES) && (0U != length))
+    {
+        half = window_cached(type, length);
+
+        for (start = 0U; start <= (length / 2U); start += count)
+        {
+            count  = (((length / 2U) + 1U - start) < CORDIC_BATCH_CHUNK) ?
+                     ((length / 2U) + 1U - start) : CORDIC_BATCH_CHUNK;
+            values = (NULL != half) ? &half[start] : window_chunk(type, length, start, count);
+
+            for (i = 0U; i < count; i++)
+            {
+                n = start + i;
+                if (NULL != window_q31)
+                {
+                    window_q31[n] = values[i];
+                    if ((n > 0U) && ((length - n) > n))
+                    {
+                        window_q31[length - n] = values[i];
+                    }
+                }
+                else
+                {
+                    value = (q15_t)((values[i] >= 0x7FFF8000L) ? 0x7FFF : ((values[i] + 0x8000L) >> 16));
+                    window_q15[n] = value;
+                    if ((n > 0U) && ((length - n) > n))
+                    {
+                        window_q15[length - n] = value;
+                    }
+                }
+            }
+        }
+
+        status = CY_CORDIC_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: cordic_window_q31
+********************************************************************************
+* Summary:
+* Fills a buffer with a periodic window in Q31.
+*
+* Parameters:
+*  cordic_window_type_t type  Window type
+*  q31_t *window              Output, length values
+*  uint32_t length            Window length
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL buffer, an unknown
+*                         type or a zero length
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_window_q31(cordic_window_type_t type, q31_t *window, uint32_t length)
+{
+    return (NULL != window) ? window_generate(type, length, window, NULL) : CY_CORDIC_BAD_PARAM;
+}
+
+/*******************************************************************************
+* Function Name: cordic_window_q15
+********************************************************************************
+* Summary:
+* Fills a buffer with a periodic window in Q15.
+*
+* Parameters:
+*  cordic_window_type_t type  Window type
+*  q15_t *window              Output, length values
+*  uint32_t length            Window length
+*
+* Return:
+*  cy_en_cordic_status_t  CY_CORDIC_BAD_PARAM for a NULL buffer, an unknown
+*                         type or a zero length
+*
+*******************************************************************************/
+cy_en_cordic_status_t cordic_window_q15(cordic_window_type_t type, q15_t *window, uint32_t length)
+{
+    return (NULL != window) ? window_generate(type, length, NULL, window) : CY_CORDIC_BAD_PARAM;
+}
+
+/*******************************************************************************
+* Function Name: cordic_window_cache_clear
+********************************************************************************
+* Summary:
+* Drops all cached windows.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_window_cache_clear(void)
+{
+#if (CORDIC_WINDOW_CACHE_ENTRIES > 0U)
+    uint32_t i = 0;
+
+    for (i = 0U; i < CORDIC_WINDOW_CACHE_ENTRIES; i++)
+    {
+        window_cache_length[i] = 0U;
+        window_cache_used[i]   = 0U;
+    }
+    window_cache_clock = 0U;
+#endif
+}
+
+/*******************************************************************************
+* Function Name: window_libm
+********************************************************************************
+* Summary:
+* Reference window value with one double-precision cos() per term, as the
+* math library path of the cosine menu option.
+*
+* Parameters:
+*  cordic_window_type_t type  Window type
+*  uint32_t length            Window length
+*  uint32_t n                 Index
+*
+* Return:
+*  q31_t                      Window value in Q31
+*
+*******************************************************************************/
+static q31_t window_libm(cordic_window_type_t type, uint32_t length, uint32_t n)
+{
+    double   sum = 0.0;
+    uint32_t k   = 0;
+
+    for (k = 0U; k < window_term_count[type]; k++)
+    {
+        sum += (double)window_terms[type][k] * cos((WINDOW_TWO_PI * k * n) / length);
+    }
+
+    return (sum >= 2147483647.0) ? INT32_MAX : (q31_t)lround(sum);
+}
+
+/*******************************************************************************
+* Function Name: window_cmsis
+********************************************************************************
+* Summary:
+* Window value with one table-based arm_cos_q31() per term.
+*
+* Parameters:
+*  cordic_window_type_t type  Window type
+*  uint32_t length            Window length
+*  uint32_t n                 Index
+*
+* Return:
+*  q31_t                      Window value in Q31
+*
+*******************************************************************************/
+static q31_t window_cmsis(cordic_window_type_t type, uint32_t length, uint32_t n)
+{
+    uint32_t angle = (uint32_t)(((uint64_t)n << 32) / length);
+    int64_t  sum   = 0;
+    uint32_t k     = 0;
+
+    for (k = 0U; k < window_term_count[type]; k++)
+    {
+        sum += ((int64_t)window_terms[type][k] * arm_cos_q31((q31_t)((angle * k) >> 1))) >> 31;
+    }
+
+    return (sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : (q31_t)sum);
+}
+
+/*******************************************************************************
+* Function Name: cordic_window_benchmark
+********************************************************************************
+* Summary:
+* Generates each window type at several lengths with the CORDIC, uncached and
+* cached, with arm_cos_q31() and with the double-precision cos(), and prints
+* the cycles per window and the maximum deviation from the double reference.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cordic_window_benchmark(void)
+{
+    static const char *const names[WINDOW_TYPES] = { "Hann", "Hamming", "Blackman", "Flat top" };
+    static const uint32_t lengths[] = { 64U, 250U, WINDOW_BENCH_LENGTH };
+    uint32_t  start   = 0;
+    uint32_t  cordic  = 0;
+    uint32_t  cached  = 0;
+    uint32_t  cmsis   = 0;
+    uint32_t  libm    = 0;
+    int64_t   error   = 0;
+    int64_t   delta   = 0;
+    int64_t   cmsis_error = 0;
+    uint32_t  type    = 0;
+    uint32_t  l       = 0;
+    uint32_t  n       = 0;
+    q31_t     value   = 0;
+
+    printf("\r\nCycles per window and maximum deviation from the double-precision cos()\r\n");
+    printf("Window   Length  CORDIC  cached  arm_cos_q31  cos()    CORDIC   arm_cos_q31\r\n");
+
+    for (type = 0U; type < WINDOW_TYPES; type++)
+    {
+        for (l = 0U; l < (sizeof(lengths) / sizeof(lengths[0])); l++)
+        {
+            cordic_window_cache_clear();
+
+            start  = cordic_benchmark_get_cycles();
+            (void)cordic_window_q31((cordic_window_type_t)type, window_bench_cordic, lengths[l]);
+            cordic = cordic_benchmark_get_cycles() - start;
+
+            start  = cordic_benchmark_get_cycles();
+            (void)cordic_window_q15((cordic_window_type_t)type, window_bench_q15, lengths[l]);
+            cached = cordic_benchmark_get_cycles() - start;
+
+            start  = cordic_benchmark_get_cycles();
+            for (n = 0U; n < lengths[l]; n++)
+            {
+                window_bench_ref[n] = window_cmsis((cordic_window_type_t)type, lengths[l], n);
+            }
+            cmsis  = cordic_benchmark_get_cycles() - start;
+
+            cmsis_error = 0;
+            for (n = 0U; n < lengths[l]; n++)
+            {
+                value       = window_libm((cordic_window_type_t)type, lengths[l], n);
+                delta       = (int64_t)window_bench_ref[n] - value;
+                cmsis_error = (llabs(delta) > cmsis_error) ? llabs(delta) : cmsis_error;
+            }
+
+            start  = cordic_benchmark_get_cycles();
+            for (n = 0U; n < lengths[l]; n++)
+            {
+                window_bench_ref[n] = window_libm((cordic_window_type_t)type, lengths[l], n);
+            }
+            libm   = cordic_benchmark_get_cycles() - start;
+
+            error = 0;
+            for (n = 0U; n < lengths[l]; n++)
+            {
+                delta = (int64_t)window_bench_cordic[n] - window_bench_ref[n];
+                error = (llabs(delta) > error) ? llabs(delta) : error;
+            }
+
+            printf("%-8s %6u %7u %7u %12u %7u  %.1e  %.1e\r\n", names[type], (unsigned int)lengths[l],
+                   (unsigned int)cordic, (unsigned int)cached, (unsigned int)cmsis, (unsigned int)libm,
+                   (double)error / 2147483648.0, (double)cmsis_error / 2147483648.0);
+        }
+    }
+
+    printf("The cached column is the Q15 output of the same window from the cache.\r\n");
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,84 @@
+/*******************************************************************************
+* File Name:   cordic_window.h
+*
+* Description: This header file contains the interface to the window
+* generator. It fills Q15 and Q31 buffers of any length with Hann, Hamming,
+* Blackman, and flat-top windows from batched CORDIC cosines and keeps the most
+* recently used windows in a small cache.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CORDIC_WINDOW_H
+#define CORDIC_WINDOW_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include "cy_pdl.h"
+#include "arm_math.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Number of cached windows, 0 disables the cache. Set with
+ * make build CORDIC_WINDOW_CACHE=<entries>. */
+#ifndef CORDIC_WINDOW_CACHE_ENTRIES
+#define CORDIC_WINDOW_CACHE_ENTRIES  (4U)
+#endif
+
+/* Longest window that is cached. Each entry stores the first half of the
+ * window, CORDIC_WINDOW_CACHE_LENGTH / 2 + 1 values in Q31. */
+#define CORDIC_WINDOW_CACHE_LENGTH   (512U)
+
+/* Window types, all periodic (the denominator is the length) for FFT analysis */
+typedef enum
+{
+    CORDIC_WINDOW_HANN     = 0,
+    CORDIC_WINDOW_HAMMING  = 1,
+    CORDIC_WINDOW_BLACKMAN = 2,
+    CORDIC_WINDOW_FLATTOP  = 3     /* Five-term flat top, slightly negative at the edges */
+} cordic_window_type_t;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+cy_en_cordic_status_t cordic_window_q31(cordic_window_type_t type, q31_t *window, uint32_t length);
+cy_en_cordic_status_t cordic_window_q15(cordic_window_type_t type, q15_t *window, uint32_t length);
+void cordic_window_cache_clear(void);
+void cordic_window_benchmark(void);
+
+#endif /*CORDIC_WINDOW_H*/
+/* [] END OF FILE */
@@ -0,0 +1,215 @@
+/*******************************************************************************
+* File Name:   cordic_accuracy.c
+*
+* Description: Host validation of the software CORDIC kernel. It sweeps the
+* complete Q31 angle range for every iteration count and correction method,
+* compares the sine and cosine with the double precision math library and
+* prints the accuracy versus time curves of the kernel.
+*
+* Usage: cordic_accuracy [-s step_log2]
+*   -s  log2 of the angle step, 0 runs all 2^32 angles (default 12)
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "cordic_benchmark.h"
+#include "cordic_soft.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+#define ACCURACY_MIN_ITERATIONS   (4U)
+#define ACCURACY_MAX_ITERATIONS   (28U)
+#define ACCURACY_ITERATION_COUNT  (ACCURACY_MAX_ITERATIONS - ACCURACY_MIN_ITERATIONS + 1U)
+#define ACCURACY_CORR_COUNT       (3U)
+#define ACCURACY_DEFAULT_STEP     (12U)
+#define ACCURACY_TIMING_CALLS     (1UL << 16U)
+#define ACCURACY_PI               (3.141592653589793)
+
+/* Accuracy target: 14 iterations shall give at least 20 bits */
+#define ACCURACY_TARGET_ITERATIONS (14U)
+#define ACCURACY_TARGET_BITS       (20.0)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *corr_names[ACCURACY_CORR_COUNT] = {"none", "linear", "table"};
+
+/* Maximum absolute error per iteration count and correction method */
+static double max_error[ACCURACY_ITERATION_COUNT][ACCURACY_CORR_COUNT];
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: time_sincos
+********************************************************************************
+* Summary:
+* Measures the average time of one sine/cosine evaluation.
+*
+* Parameters:
+*  uint32_t iterations      Number of iterations
+*  cordic_soft_corr_t corr  Correction method
+*
+* Return:
+*  double                   Nanoseconds per call
+*
+*******************************************************************************/
+static double time_sincos(uint32_t iterations, cordic_soft_corr_t corr)
+{
+    volatile int32_t sink = 0;
+    int32_t  sin_q31 = 0;
+    int32_t  cos_q31 = 0;
+    uint32_t start   = 0;
+    uint32_t i       = 0;
+
+    start = cordic_benchmark_get_cycles();
+    for (i = 0U; i < ACCURACY_TIMING_CALLS; i++)
+    {
+        cordic_soft_sincos((int32_t)(i * 0x9E3779B9UL), iterations, corr, &sin_q31, &cos_q31);
+        sink += sin_q31 ^ cos_q31;
+    }
+
+    return (double)(cordic_benchmark_get_cycles() - start) / (double)ACCURACY_TIMING_CALLS;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs the angle sweep and prints the accuracy table.
+*
+* Parameters:
+*  int argc     Argument count
+*  char **argv  Arguments
+*
+* Return:
+*  int          0 if the accuracy target is met, 1 otherwise
+*
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    uint32_t step_log2 = ACCURACY_DEFAULT_STEP;
+    uint64_t angle     = 0;
+    uint64_t count     = 0;
+    uint32_t k         = 0;
+    uint32_t corr      = 0;
+    int32_t  sin_q31   = 0;
+    int32_t  cos_q31   = 0;
+    double   rad       = 0;
+    double   ref_sin   = 0;
+    double   ref_cos   = 0;
+    double   error     = 0;
+    double   bits      = 0;
+    int      target_met = 0;
+
+    if ((3 == argc) && (0 == strcmp(argv[1], "-s")))
+    {
+        step_log2 = (uint32_t)atoi(argv[2]);
+    }
+    else if (1 != argc)
+    {
+        fprintf(stderr, "usage: %s [-s step_log2]\n", argv[0]);
+        return 2;
+    }
+
+    memset(max_error, 0, sizeof(max_error));
+
+    for (angle = 0U; angle < (1ULL << 32U); angle += (1ULL << step_log2))
+    {
+        rad     = (double)(int32_t)(uint32_t)angle * (ACCURACY_PI / 2147483648.0);
+        ref_sin = sin(rad);
+        ref_cos = cos(rad);
+
+        for (k = 0U; k < ACCURACY_ITERATION_COUNT; k++)
+        {
+            for (corr = 0U; corr < ACCURACY_CORR_COUNT; corr++)
+            {
+                cordic_soft_sincos((int32_t)(uint32_t)angle, k + ACCURACY_MIN_ITERATIONS,
+                                   (cordic_soft_corr_t)corr, &sin_q31, &cos_q31);
+
+                error = fabs(((double)sin_q31 / 2147483648.0) - ref_sin);
+                if (error > max_error[k][corr])
+                {
+                    max_error[k][corr] = error;
+                }
+                error = fabs(((double)cos_q31 / 2147483648.0) - ref_cos);
+                if (error > max_error[k][corr])
+                {
+                    max_error[k][corr] = error;
+                }
+            }
+        }
+        count++;
+    }
+
+    printf("Software CORDIC sine/cosine, %llu angles (step 2^%u)\n",
+           (unsigned long long)count, (unsigned int)step_log2);
+    printf("iterations | correction | ns/op  | max error | bits\n");
+
+    for (k = 0U; k < ACCURACY_ITERATION_COUNT; k++)
+    {
+        for (corr = 0U; corr < ACCURACY_CORR_COUNT; corr++)
+        {
+            bits = -log2(max_error[k][corr]);
+            printf("%10u | %10s | %6.1f | %9.3e | %4.1f\n",
+                   (unsigned int)(k + ACCURACY_MIN_ITERATIONS), corr_names[corr],
+                   time_sincos(k + ACCURACY_MIN_ITERATIONS, (cordic_soft_corr_t)corr),
+                   max_error[k][corr], bits);
+
+            if (((k + ACCURACY_MIN_ITERATIONS) == ACCURACY_TARGET_ITERATIONS) &&
+                (CORDIC_SOFT_CORR_NONE != corr) && (bits >= ACCURACY_TARGET_BITS))
+            {
+                target_met = 1;
+            }
+        }
+    }
+
+    printf("%u iterations with correction %s the %.0f-bit target\n",
+           (unsigned int)ACCURACY_TARGET_ITERATIONS, (0 != target_met) ? "meets" : "misses",
+           ACCURACY_TARGET_BITS);
+
+    return (0 != target_met) ? 0 : 1;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,287 @@
+/*******************************************************************************
+* File Name:   cordic_carrier.c
+*
+* Description: Host check of the carrier recovery loop with synthetic
+* BPSK and QPSK signals. Each scenario modulates random symbols on a carrier
+* with a frequency and phase offset and additive Gaussian noise, runs the loop
+* on the emulated peripheral, and checks that it locks: the residual phase error
+* and the symbol error rate after the lock-in time must stay within limits. The
+* signal is also processed in blocks of random size, which must give the same
+* output as a single call.
+*
+* usage: cordic_carrier
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "cordic_costas.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+#define CARRIER_PI               (3.141592653589793)
+#define CARRIER_Q31              (2147483648.0)
+
+/* Symbols per scenario and symbols ignored while the loop locks */
+#define CARRIER_SYMBOLS          (4000U)
+#define CARRIER_LOCK_IN          (1000U)
+
+/* Signal amplitude, leaves headroom for the noise */
+#define CARRIER_AMPLITUDE        (0.5)
+
+/* Largest block of the block-wise run */
+#define CARRIER_MAX_BLOCK        (64U)
+
+/* Scenario of the check */
+typedef struct
+{
+    cordic_costas_mode_t mode;
+    double               offset;     /* Carrier offset in cycles per symbol */
+    double               phase;      /* Initial carrier phase in radians */
+    double               snr_db;     /* Es/N0 in dB */
+    double               max_rms;    /* Limit of the residual phase error in radians */
+    double               max_ser;    /* Limit of the symbol error rate */
+} carrier_scenario_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const carrier_scenario_t carrier_scenarios[] =
+{
+    {CORDIC_COSTAS_BPSK,  0.0,    0.5, 40.0, 0.02, 0.0},
+    {CORDIC_COSTAS_BPSK,  0.003, -2.0, 12.0, 0.25, 1e-3},
+    {CORDIC_COSTAS_BPSK, -0.005,  3.0,  8.0, 0.35, 2e-2},
+    {CORDIC_COSTAS_QPSK,  0.0,    0.3, 40.0, 0.02, 0.0},
+    {CORDIC_COSTAS_QPSK,  0.002,  1.0, 16.0, 0.15, 1e-3},
+    {CORDIC_COSTAS_QPSK, -0.004, -2.5, 12.0, 0.25, 2e-2},
+};
+
+static const char *mode_names[] = {"", "BPSK", "QPSK"};
+
+/* Signal, symbols sent, and outputs of the single and the block-wise run */
+static CY_CORDIC_Q31_t carrier_i[CARRIER_SYMBOLS];
+static CY_CORDIC_Q31_t carrier_q[CARRIER_SYMBOLS];
+static uint32_t        carrier_sent[CARRIER_SYMBOLS];
+static CY_CORDIC_Q31_t carrier_i_out[CARRIER_SYMBOLS];
+static CY_CORDIC_Q31_t carrier_q_out[CARRIER_SYMBOLS];
+static CY_CORDIC_Q31_t carrier_i_block[CARRIER_SYMBOLS];
+static CY_CORDIC_Q31_t carrier_q_block[CARRIER_SYMBOLS];
+
+/* State of the random number generator */
+static uint32_t carrier_seed = 0x12345678U;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: carrier_random
+********************************************************************************
+* Summary:
+* Linear congruential generator, reproducible across hosts.
+*
+* Return:
+*  uint32_t  Next random number
+*
+*******************************************************************************/
+static uint32_t carrier_random(void)
+{
+    carrier_seed = (carrier_seed * 1664525U) + 1013904223U;
+    return carrier_seed;
+}
+
+/*******************************************************************************
+* Function Name: carrier_gauss
+********************************************************************************
+* Summary:
+* Standard normal random number by the Box-Muller method.
+*
+* Return:
+*  double  Random number with zero mean and unit variance
+*
+*******************************************************************************/
+static double carrier_gauss(void)
+{
+    double u1 = ((double)(carrier_random() >> 8) + 1.0) / 16777217.0;
+    double u2 = (double)(carrier_random() >> 8) / 16777216.0;
+
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * CARRIER_PI * u2);
+}
+
+/*******************************************************************************
+* Function Name: carrier_synthesize
+********************************************************************************
+* Summary:
+* Generates the received symbols of a scenario, one sample per symbol.
+*
+* Parameters:
+*  const carrier_scenario_t *scenario  Scenario
+*
+*******************************************************************************/
+static void carrier_synthesize(const carrier_scenario_t *scenario)
+{
+    uint32_t points = 1U << (uint32_t)scenario->mode;
+    double   offset = (CORDIC_COSTAS_QPSK == scenario->mode) ? (CARRIER_PI / 4.0) : 0.0;
+    double   sigma  = CARRIER_AMPLITUDE * sqrt(0.5 * pow(10.0, -scenario->snr_db / 10.0));
+    double   angle  = 0.0;
+    uint32_t n      = 0;
+
+    for (n = 0U; n < CARRIER_SYMBOLS; n++)
+    {
+        carrier_sent[n] = carrier_random() >> (32U - (uint32_t)scenario->mode);
+        angle = scenario->phase + (2.0 * CARRIER_PI * scenario->offset * (double)n) +
+                offset + ((2.0 * CARRIER_PI * (double)carrier_sent[n]) / (double)points);
+
+        carrier_i[n] = (CY_CORDIC_Q31_t)(((CARRIER_AMPLITUDE * cos(angle)) + (sigma * carrier_gauss())) * CARRIER_Q31);
+        carrier_q[n] = (CY_CORDIC_Q31_t)(((CARRIER_AMPLITUDE * sin(angle)) + (sigma * carrier_gauss())) * CARRIER_Q31);
+    }
+}
+
+/*******************************************************************************
+* Function Name: carrier_evaluate
+********************************************************************************
+* Summary:
+* Evaluates the derotated symbols after the lock-in time. The loop locks to
+* any of the constellation rotations, so the decisions are compared with the
+* sent symbols for every rotation and the best one is kept.
+*
+* Parameters:
+*  const carrier_scenario_t *scenario  Scenario
+*  double *rms                         Receives the residual phase error in radians
+*  double *ser                         Receives the symbol error rate
+*
+*******************************************************************************/
+static void carrier_evaluate(const carrier_scenario_t *scenario, double *rms, double *ser)
+{
+    uint32_t points   = 1U << (uint32_t)scenario->mode;
+    double   offset   = (CORDIC_COSTAS_QPSK == scenario->mode) ? (CARRIER_PI / 4.0) : 0.0;
+    double   spacing  = (2.0 * CARRIER_PI) / (double)points;
+    double   sum      = 0.0;
+    double   angle    = 0.0;
+    double   error    = 0.0;
+    uint32_t errors[4] = {0U, 0U, 0U, 0U};
+    uint32_t best     = CARRIER_SYMBOLS;
+    uint32_t decision = 0;
+    uint32_t rotation = 0;
+    uint32_t n        = 0;
+
+    for (n = CARRIER_LOCK_IN; n < CARRIER_SYMBOLS; n++)
+    {
+        angle    = atan2((double)carrier_q_out[n], (double)carrier_i_out[n]) - offset;
+        decision = (uint32_t)lround(angle / spacing + (double)points) % points;
+        error    = angle - (spacing * round(angle / spacing));
+        sum     += error * error;
+
+        for (rotation = 0U; rotation < points; rotation++)
+        {
+            errors[rotation] += (((carrier_sent[n] + rotation) % points) != decision) ? 1U : 0U;
+        }
+    }
+
+    for (rotation = 0U; rotation < points; rotation++)
+    {
+        best = (errors[rotation] < best) ? errors[rotation] : best;
+    }
+
+    *rms = sqrt(sum / (double)(CARRIER_SYMBOLS - CARRIER_LOCK_IN));
+    *ser = (double)best / (double)(CARRIER_SYMBOLS - CARRIER_LOCK_IN);
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Runs all scenarios and prints one line per scenario.
+*
+* Return:
+*  int  0 when all scenarios pass, 1 otherwise
+*
+*******************************************************************************/
+int main(void)
+{
+    const carrier_scenario_t *scenario = NULL;
+    cordic_costas_t loop;
+    double   rms    = 0.0;
+    double   ser    = 0.0;
+    double   locked = 0.0;
+    uint32_t block  = 0;
+    uint32_t done   = 0;
+    uint32_t s      = 0;
+    bool     same   = false;
+    bool     pass   = false;
+    int      result = 0;
+
+    printf("mode | offset cyc/sym | phase rad | Es/N0 dB | NCO cyc/sym | rms error rad | SER      | blocks | result\n");
+
+    for (s = 0U; s < (sizeof(carrier_scenarios) / sizeof(carrier_scenarios[0])); s++)
+    {
+        scenario = &carrier_scenarios[s];
+        carrier_synthesize(scenario);
+
+        cordic_costas_init(&loop, scenario->mode, CORDIC_COSTAS_KP_DEFAULT, CORDIC_COSTAS_KI_DEFAULT);
+        (void)cordic_costas_process(&loop, carrier_i, carrier_q, carrier_i_out, carrier_q_out, CARRIER_SYMBOLS);
+        locked = (double)loop.frequency / (2.0 * CARRIER_Q31);
+
+        cordic_costas_init(&loop, scenario->mode, CORDIC_COSTAS_KP_DEFAULT, CORDIC_COSTAS_KI_DEFAULT);
+        for (done = 0U; done < CARRIER_SYMBOLS; done += block)
+        {
+            block = 1U + (carrier_random() % CARRIER_MAX_BLOCK);
+            block = ((CARRIER_SYMBOLS - done) < block) ? (CARRIER_SYMBOLS - done) : block;
+            (void)cordic_costas_process(&loop, &carrier_i[done], &carrier_q[done],
+                                        &carrier_i_block[done], &carrier_q_block[done], block);
+        }
+        same = (0 == memcmp(carrier_i_out, carrier_i_block, sizeof(carrier_i_out))) &&
+               (0 == memcmp(carrier_q_out, carrier_q_block, sizeof(carrier_q_out)));
+
+        carrier_evaluate(scenario, &rms, &ser);
+        pass = same && (rms <= scenario->max_rms) && (ser <= scenario->max_ser);
+        result |= pass ? 0 : 1;
+
+        printf("%s | %14.4f | %9.2f | %8.1f | %11.5f | %13.4f | %.2e | %-6s | %s\n",
+               mode_names[scenario->mode], scenario->offset, scenario->phase, scenario->snr_db,
+               locked, rms, ser, same ? "same" : "DIFFER", pass ? "pass" : "FAIL");
+    }
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,760 @@
+/*******************************************************************************
+* File Name:   cordic_replay.c
+*
+* Description: Host replay of a CORDIC operand trace. The trace is read in the
+* binary format or from a captured terminal log with the hex dump, and every
+* recorded call is replayed through the emulated peripheral, the fast paths in
+* front of it, a truncated software kernel and the C math library. The tool
+* reports the throughput of each backend, the fast-path hit rate and the
+* maximum error against the math library per operation.
+*
+* usage: cordic_replay [-k iterations] [-c none|linear|table] trace
+*        cordic_replay -g count trace     -- writes a synthetic motor-control trace
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include "cy_cordic_emu.h"
+#include "cordic_benchmark.h"
+#include "cordic_fastpath.h"
+#include "cordic_soft.h"
+#include "cordic_trace.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+#define REPLAY_PI                 (3.141592653589793)
+#define REPLAY_CIRCULAR_GAIN      (1.646760258121)
+#define REPLAY_Q31                (2147483648.0)
+#define REPLAY_Q30                (1073741824.0)
+#define REPLAY_Q23                (8388608.0)
+#define REPLAY_Q11                (2048.0)
+
+/* Default truncated software kernel */
+#define REPLAY_DEFAULT_ITERATIONS (16U)
+
+/* Every backend replays about this many calls for the timing */
+#define REPLAY_TIMING_CALLS       (1UL << 20U)
+
+/* Number of fixed-point backends */
+#define REPLAY_BACKEND_COUNT      (3U)
+
+/* Synthetic trace: 180 MHz core, 20 kHz control loop, speed ramp from
+ * standstill to 200 Hz electrical over the trace */
+#define REPLAY_SYNTH_CLOCK_HZ     (180000000UL)
+#define REPLAY_SYNTH_PERIOD       (9000U)
+#define REPLAY_SYNTH_CALL_GAP     (120U)
+#define REPLAY_SYNTH_MAX_FREQ     (200.0)
+#define REPLAY_SYNTH_LOOP_HZ      (20000.0)
+
+/* Fixed-point backend: emulated peripheral configuration and fast paths */
+typedef struct
+{
+    const char         *name;
+    uint32_t           iterations;
+    cordic_soft_corr_t corr;
+    bool               fast;
+} replay_backend_t;
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+static const char *op_names[CORDIC_TRACE_OP_COUNT] =
+{
+    "park", "sin", "cos", "tan", "arctan", "sinh", "cosh", "tanh", "arctanh", "sqrt"
+};
+
+static const char *corr_names[] = {"none", "linear", "table"};
+
+/* Keeps the replay results alive */
+static volatile int32_t replay_sink;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: replay_output_count
+********************************************************************************
+* Summary:
+* Returns the number of results of an operation.
+*
+* Parameters:
+*  uint8_t op  Traced operation
+*
+* Return:
+*  uint32_t    2 for the Park transform, 1 otherwise
+*
+*******************************************************************************/
+static uint32_t replay_output_count(uint8_t op)
+{
+    return (CORDIC_TRACE_OP_PARK == op) ? 2U : 1U;
+}
+
+/*******************************************************************************
+* Function Name: replay_reference
+********************************************************************************
+* Summary:
+* Calculates the exact result of a traced call with the math library.
+*
+* Parameters:
+*  const cordic_trace_record_t *record  Traced call
+*  double *out                          Results in real units
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void replay_reference(const cordic_trace_record_t *record, double *out)
+{
+    double a = (double)record->operand[0];
+    double b = (double)record->operand[1];
+    double c = (double)record->operand[2];
+    double angle = a * (REPLAY_PI / REPLAY_Q31);
+
+    switch (record->op)
+    {
+    case CORDIC_TRACE_OP_PARK:
+        out[0] = ((b * cos(angle)) + (c * sin(angle))) / REPLAY_Q31;
+        out[1] = ((c * cos(angle)) - (b * sin(angle))) / REPLAY_Q31;
+        break;
+    case CORDIC_TRACE_OP_SIN:     out[0] = sin(angle);   break;
+    case CORDIC_TRACE_OP_COS:     out[0] = cos(angle);   break;
+    case CORDIC_TRACE_OP_TAN:     out[0] = tan(angle);   break;
+    case CORDIC_TRACE_OP_ARCTAN:  out[0] = atan2(b, a);  break;
+    case CORDIC_TRACE_OP_SINH:    out[0] = sinh(angle);  break;
+    case CORDIC_TRACE_OP_COSH:    out[0] = cosh(angle);  break;
+    case CORDIC_TRACE_OP_TANH:    out[0] = tanh(angle);  break;
+    case CORDIC_TRACE_OP_ARCTANH: out[0] = atanh(b / a); break;
+    default:                      out[0] = sqrt(a / REPLAY_Q31); break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: replay_execute
+********************************************************************************
+* Summary:
+* Replays a traced call through the emulated driver, optionally through the
+* fast-path wrappers where the application has one.
+*
+* Parameters:
+*  const cordic_trace_record_t *record  Traced call
+*  bool fast                            Use the fast-path wrappers
+*  int32_t *out                         Raw results in the driver formats
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void replay_execute(const cordic_trace_record_t *record, bool fast, int32_t *out)
+{
+    int32_t a = record->operand[0];
+    int32_t b = record->operand[1];
+    cy_stc_cordic_parkTransform_result_t park_result;
+
+    switch (record->op)
+    {
+    case CORDIC_TRACE_OP_PARK:
+        Cy_CORDIC_ParkTransformNB(MXCORDIC, a, b, record->operand[2]);
+        while (Cy_CORDIC_IsBusy(MXCORDIC)) {}
+        Cy_CORDIC_GetParkResult(MXCORDIC, &park_result);
+        out[0] = park_result.parkTransformId;
+        out[1] = park_result.parkTransformIq;
+        break;
+    case CORDIC_TRACE_OP_SIN:     out[0] = fast ? cordic_fast_sin(a)  : Cy_CORDIC_Sin(MXCORDIC, a);  break;
+    case CORDIC_TRACE_OP_COS:     out[0] = fast ? cordic_fast_cos(a)  : Cy_CORDIC_Cos(MXCORDIC, a);  break;
+    case CORDIC_TRACE_OP_TAN:     out[0] = fast ? cordic_fast_tan(a)  : Cy_CORDIC_Tan(MXCORDIC, a);  break;
+    case CORDIC_TRACE_OP_ARCTAN:  out[0] = Cy_CORDIC_ArcTan(MXCORDIC, a, b);                          break;
+    case CORDIC_TRACE_OP_SINH:    out[0] = fast ? cordic_fast_sinh(a) : Cy_CORDIC_Sinh(MXCORDIC, a); break;
+    case CORDIC_TRACE_OP_COSH:    out[0] = Cy_CORDIC_Cosh(MXCORDIC, a);                               break;
+    case CORDIC_TRACE_OP_TANH:    out[0] = Cy_CORDIC_Tanh(MXCORDIC, a);                               break;
+    case CORDIC_TRACE_OP_ARCTANH: out[0] = Cy_CORDIC_ArcTanh(MXCORDIC, a, b);                         break;
+    default:                      out[0] = fast ? cordic_fast_sqrt(a) : Cy_CORDIC_Sqrt(MXCORDIC, a); break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: replay_convert
+********************************************************************************
+* Summary:
+* Converts raw results in the driver formats to real units. The Park results
+* are Q23 and include the circular gain.
+*
+* Parameters:
+*  uint8_t op          Traced operation
+*  const int32_t *raw  Raw results
+*  double *out         Results in real units
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void replay_convert(uint8_t op, const int32_t *raw, double *out)
+{
+    switch (op)
+    {
+    case CORDIC_TRACE_OP_PARK:
+        out[0] = (double)raw[0] / (REPLAY_Q23 * REPLAY_CIRCULAR_GAIN);
+        out[1] = (double)raw[1] / (REPLAY_Q23 * REPLAY_CIRCULAR_GAIN);
+        break;
+    case CORDIC_TRACE_OP_TAN:
+    case CORDIC_TRACE_OP_TANH:
+        out[0] = (double)raw[0] / REPLAY_Q11;
+        break;
+    case CORDIC_TRACE_OP_ARCTAN:
+    case CORDIC_TRACE_OP_ARCTANH:
+        out[0] = (double)raw[0] * (REPLAY_PI / REPLAY_Q31);
+        break;
+    case CORDIC_TRACE_OP_SINH:
+    case CORDIC_TRACE_OP_COSH:
+        out[0] = (double)raw[0] / REPLAY_Q30;
+        break;
+    default:
+        out[0] = (double)raw[0] / REPLAY_Q31;
+        break;
+    }
+}
+
+/*******************************************************************************
+* Function Name: replay_is_fast_hit
+********************************************************************************
+* Summary:
+* Tells whether the fast-path wrappers answer a traced call without the
+* peripheral, using the same classification as cordic_fastpath.c.
+*
+* Parameters:
+*  const cordic_trace_record_t *record  Traced call
+*  bool *eligible                       Set when the operation has a fast path
+*
+* Return:
+*  bool                                 true on a fast-path hit
+*
+*******************************************************************************/
+static bool replay_is_fast_hit(const cordic_trace_record_t *record, bool *eligible)
+{
+    int32_t a   = record->operand[0];
+    bool    hit = false;
+
+    *eligible = true;
+
+    switch (record->op)
+    {
+    case CORDIC_TRACE_OP_SIN:
+        hit = cordic_fast_is_tiny(a, CORDIC_FAST_TINY_ANGLE) || cordic_fast_is_quarter(a);
+        break;
+    case CORDIC_TRACE_OP_COS:
+        hit = cordic_fast_is_tiny(a, CORDIC_FAST_TINY_COS_ANGLE) || cordic_fast_is_quarter(a);
+        break;
+    case CORDIC_TRACE_OP_TAN:
+    case CORDIC_TRACE_OP_SINH:
+        hit = cordic_fast_is_tiny(a, CORDIC_FAST_TINY_ANGLE);
+        break;
+    case CORDIC_TRACE_OP_SQRT:
+        hit = cordic_fast_is_power_of_four(a);
+        break;
+    default:
+        *eligible = false;
+        break;
+    }
+
+    return hit;
+}
+
+/*******************************************************************************
+* Function Name: replay_load
+********************************************************************************
+* Summary:
+* Loads a trace file. Binary traces start with the header; otherwise the file
+* is taken as a terminal log and the hex between the dump markers is decoded.
+*
+* Parameters:
+*  const char *path                 Trace file
+*  cordic_trace_header_t *header    Decoded header
+*  uint32_t *count                  Number of decoded records
+*
+* Return:
+*  cordic_trace_record_t *          Records, NULL on error
+*
+*******************************************************************************/
+static cordic_trace_record_t *replay_load(const char *path, cordic_trace_header_t *header,
+                                          uint32_t *count)
+{
+    FILE                  *file    = fopen(path, "rb");
+    uint8_t               *data    = NULL;
+    uint8_t               *binary  = NULL;
+    char                  *text    = NULL;
+    char                  *begin   = NULL;
+    char                  *end     = NULL;
+    cordic_trace_record_t *records = NULL;
+    long                  size     = 0;
+    uint32_t              length   = 0;
+    uint32_t              offset   = 0;
+    uint32_t              used     = 0;
+    uint32_t              previous = 0;
+    int                   high     = -1;
+
+    if (NULL == file)
+    {
+        perror(path);
+        return NULL;
+    }
+
+    (void)fseek(file, 0L, SEEK_END);
+    size = ftell(file);
+    (void)fseek(file, 0L, SEEK_SET);
+
+    data = (uint8_t *)malloc((size_t)size + 1U);
+    if ((NULL == data) || ((size_t)size != fread(data, 1U, (size_t)size, file)))
+    {
+        fprintf(stderr, "%s: read error\n", path);
+        fclose(file);
+        free(data);
+        return NULL;
+    }
+    fclose(file);
+    data[size] = 0U;
+
+    binary = data;
+    length = (uint32_t)size;
+
+    /* Terminal log: decode the hex between the markers in place */
+    if (0U == cordic_trace_decode_header(data, length, header))
+    {
+        text  = (char *)data;
+        begin = strstr(text, CORDIC_TRACE_DUMP_BEGIN);
+        end   = (NULL != begin) ? strstr(begin, CORDIC_TRACE_DUMP_END) : NULL;
+
+        if (NULL == end)
+        {
+            fprintf(stderr, "%s: no trace found\n", path);
+            free(data);
+            return NULL;
+        }
+
+        length = 0U;
+        for (begin += strlen(CORDIC_TRACE_DUMP_BEGIN); begin < end; begin++)
+        {
+            if (0 != isxdigit((unsigned char)*begin))
+            {
+                int nibble = isdigit((unsigned char)*begin) ? (*begin - '0')
+                                                            : (tolower((unsigned char)*begin) - 'a' + 10);
+                if (high < 0)
+                {
+                    high = nibble;
+                }
+                else
+                {
+                    binary[length++] = (uint8_t)((high << 4) | nibble);
+                    high = -1;
+                }
+            }
+        }
+    }
+
+    offset = cordic_trace_decode_header(binary, length, header);
+    if (0U == offset)
+    {
+        fprintf(stderr, "%s: invalid trace header\n", path);
+        free(data);
+        return NULL;
+    }
+
+    records = (cordic_trace_record_t *)calloc((header->record_count > 0U) ? header->record_count : 1U,
+                                              sizeof(cordic_trace_record_t));
+    *count  = 0U;
+
+    while ((NULL != records) && (*count < header->record_count))
+    {
+        used = cordic_trace_decode_record(&binary[offset], length - offset, &records[*count], previous);
+        if (0U == used)
+        {
+            fprintf(stderr, "%s: trace truncated after %u records\n", path, (unsigned int)*count);
+            break;
+        }
+        previous = records[*count].timestamp;
+        offset  += used;
+        (*count)++;
+    }
+
+    free(data);
+
+    return records;
+}
+
+/*******************************************************************************
+* Function Name: replay_synthesize
+********************************************************************************
+* Summary:
+* Writes a synthetic trace of a field-oriented control loop starting from
+* standstill: a Park transform, the sine and cosine of the rotor angle every
+* period, and a magnitude and angle observer every fourth period. Angles
+* outside +/-90 degrees are folded by pi as the application does for the
+* peripheral.
+*
+* Parameters:
+*  const char *path  Trace file
+*  uint32_t periods  Number of control periods
+*
+* Return:
+*  int               0 on success
+*
+*******************************************************************************/
+static int replay_synthesize(const char *path, uint32_t periods)
+{
+    FILE                  *file   = fopen(path, "wb");
+    uint8_t               buffer[CORDIC_TRACE_RECORD_MAX];
+    cordic_trace_header_t header;
+    cordic_trace_record_t record;
+    uint32_t              period   = 0;
+    uint32_t              previous = 0;
+    uint32_t              length   = 0;
+    uint32_t              written  = 0;
+    double                theta    = 0.0;
+    double                freq     = 0.0;
+    double                alpha    = 0.0;
+    double                beta     = 0.0;
+    int32_t               angle    = 0;
+    int32_t               sign     = 1;
+
+    if (NULL == file)
+    {
+        perror(path);
+        return 1;
+    }
+
+    header.version      = (uint8_t)CORDIC_TRACE_VERSION;
+    header.flags        = 0U;
+    header.record_count = periods * 3U + ((periods + 3U) / 4U) * 2U;
+    header.clock_hz     = REPLAY_SYNTH_CLOCK_HZ;
+
+    length = cordic_trace_encode_header(buffer, &header);
+    (void)fwrite(buffer, 1U, length, file);
+
+    record.timestamp = 0U;
+
+    for (period = 0U; period < periods; period++)
+    {
+        freq   = REPLAY_SYNTH_MAX_FREQ * (double)period / (double)periods;
+        theta  = fmod(theta + (2.0 * REPLAY_PI * freq / REPLAY_SYNTH_LOOP_HZ), 2.0 * REPLAY_PI);
+        alpha  = 0.8 * cos(theta + 0.3);
+        beta   = 0.8 * sin(theta + 0.3);
+
+        /* Q31 binary angle folded into +/-pi/2 */
+        angle = (int32_t)(uint32_t)(int64_t)llround(theta * (REPLAY_Q31 / REPLAY_PI));
+        sign  = 1;
+        if (((uint32_t)angle + 0x40000000U) >= 0x80000000U)
+        {
+            angle = (int32_t)((uint32_t)angle + 0x80000000U);
+            sign  = -1;
+        }
+
+        record.timestamp     = period * REPLAY_SYNTH_PERIOD;
+        record.op            = CORDIC_TRACE_OP_PARK;
+        record.operand_count = 3U;
+        record.operand[0]    = angle;
+        record.operand[1]    = (int32_t)(sign * alpha * REPLAY_Q31);
+        record.operand[2]    = (int32_t)(sign * beta * REPLAY_Q31);
+        length = cordic_trace_encode_record(buffer, &record, previous);
+        previous = record.timestamp;
+        (void)fwrite(buffer, 1U, length, file);
+        written++;
+
+        record.operand_count = 1U;
+        record.operand[1]    = 0;
+        record.operand[2]    = 0;
+
+        record.op         = CORDIC_TRACE_OP_SIN;
+        record.timestamp += REPLAY_SYNTH_CALL_GAP;
+        length = cordic_trace_encode_record(buffer, &record, previous);
+        previous = record.timestamp;
+        (void)fwrite(buffer, 1U, length, file);
+        written++;
+
+        record.op         = CORDIC_TRACE_OP_COS;
+        record.timestamp += REPLAY_SYNTH_CALL_GAP;
+        length = cordic_trace_encode_record(buffer, &record, previous);
+        previous = record.timestamp;
+        (void)fwrite(buffer, 1U, length, file);
+        written++;
+
+        if (0U == (period % 4U))
+        {
+            /* The vectoring operation takes the right half plane only */
+            record.op            = CORDIC_TRACE_OP_ARCTAN;
+            record.operand_count = 2U;
+            record.operand[0]    = (int32_t)(fabs(alpha) * REPLAY_Q23);
+            record.operand[1]    = (int32_t)(((alpha < 0.0) ? -beta : beta) * REPLAY_Q23);
+            record.timestamp    += REPLAY_SYNTH_CALL_GAP;
+            length = cordic_trace_encode_record(buffer, &record, previous);
+            previous = record.timestamp;
+            (void)fwrite(buffer, 1U, length, file);
+            written++;
+
+            /* The current magnitude squared is an exact power of four at standstill */
+            record.op            = CORDIC_TRACE_OP_SQRT;
+            record.operand_count = 1U;
+            record.operand[0]    = (0U == period) ? 0x10000000 : (int32_t)(((alpha * alpha) + (beta * beta)) * 0.5 * REPLAY_Q31);
+            record.operand[1]    = 0;
+            record.timestamp    += REPLAY_SYNTH_CALL_GAP;
+            length = cordic_trace_encode_record(buffer, &record, previous);
+            previous = record.timestamp;
+            (void)fwrite(buffer, 1U, length, file);
+            written++;
+        }
+    }
+
+    fclose(file);
+    printf("%s: %u synthetic records written\n", path, (unsigned int)written);
+
+    return 0;
+}
+
+/*******************************************************************************
+* Function Name: main
+********************************************************************************
+* Summary:
+* Parses the arguments, then replays the trace through all backends and
+* prints the throughput, fast-path hit rate and error tables.
+*
+* Parameters:
+*  int argc     Argument count
+*  char **argv  Arguments
+*
+* Return:
+*  int          0 on success
+*
+*******************************************************************************/
+int main(int argc, char **argv)
+{
+    replay_backend_t      backends[REPLAY_BACKEND_COUNT];
+    cordic_trace_header_t header;
+    cordic_trace_record_t *records = NULL;
+    double                (*reference)[2] = NULL;
+    double                max_error[REPLAY_BACKEND_COUNT][CORDIC_TRACE_OP_COUNT];
+    double                converted[2];
+    double                ref_out[2];
+    double                error    = 0.0;
+    uint64_t              span     = 0U;
+    uint32_t              op_count[CORDIC_TRACE_OP_COUNT];
+    uint32_t              iterations = REPLAY_DEFAULT_ITERATIONS;
+    cordic_soft_corr_t    corr     = CORDIC_SOFT_CORR_TABLE;
+    uint32_t              count    = 0;
+    uint32_t              repeat   = 0;
+    uint32_t              eligible = 0;
+    uint32_t              hits     = 0;
+    uint32_t              start    = 0;
+    uint32_t              elapsed  = 0;
+    uint32_t              b        = 0;
+    uint32_t              i        = 0;
+    uint32_t              r        = 0;
+    uint32_t              o        = 0;
+    int32_t               raw[2];
+    bool                  is_eligible = false;
+    int                   arg      = 1;
+
+    while ((arg + 1) < argc)
+    {
+        if ((0 == strcmp(argv[arg], "-g")) && ((arg + 3) == argc))
+        {
+            return replay_synthesize(argv[arg + 2], (uint32_t)atoi(argv[arg + 1]));
+        }
+        else if (0 == strcmp(argv[arg], "-k"))
+        {
+            iterations = (uint32_t)atoi(argv[arg + 1]);
+        }
+        else if (0 == strcmp(argv[arg], "-c"))
+        {
+            for (i = 0U; (i < 3U) && (0 != strcmp(argv[arg + 1], corr_names[i])); i++) {}
+            corr = (cordic_soft_corr_t)((i < 3U) ? i : (uint32_t)CORDIC_SOFT_CORR_TABLE);
+        }
+        else
+        {
+            break;
+        }
+        arg += 2;
+    }
+
+    if ((arg + 1) != argc)
+    {
+        fprintf(stderr, "usage: %s [-k iterations] [-c none|linear|table] trace\n"
+                        "       %s -g periods trace\n", argv[0], argv[0]);
+        return 2;
+    }
+
+    records = replay_load(argv[arg], &header, &count);
+    if ((NULL == records) || (0U == count))
+    {
+        free(records);
+        return 1;
+    }
+
+    /* Trace statistics as recorded on the target */
+    memset(op_count, 0, sizeof(op_count));
+    for (i = 0U; i < count; i++)
+    {
+        op_count[records[i].op]++;
+        if (i > 0U)
+        {
+            span += (uint32_t)(records[i].timestamp - records[i - 1U].timestamp);
+        }
+    }
+
+    printf("Trace %s: %u records, core clock %u Hz%s\n", argv[arg], (unsigned int)count,
+           (unsigned int)header.clock_hz,
+           (0U != (header.flags & CORDIC_TRACE_FLAG_WRAPPED)) ? ", oldest records lost" : "");
+    if ((0U != span) && (0U != header.clock_hz))
+    {
+        printf("Recorded call rate: %.0f calls/s over %.3f ms\n",
+               (double)(count - 1U) * header.clock_hz / (double)span,
+               1000.0 * (double)span / header.clock_hz);
+    }
+    for (o = 0U; o < CORDIC_TRACE_OP_COUNT; o++)
+    {
+        if (0U != op_count[o])
+        {
+            printf("  %-8s %u\n", op_names[o], (unsigned int)op_count[o]);
+        }
+    }
+
+    /* Fast-path hit rate of the recorded operands */
+    for (i = 0U; i < count; i++)
+    {
+        if (replay_is_fast_hit(&records[i], &is_eligible))
+        {
+            hits++;
+        }
+        eligible += is_eligible ? 1U : 0U;
+    }
+    printf("Fast-path hits: %u of %u eligible calls (%.1f %%), %.1f %% of all calls\n\n",
+           (unsigned int)hits, (unsigned int)eligible,
+           (0U != eligible) ? (100.0 * hits / eligible) : 0.0, 100.0 * hits / count);
+
+    reference = calloc(count, sizeof(*reference));
+    if (NULL == reference)
+    {
+        free(records);
+        return 1;
+    }
+    for (i = 0U; i < count; i++)
+    {
+        replay_reference(&records[i], reference[i]);
+    }
+
+    backends[0] = (replay_backend_t){"peripheral model", CY_CORDIC_EMU_ITERATIONS, CORDIC_SOFT_CORR_NONE, false};
+    backends[1] = (replay_backend_t){"fast path + model", CY_CORDIC_EMU_ITERATIONS, CORDIC_SOFT_CORR_NONE, true};
+    backends[2] = (replay_backend_t){"software kernel", iterations, corr, false};
+
+    repeat = (uint32_t)((REPLAY_TIMING_CALLS + count - 1U) / count);
+    memset(max_error, 0, sizeof(max_error));
+
+    printf("backend           | iterations | correction | ns/call | Mcalls/s\n");
+
+    for (b = 0U; b < REPLAY_BACKEND_COUNT; b++)
+    {
+        cy_cordic_emu_configure(backends[b].iterations, backends[b].corr);
+
+        start = cordic_benchmark_get_cycles();
+        for (r = 0U; r < repeat; r++)
+        {
+            for (i = 0U; i < count; i++)
+            {
+                replay_execute(&records[i], backends[b].fast, raw);
+                replay_sink += raw[0];
+            }
+        }
+        elapsed = cordic_benchmark_get_cycles() - start;
+
+        for (i = 0U; i < count; i++)
+        {
+            replay_execute(&records[i], backends[b].fast, raw);
+            replay_convert(records[i].op, raw, converted);
+
+            for (o = 0U; o < replay_output_count(records[i].op); o++)
+            {
+                error = fabs(converted[o] - reference[i][o]);
+                if (error > max_error[b][records[i].op])
+                {
+                    max_error[b][records[i].op] = error;
+                }
+            }
+        }
+
+        printf("%-17s | %10u | %10s | %7.1f | %8.2f\n", backends[b].name,
+               (unsigned int)backends[b].iterations, corr_names[backends[b].corr],
+               (double)elapsed / ((double)repeat * count),
+               ((double)repeat * count) * 1000.0 / (double)elapsed);
+    }
+
+    /* Math library in double precision as the throughput baseline */
+    start = cordic_benchmark_get_cycles();
+    for (r = 0U; r < repeat; r++)
+    {
+        for (i = 0U; i < count; i++)
+        {
+            replay_reference(&records[i], ref_out);
+            replay_sink += (int32_t)ref_out[0];
+        }
+    }
+    elapsed = cordic_benchmark_get_cycles() - start;
+    printf("%-17s | %10s | %10s | %7.1f | %8.2f\n\n", "math library", "-", "-",
+           (double)elapsed / ((double)repeat * count),
+           ((double)repeat * count) * 1000.0 / (double)elapsed);
+
+    printf("max error | %-17s | %-17s | %-17s\n", backends[0].name, backends[1].name, backends[2].name);
+    for (o = 0U; o < CORDIC_TRACE_OP_COUNT; o++)
+    {
+        if (0U != op_count[o])
+        {
+            printf("%-9s | %17.3e | %17.3e | %17.3e\n", op_names[o],
+                   max_error[0][o], max_error[1][o], max_error[2][o]);
+        }
+    }
+
+    cy_cordic_emu_configure(CY_CORDIC_EMU_ITERATIONS, CORDIC_SOFT_CORR_NONE);
+    free(reference);
+    free(records);
+
+    return 0;
+}
+
+/* [] END OF FILE */
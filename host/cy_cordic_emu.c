@@ -0,0 +1,498 @@
+/*******************************************************************************
+* File Name:   cy_cordic_emu.c
+*
+* Description: This file emulates the CORDIC peripheral driver on the host
+* with the software CORDIC kernel, so that the application and the host tools
+* can call the Cy_CORDIC_ functions unchanged. Operand and result formats follow
+* the driver: Q31 binary angles, Q31, 1Q30, 8Q23 and 20Q11 values, and a Park
+* result in Q23 that includes the circular gain. Like the peripheral, the
+* emulation does not fold operands into the convergence range: a circular
+* rotation or vectoring beyond it stops at the sum of the iteration angles.
+* Operands outside the documented ranges are counted and reported on stderr.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include "cy_pdl.h"
+#include "cy_cordic_emu.h"
+#include "cordic_soft.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Q31 operands are turned into Q23 for the Park transform */
+#define EMU_PARK_SHIFT       (8U)
+
+/* Fraction bits of the 20Q11 results */
+#define EMU_Q11_SHIFT        (11U)
+
+/* Vectoring operands are normalized below this magnitude to keep headroom */
+#define EMU_VECTOR_LIMIT     (0x20000000L)
+
+/* 0.25 in Q30, offset of the hyperbolic square root operands */
+#define EMU_SQRT_QUARTER_Q30 (0x10000000L)
+
+/* Documented operand ranges: +/-90 degrees for the circular rotations, +/-60
+ * degrees (pi / 3) for the hyperbolic ones, and |y / x| <= 0.8 for atanh */
+#define EMU_ANGLE_PI_2       (0x40000000U)
+#define EMU_ANGLE_PI         (0x80000000U)
+#define EMU_HYP_ANGLE_MAX    (715827883L)
+#define EMU_ATANH_RATIO_Q31  (1717986918LL)
+
+/* Bits of the operations in the mask of reported range errors */
+#define EMU_OP_SIN           (0x001U)
+#define EMU_OP_COS           (0x002U)
+#define EMU_OP_TAN           (0x004U)
+#define EMU_OP_ARCTAN        (0x008U)
+#define EMU_OP_SINH          (0x010U)
+#define EMU_OP_COSH          (0x020U)
+#define EMU_OP_TANH          (0x040U)
+#define EMU_OP_ARCTANH       (0x080U)
+#define EMU_OP_PARK          (0x100U)
+
+/* Sum of the circular iteration angles after 24 iterations, 99.88 degrees.
+ * Beyond it, every iteration turns the same way and the rotation stops. */
+#define EMU_CIRCULAR_LIMIT   (1191650118L)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+CORDIC_Type cy_host_cordic = {0};
+
+static uint32_t           emu_iterations = CY_CORDIC_EMU_ITERATIONS;
+static cordic_soft_corr_t emu_corr       = CORDIC_SOFT_CORR_NONE;
+
+static cy_stc_cordic_parkTransform_result_t emu_park_result = {0};
+
+/* Operands outside the documented ranges, and the operations reported */
+static uint32_t emu_range_errors   = 0U;
+static uint32_t emu_range_reported = 0U;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+static int32_t emu_saturate(int64_t value);
+static int32_t emu_divide_q11(int32_t numerator, int32_t denominator);
+static void    emu_normalize(int32_t *x, int32_t *y);
+static bool    emu_check_range(bool in_range, uint32_t op, const char *name, int32_t a, int32_t b);
+static int32_t emu_circular_angle(int32_t angle, uint32_t op, const char *name);
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: emu_saturate
+********************************************************************************
+* Summary:
+* Saturates a 64-bit intermediate to the int32_t range.
+*
+* Parameters:
+*  int64_t value  Value to saturate
+*
+* Return:
+*  int32_t        Saturated value
+*
+*******************************************************************************/
+static int32_t emu_saturate(int64_t value)
+{
+    if (value > INT32_MAX)
+    {
+        value = INT32_MAX;
+    }
+    else if (value < INT32_MIN)
+    {
+        value = INT32_MIN;
+    }
+
+    return (int32_t)value;
+}
+
+/*******************************************************************************
+* Function Name: emu_divide_q11
+********************************************************************************
+* Summary:
+* Divides two values of the same format and returns the quotient in 20Q11,
+* saturating when the denominator is zero or the quotient is out of range.
+*
+* Parameters:
+*  int32_t numerator    Numerator
+*  int32_t denominator  Denominator
+*
+* Return:
+*  int32_t              Quotient in 20Q11
+*
+*******************************************************************************/
+static int32_t emu_divide_q11(int32_t numerator, int32_t denominator)
+{
+    int32_t result = 0;
+
+    if (0 == denominator)
+    {
+        result = (numerator < 0) ? INT32_MIN : INT32_MAX;
+    }
+    else
+    {
+        result = emu_saturate(((int64_t)numerator << EMU_Q11_SHIFT) / denominator);
+    }
+
+    return result;
+}
+
+/*******************************************************************************
+* Function Name: emu_normalize
+********************************************************************************
+* Summary:
+* Scales a vectoring operand pair by a power of two so that the larger
+* component lies just below EMU_VECTOR_LIMIT. Angles do not depend on the
+* scale, and small operands keep their full resolution over all iterations.
+*
+* Parameters:
+*  int32_t *x  X operand, in and out
+*  int32_t *y  Y operand, in and out
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+static void emu_normalize(int32_t *x, int32_t *y)
+{
+    int64_t  ax  = (*x < 0) ? -(int64_t)*x : (int64_t)*x;
+    int64_t  ay  = (*y < 0) ? -(int64_t)*y : (int64_t)*y;
+    int64_t  mag = (ax > ay) ? ax : ay;
+
+    while (mag >= EMU_VECTOR_LIMIT)
+    {
+        *x  >>= 1;
+        *y  >>= 1;
+        mag >>= 1;
+    }
+
+    while ((0 != mag) && (mag < (EMU_VECTOR_LIMIT / 2)))
+    {
+        *x  *= 2;
+        *y  *= 2;
+        mag *= 2;
+    }
+}
+
+/*******************************************************************************
+* Function Name: emu_check_range
+********************************************************************************
+* Summary:
+* Counts an operand outside the documented range of an operation and reports
+* the first one of each operation on stderr, so that host runs show calls that
+* would fail on the peripheral.
+*
+* Parameters:
+*  bool in_range     true when the operands are inside the range
+*  uint32_t op       Bit of the operation in the reported mask
+*  const char *name  Driver function
+*  int32_t a         First operand
+*  int32_t b         Second operand
+*
+* Return:
+*  bool              in_range
+*
+*******************************************************************************/
+static bool emu_check_range(bool in_range, uint32_t op, const char *name, int32_t a, int32_t b)
+{
+    if (!in_range)
+    {
+        emu_range_errors++;
+        if (0U == (emu_range_reported & op))
+        {
+            emu_range_reported |= op;
+            (void)fprintf(stderr, "CORDIC emulation: %s operands 0x%08X, 0x%08X outside the range of "
+                          "the peripheral\n", name, (unsigned int)a, (unsigned int)b);
+        }
+    }
+
+    return in_range;
+}
+
+/*******************************************************************************
+* Function Name: emu_circular_angle
+********************************************************************************
+* Summary:
+* Rotation angle the peripheral reaches for a circular rotation. Angles
+* outside +/-90 degrees are reported; the peripheral still converges up to
+* the sum of its iteration angles and stops there for larger angles.
+*
+* Parameters:
+*  int32_t angle     Q31 binary angle
+*  uint32_t op       Bit of the operation in the reported mask
+*  const char *name  Driver function
+*
+* Return:
+*  int32_t           Angle reached, Q31 binary angle
+*
+*******************************************************************************/
+static int32_t emu_circular_angle(int32_t angle, uint32_t op, const char *name)
+{
+    if (!emu_check_range((uint32_t)((uint32_t)angle + EMU_ANGLE_PI_2) <= EMU_ANGLE_PI, op, name, angle, 0))
+    {
+        angle = (angle > EMU_CIRCULAR_LIMIT) ? EMU_CIRCULAR_LIMIT :
+                ((angle < -EMU_CIRCULAR_LIMIT) ? -EMU_CIRCULAR_LIMIT : angle);
+    }
+
+    return angle;
+}
+
+/*******************************************************************************
+* Function Name: cy_cordic_emu_range_errors
+********************************************************************************
+* Summary:
+* Number of driver calls with operands outside the documented ranges since
+* the start of the process.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  uint32_t  Number of calls
+*
+*******************************************************************************/
+uint32_t cy_cordic_emu_range_errors(void)
+{
+    return emu_range_errors;
+}
+
+/*******************************************************************************
+* Function Name: cy_cordic_emu_configure
+********************************************************************************
+* Summary:
+* Selects the iteration count and the residual correction of the emulated
+* peripheral. The default models the hardware, other settings let the host
+* tools replay the same operands through a truncated software kernel.
+*
+* Parameters:
+*  uint32_t iterations      Number of CORDIC iterations
+*  cordic_soft_corr_t corr  Residual correction of the circular rotations
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void cy_cordic_emu_configure(uint32_t iterations, cordic_soft_corr_t corr)
+{
+    emu_iterations = iterations;
+    emu_corr       = corr;
+}
+
+/*******************************************************************************
+* Emulated driver functions. The interface is the one of the CORDIC driver in
+* the peripheral driver library, see its API reference for the details.
+*******************************************************************************/
+void Cy_CORDIC_Enable(CORDIC_Type *base)
+{
+    base->CTL = 1U;
+}
+
+bool Cy_CORDIC_IsBusy(CORDIC_Type *base)
+{
+    (void)base;
+
+    return false;
+}
+
+CY_CORDIC_Q31_t Cy_CORDIC_Sin(CORDIC_Type *base, CY_CORDIC_Q31_t angle)
+{
+    int32_t sin_q31 = 0;
+    int32_t cos_q31 = 0;
+
+    (void)base;
+    angle = emu_circular_angle(angle, EMU_OP_SIN, "Cy_CORDIC_Sin");
+    cordic_soft_sincos(angle, emu_iterations, emu_corr, &sin_q31, &cos_q31);
+
+    return sin_q31;
+}
+
+CY_CORDIC_Q31_t Cy_CORDIC_Cos(CORDIC_Type *base, CY_CORDIC_Q31_t angle)
+{
+    int32_t sin_q31 = 0;
+    int32_t cos_q31 = 0;
+
+    (void)base;
+    angle = emu_circular_angle(angle, EMU_OP_COS, "Cy_CORDIC_Cos");
+    cordic_soft_sincos(angle, emu_iterations, emu_corr, &sin_q31, &cos_q31);
+
+    return cos_q31;
+}
+
+CY_CORDIC_20Q11_t Cy_CORDIC_Tan(CORDIC_Type *base, CY_CORDIC_Q31_t angle)
+{
+    int32_t sin_q31 = 0;
+    int32_t cos_q31 = 0;
+
+    (void)base;
+    angle = emu_circular_angle(angle, EMU_OP_TAN, "Cy_CORDIC_Tan");
+    cordic_soft_sincos(angle, emu_iterations, emu_corr, &sin_q31, &cos_q31);
+
+    return emu_divide_q11(sin_q31, cos_q31);
+}
+
+CY_CORDIC_Q31_t Cy_CORDIC_ArcTan(CORDIC_Type *base, CY_CORDIC_8Q23_t x, CY_CORDIC_8Q23_t y)
+{
+    int32_t angle    = 0;
+    bool    in_range = emu_check_range((x > 0) || ((0 == x) && (0 != y)), EMU_OP_ARCTAN,
+                                       "Cy_CORDIC_ArcTan", x, y);
+
+    (void)base;
+    emu_normalize(&x, &y);
+    cordic_soft_vector(&x, &y, &angle, emu_iterations);
+
+    /* Without the fold of the left half plane the vectoring stops at the sum
+     * of the iteration angles */
+    if (!in_range)
+    {
+        angle = (angle > EMU_CIRCULAR_LIMIT) ? EMU_CIRCULAR_LIMIT :
+                ((angle < -EMU_CIRCULAR_LIMIT) ? -EMU_CIRCULAR_LIMIT : angle);
+    }
+
+    return angle;
+}
+
+CY_CORDIC_1Q30_t Cy_CORDIC_Sinh(CORDIC_Type *base, CY_CORDIC_Q31_t angle)
+{
+    int32_t x = cordic_soft_gain_inverse_hyp(emu_iterations);
+    int32_t y = 0;
+
+    (void)base;
+    (void)emu_check_range((angle >= -EMU_HYP_ANGLE_MAX) && (angle <= EMU_HYP_ANGLE_MAX), EMU_OP_SINH,
+                          "Cy_CORDIC_Sinh", angle, 0);
+    cordic_soft_rotate_hyp(&x, &y, angle, emu_iterations);
+
+    return y;
+}
+
+CY_CORDIC_1Q30_t Cy_CORDIC_Cosh(CORDIC_Type *base, CY_CORDIC_Q31_t angle)
+{
+    int32_t x = cordic_soft_gain_inverse_hyp(emu_iterations);
+    int32_t y = 0;
+
+    (void)base;
+    (void)emu_check_range((angle >= -EMU_HYP_ANGLE_MAX) && (angle <= EMU_HYP_ANGLE_MAX), EMU_OP_COSH,
+                          "Cy_CORDIC_Cosh", angle, 0);
+    cordic_soft_rotate_hyp(&x, &y, angle, emu_iterations);
+
+    return x;
+}
+
+CY_CORDIC_20Q11_t Cy_CORDIC_Tanh(CORDIC_Type *base, CY_CORDIC_Q31_t angle)
+{
+    int32_t x = cordic_soft_gain_inverse_hyp(emu_iterations);
+    int32_t y = 0;
+
+    (void)base;
+    (void)emu_check_range((angle >= -EMU_HYP_ANGLE_MAX) && (angle <= EMU_HYP_ANGLE_MAX), EMU_OP_TANH,
+                          "Cy_CORDIC_Tanh", angle, 0);
+    cordic_soft_rotate_hyp(&x, &y, angle, emu_iterations);
+
+    return emu_divide_q11(y, x);
+}
+
+CY_CORDIC_Q31_t Cy_CORDIC_ArcTanh(CORDIC_Type *base, CY_CORDIC_8Q23_t x, CY_CORDIC_8Q23_t y)
+{
+    int32_t angle = 0;
+
+    (void)base;
+    (void)emu_check_range((x > 0) && (((int64_t)((y < 0) ? -(int64_t)y : (int64_t)y) << 31) <=
+                                      ((int64_t)x * EMU_ATANH_RATIO_Q31)),
+                          EMU_OP_ARCTANH, "Cy_CORDIC_ArcTanh", x, y);
+    emu_normalize(&x, &y);
+    cordic_soft_vector_hyp(&x, &y, &angle, emu_iterations);
+
+    return angle;
+}
+
+CY_CORDIC_Q31_t Cy_CORDIC_Sqrt(CORDIC_Type *base, CY_CORDIC_Q31_t x)
+{
+    int32_t  result = 0;
+    uint32_t shift  = 0;
+    int32_t  w      = 0;
+    int32_t  xv     = 0;
+    int32_t  yv     = 0;
+    int32_t  angle  = 0;
+
+    (void)base;
+
+    if (x > 0)
+    {
+        /* x = w / 4^shift with w in [0.25, 1), so sqrt(x) = sqrt(w) / 2^shift */
+        shift = (uint32_t)(__CLZ((uint32_t)x) - 1U) >> 1U;
+        w     = (int32_t)(((uint32_t)x << (2U * shift)) >> 1U);
+
+        /* Hyperbolic vectoring of (w + 1/4, w - 1/4) gives x = Kh * sqrt(w) in Q30 */
+        xv = w + EMU_SQRT_QUARTER_Q30;
+        yv = w - EMU_SQRT_QUARTER_Q30;
+        cordic_soft_vector_hyp(&xv, &yv, &angle, emu_iterations);
+
+        result = (int32_t)((((int64_t)xv * cordic_soft_gain_inverse_hyp(emu_iterations)) +
+                            ((int64_t)1 << (28U + shift))) >> (29U + shift));
+    }
+
+    return result;
+}
+
+void Cy_CORDIC_ParkTransformNB(CORDIC_Type *base, CY_CORDIC_Q31_t theta,
+                               CY_CORDIC_Q31_t ialpha, CY_CORDIC_Q31_t ibeta)
+{
+    int32_t x        = ialpha >> EMU_PARK_SHIFT;
+    int32_t y        = ibeta >> EMU_PARK_SHIFT;
+    int32_t residual = 0;
+
+    (void)base;
+    theta = emu_circular_angle(theta, EMU_OP_PARK, "Cy_CORDIC_ParkTransformNB");
+
+    /* Id and Iq are (alpha, beta) rotated by -theta, scaled by the gain */
+    cordic_soft_rotate(&x, &y, (int32_t)(0U - (uint32_t)theta), emu_iterations, &residual);
+    cordic_soft_correct(&x, &y, residual, emu_corr);
+
+    emu_park_result.parkTransformId = x;
+    emu_park_result.parkTransformIq = y;
+}
+
+void Cy_CORDIC_GetParkResult(CORDIC_Type *base, cy_stc_cordic_parkTransform_result_t *result)
+{
+    (void)base;
+    *result = emu_park_result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,371 @@
+/*******************************************************************************
+* File Name:   host_platform.c
+*
+* Description: This file contains the host platform layer. It implements the
+* device resources the application sources expect from the PDL, so that they
+* can run as a native process on the development machine: the cycle counter,
+* the board initialization and the debug UART, which is mapped to the standard
+* streams or to a pseudo terminal.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+
+/* posix_openpt() and ptsname() for the pseudo terminal UART */
+#define _XOPEN_SOURCE 600
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <time.h>
+#include "cy_pdl.h"
+#include "cybsp.h"
+#include "cy_retarget_io.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* The emulated core clock counts nanoseconds */
+#define HOST_CORE_CLOCK_HZ (1000000000UL)
+
+/* Environment variable selecting the debug UART mapping */
+#define HOST_UART_ENV      "CORDIC_HOST_UART"
+#define HOST_UART_PTY      "pty"
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+uint32_t SystemCoreClock = HOST_CORE_CLOCK_HZ;
+DCB_Type cy_host_dcb     = {0};
+CySCB_Type cy_host_scb   = {0};
+
+const cy_stc_scb_uart_config_t    DEBUG_UART_config     = {8U};
+const mtb_hal_uart_configurator_t DEBUG_UART_hal_config = {0U};
+
+static DWT_Type               host_dwt         = {0};
+static cy_en_clkhf_dividers_t host_clkhf0_div  = CY_SYSCLK_CLKHF_NO_DIVIDE;
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/*******************************************************************************
+* Function Name: cy_host_dwt
+********************************************************************************
+* Summary:
+* Returns the emulated DWT unit after refreshing its cycle counter from the
+* host monotonic clock.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  DWT_Type *  Emulated DWT unit
+*
+*******************************************************************************/
+DWT_Type *cy_host_dwt(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    host_dwt.CYCCNT = (uint32_t)(((uint64_t)now.tv_sec * HOST_CORE_CLOCK_HZ) + (uint64_t)now.tv_nsec);
+
+    return &host_dwt;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_ClkHfSetDivider
+********************************************************************************
+* Summary:
+* Sets the emulated divider of CLK_HF0. Other clock roots are not emulated.
+*
+* Parameters:
+*  uint32_t clkHf                   Clock root
+*  cy_en_clkhf_dividers_t divider   Divider
+*
+* Return:
+*  cy_en_sysclk_status_t  CY_SYSCLK_BAD_PARAM for other clock roots
+*
+*******************************************************************************/
+cy_en_sysclk_status_t Cy_SysClk_ClkHfSetDivider(uint32_t clkHf, cy_en_clkhf_dividers_t divider)
+{
+    cy_en_sysclk_status_t status = CY_SYSCLK_BAD_PARAM;
+
+    if ((0U == clkHf) && (divider <= CY_SYSCLK_CLKHF_DIVIDE_BY_8))
+    {
+        host_clkhf0_div = divider;
+        status          = CY_SYSCLK_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysClk_ClkHfGetDivider
+********************************************************************************
+* Summary:
+* Returns the emulated divider of CLK_HF0.
+*
+* Parameters:
+*  uint32_t clkHf  Clock root
+*
+* Return:
+*  cy_en_clkhf_dividers_t  Divider
+*
+*******************************************************************************/
+cy_en_clkhf_dividers_t Cy_SysClk_ClkHfGetDivider(uint32_t clkHf)
+{
+    (void)clkHf;
+
+    return host_clkhf0_div;
+}
+
+/*******************************************************************************
+* Function Name: SystemCoreClockUpdate
+********************************************************************************
+* Summary:
+* Updates SystemCoreClock from the emulated CLK_HF0 divider.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void SystemCoreClockUpdate(void)
+{
+    SystemCoreClock = HOST_CORE_CLOCK_HZ >> (uint32_t)host_clkhf0_div;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_SetWaitStates
+********************************************************************************
+* Summary:
+* Flash wait states are not emulated.
+*
+* Parameters:
+*  bool ulpMode       Low-power mode
+*  uint32_t clkHfMHz  Clock frequency in MHz
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void Cy_SysLib_SetWaitStates(bool ulpMode, uint32_t clkHfMHz)
+{
+    (void)ulpMode;
+    (void)clkHfMHz;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SysLib_Delay
+********************************************************************************
+* Summary:
+* Blocking delay.
+*
+* Parameters:
+*  uint32_t milliseconds  Delay in milliseconds
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void Cy_SysLib_Delay(uint32_t milliseconds)
+{
+    struct timespec delay;
+
+    delay.tv_sec  = (time_t)(milliseconds / 1000U);
+    delay.tv_nsec = (long)(milliseconds % 1000U) * 1000000L;
+    (void)nanosleep(&delay, NULL);
+}
+
+/*******************************************************************************
+* Function Name: cybsp_init
+********************************************************************************
+* Summary:
+* Board initialization. Nothing to set up on the host.
+*
+* Parameters:
+*  void
+*
+* Return:
+*  cy_rslt_t  CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t cybsp_init(void)
+{
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_Init
+********************************************************************************
+* Summary:
+* Initializes the emulated debug UART.
+*
+* Parameters:
+*  CySCB_Type *base                          SCB instance
+*  cy_stc_scb_uart_config_t const *config    UART configuration
+*  cy_stc_scb_uart_context_t *context        UART context
+*
+* Return:
+*  cy_en_scb_uart_status_t  CY_SCB_UART_SUCCESS, CY_SCB_UART_BAD_PARAM on NULL
+*
+*******************************************************************************/
+cy_en_scb_uart_status_t Cy_SCB_UART_Init(CySCB_Type *base, cy_stc_scb_uart_config_t const *config,
+                                         cy_stc_scb_uart_context_t *context)
+{
+    cy_en_scb_uart_status_t status = CY_SCB_UART_BAD_PARAM;
+
+    if ((NULL != base) && (NULL != config) && (NULL != context))
+    {
+        context->initialized = 1U;
+        status = CY_SCB_UART_SUCCESS;
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+* Function Name: Cy_SCB_UART_Enable
+********************************************************************************
+* Summary:
+* Enables the emulated debug UART.
+*
+* Parameters:
+*  CySCB_Type *base  SCB instance
+*
+* Return:
+*  void
+*
+*******************************************************************************/
+void Cy_SCB_UART_Enable(CySCB_Type *base)
+{
+    base->CTRL = 1U;
+}
+
+/*******************************************************************************
+* Function Name: mtb_hal_uart_setup
+********************************************************************************
+* Summary:
+* Binds the HAL UART object to the UART context.
+*
+* Parameters:
+*  mtb_hal_uart_t *obj                        HAL UART object
+*  const mtb_hal_uart_configurator_t *config  HAL UART configuration
+*  cy_stc_scb_uart_context_t *context         UART context
+*  void *clock                                Clock, unused
+*
+* Return:
+*  cy_rslt_t  CY_RSLT_SUCCESS
+*
+*******************************************************************************/
+cy_rslt_t mtb_hal_uart_setup(mtb_hal_uart_t *obj, const mtb_hal_uart_configurator_t *config,
+                             cy_stc_scb_uart_context_t *context, void *clock)
+{
+    (void)config;
+    (void)clock;
+    obj->context = context;
+
+    return CY_RSLT_SUCCESS;
+}
+
+/*******************************************************************************
+* Function Name: cy_retarget_io_init
+********************************************************************************
+* Summary:
+* Maps the debug UART to the process. By default the standard streams are
+* used, so the firmware can be driven by scripts and pipes. With
+* CORDIC_HOST_UART=pty a pseudo terminal is created and its name printed, a
+* terminal program connects to it like to the KitProg3 COM port. The terminal
+* is switched to raw mode, so the "\r\n" line endings pass unchanged.
+*
+* Parameters:
+*  mtb_hal_uart_t *obj  HAL UART object
+*
+* Return:
+*  cy_rslt_t  CY_RSLT_SUCCESS, or 1 if the pseudo terminal cannot be created
+*
+*******************************************************************************/
+cy_rslt_t cy_retarget_io_init(mtb_hal_uart_t *obj)
+{
+    const char     *mapping = getenv(HOST_UART_ENV);
+    cy_rslt_t      result   = CY_RSLT_SUCCESS;
+    struct termios tio;
+    int            master   = -1;
+    int            slave    = -1;
+
+    (void)obj;
+
+    if ((NULL != mapping) && (0 == strcmp(mapping, HOST_UART_PTY)))
+    {
+        master = posix_openpt(O_RDWR | O_NOCTTY);
+
+        if ((master < 0) || (0 != grantpt(master)) || (0 != unlockpt(master)))
+        {
+            perror("posix_openpt");
+            result = 1U;
+        }
+        else
+        {
+            /* The slave stays open, so the master does not see a hangup
+             * while no terminal program is connected */
+            slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+            if ((slave >= 0) && (0 == tcgetattr(slave, &tio)))
+            {
+                tio.c_iflag &= ~(tcflag_t)(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+                tio.c_oflag &= ~(tcflag_t)OPOST;
+                tio.c_lflag &= ~(tcflag_t)(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+                (void)tcsetattr(slave, TCSANOW, &tio);
+            }
+
+            fprintf(stderr, "Debug UART on %s\n", ptsname(master));
+            (void)dup2(master, STDIN_FILENO);
+            (void)dup2(master, STDOUT_FILENO);
+        }
+    }
+
+    /* The prompts end in a new line, line buffering keeps them in order */
+    (void)setvbuf(stdout, NULL, _IOLBF, 0U);
+
+    return result;
+}
+
+/* [] END OF FILE */
@@ -0,0 +1,264 @@
+/*******************************************************************************
+* File Name:   arm_math.h
+*
+* Description: Host stand-in for the CMSIS-DSP header. It provides the CMSIS-DSP
+* types, the inline controller functions, and the table-based fast math
+* functions used by the application sources for the native build.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef ARM_MATH_H
+#define ARM_MATH_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <math.h>
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+typedef int8_t  q7_t;
+typedef int16_t q15_t;
+typedef int32_t q31_t;
+typedef int64_t q63_t;
+typedef float   float32_t;
+typedef double  float64_t;
+
+#define PI (3.14159265358979f)
+
+/* Status of the matrix functions */
+typedef enum
+{
+    ARM_MATH_SUCCESS        = 0,
+    ARM_MATH_ARGUMENT_ERROR = -1,
+    ARM_MATH_LENGTH_ERROR   = -2,
+    ARM_MATH_SIZE_MISMATCH  = -3,
+    ARM_MATH_NANINF         = -4,
+    ARM_MATH_SINGULAR       = -5,
+    ARM_MATH_TEST_FAILURE   = -6
+} arm_status;
+
+/* Q31 matrix, row major */
+typedef struct
+{
+    uint16_t numRows;
+    uint16_t numCols;
+    q31_t    *pData;
+} arm_matrix_instance_q31;
+
+/* Size of the sine table of the fast math functions */
+#define FAST_MATH_TABLE_SIZE  (512)
+#define FAST_MATH_Q31_SHIFT   (32 - 10)
+
+/*******************************************************************************
+* Function Definitions
+*******************************************************************************/
+/* Saturating 32-bit addition and subtraction, as the QADD and QSUB instructions */
+static inline q31_t arm_host_qadd(q31_t a, q31_t b)
+{
+    q63_t sum = (q63_t)a + b;
+
+    return (sum > INT32_MAX) ? INT32_MAX : ((sum < INT32_MIN) ? INT32_MIN : (q31_t)sum);
+}
+
+static inline q31_t arm_host_qsub(q31_t a, q31_t b)
+{
+    q63_t diff = (q63_t)a - b;
+
+    return (diff > INT32_MAX) ? INT32_MAX : ((diff < INT32_MIN) ? INT32_MIN : (q31_t)diff);
+}
+
+/* Park transform in Q31, same arithmetic as the CMSIS-DSP inline function */
+static inline void arm_park_q31(q31_t Ialpha, q31_t Ibeta, q31_t *pId, q31_t *pIq,
+                                q31_t sinVal, q31_t cosVal)
+{
+    q31_t product1 = (q31_t)(((q63_t)Ialpha * cosVal) >> 31);
+    q31_t product2 = (q31_t)(((q63_t)Ibeta * sinVal) >> 31);
+    q31_t product3 = (q31_t)(((q63_t)Ialpha * sinVal) >> 31);
+    q31_t product4 = (q31_t)(((q63_t)Ibeta * cosVal) >> 31);
+
+    *pId = arm_host_qadd(product1, product2);
+    *pIq = arm_host_qsub(product4, product3);
+}
+
+/* Cosine in Q31, same table and interpolation as the CMSIS-DSP function. The
+ * input in [0, 1) maps to [0, 2 * pi). The table is filled on the first call
+ * instead of being stored as a constant array. */
+static inline q31_t arm_cos_q31(q31_t x)
+{
+    static q31_t sinTable_q31[FAST_MATH_TABLE_SIZE + 1];
+    static int   filled = 0;
+    q31_t        cosVal;
+    q31_t        fract;
+    q31_t        a;
+    q31_t        b;
+    uint32_t     index;
+    int          i;
+
+    if (0 == filled)
+    {
+        for (i = 0; i <= FAST_MATH_TABLE_SIZE; i++)
+        {
+            double value = round(sin(2.0 * 3.14159265358979323846 * i / FAST_MATH_TABLE_SIZE) * 2147483648.0);
+
+            sinTable_q31[i] = (value > (double)INT32_MAX) ? INT32_MAX : (q31_t)value;
+        }
+        filled = 1;
+    }
+
+    x = (q31_t)((uint32_t)x + 0x20000000U);
+    if (x < 0)
+    {
+        x = (q31_t)((uint32_t)x + 0x80000000U);
+    }
+
+    index = (uint32_t)x >> FAST_MATH_Q31_SHIFT;
+    fract = (q31_t)(((uint32_t)x - (index << FAST_MATH_Q31_SHIFT)) << 9);
+
+    a = sinTable_q31[index];
+    b = sinTable_q31[index + 1];
+
+    cosVal = (q31_t)(((q63_t)(0x80000000U - (uint32_t)fract) * a) >> 32);
+    cosVal = (q31_t)((((q63_t)cosVal << 32) + ((q63_t)fract * b)) >> 32);
+
+    return (q31_t)((uint32_t)cosVal << 1);
+}
+
+/* Q31 matrix functions with the CMSIS-DSP arithmetic. The sizes are checked
+ * as with ARM_MATH_MATRIX_CHECK defined. */
+static inline void arm_mat_init_q31(arm_matrix_instance_q31 *S, uint16_t nRows,
+                                    uint16_t nColumns, q31_t *pData)
+{
+    S->numRows = nRows;
+    S->numCols = nColumns;
+    S->pData   = pData;
+}
+
+static inline arm_status arm_mat_add_q31(const arm_matrix_instance_q31 *pSrcA,
+                                         const arm_matrix_instance_q31 *pSrcB,
+                                         arm_matrix_instance_q31 *pDst)
+{
+    uint32_t i;
+
+    if ((pSrcA->numRows != pSrcB->numRows) || (pSrcA->numCols != pSrcB->numCols) ||
+        (pSrcA->numRows != pDst->numRows) || (pSrcA->numCols != pDst->numCols))
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    for (i = 0U; i < ((uint32_t)pSrcA->numRows * pSrcA->numCols); i++)
+    {
+        pDst->pData[i] = arm_host_qadd(pSrcA->pData[i], pSrcB->pData[i]);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+static inline arm_status arm_mat_sub_q31(const arm_matrix_instance_q31 *pSrcA,
+                                         const arm_matrix_instance_q31 *pSrcB,
+                                         arm_matrix_instance_q31 *pDst)
+{
+    uint32_t i;
+
+    if ((pSrcA->numRows != pSrcB->numRows) || (pSrcA->numCols != pSrcB->numCols) ||
+        (pSrcA->numRows != pDst->numRows) || (pSrcA->numCols != pDst->numCols))
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    for (i = 0U; i < ((uint32_t)pSrcA->numRows * pSrcA->numCols); i++)
+    {
+        pDst->pData[i] = arm_host_qsub(pSrcA->pData[i], pSrcB->pData[i]);
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+/* The 2.62 accumulator is truncated to 1.31 without saturation */
+static inline arm_status arm_mat_mult_q31(const arm_matrix_instance_q31 *pSrcA,
+                                          const arm_matrix_instance_q31 *pSrcB,
+                                          arm_matrix_instance_q31 *pDst)
+{
+    uint32_t row;
+    uint32_t col;
+    uint32_t k;
+    q63_t    sum;
+
+    if ((pSrcA->numCols != pSrcB->numRows) || (pSrcA->numRows != pDst->numRows) ||
+        (pSrcB->numCols != pDst->numCols))
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    for (row = 0U; row < pSrcA->numRows; row++)
+    {
+        for (col = 0U; col < pSrcB->numCols; col++)
+        {
+            sum = 0;
+            for (k = 0U; k < pSrcA->numCols; k++)
+            {
+                sum += (q63_t)pSrcA->pData[(row * pSrcA->numCols) + k] *
+                       pSrcB->pData[(k * pSrcB->numCols) + col];
+            }
+            pDst->pData[(row * pDst->numCols) + col] = (q31_t)(sum >> 31);
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+static inline arm_status arm_mat_trans_q31(const arm_matrix_instance_q31 *pSrc,
+                                           arm_matrix_instance_q31 *pDst)
+{
+    uint32_t row;
+    uint32_t col;
+
+    if ((pSrc->numRows != pDst->numCols) || (pSrc->numCols != pDst->numRows))
+    {
+        return ARM_MATH_SIZE_MISMATCH;
+    }
+    for (row = 0U; row < pSrc->numRows; row++)
+    {
+        for (col = 0U; col < pSrc->numCols; col++)
+        {
+            pDst->pData[(col * pDst->numCols) + row] = pSrc->pData[(row * pSrc->numCols) + col];
+        }
+    }
+
+    return ARM_MATH_SUCCESS;
+}
+
+#endif /*ARM_MATH_H*/
+/* [] END OF FILE */
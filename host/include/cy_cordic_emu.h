@@ -0,0 +1,66 @@
+/*******************************************************************************
+* File Name:   cy_cordic_emu.h
+*
+* Description: This header file contains the configuration interface of the host
+* emulation of the CORDIC peripheral driver. The emulated driver functions are
+* declared in cy_pdl.h together with the rest of the device stub.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CY_CORDIC_EMU_H
+#define CY_CORDIC_EMU_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include "cordic_soft.h"
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+/* Iteration count used to model the peripheral. The circular gain after 24
+ * iterations matches the CORDIC_CIRCULAR_GAIN the application compensates. */
+#define CY_CORDIC_EMU_ITERATIONS (24U)
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+void     cy_cordic_emu_configure(uint32_t iterations, cordic_soft_corr_t corr);
+uint32_t cy_cordic_emu_range_errors(void);
+
+#endif /*CY_CORDIC_EMU_H*/
+/* [] END OF FILE */
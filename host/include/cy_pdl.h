@@ -0,0 +1,204 @@
+/*******************************************************************************
+* File Name:   cy_pdl.h
+*
+* Description: Host stand-in for the PDL header. It provides the subset of the
+* device definitions used by the application sources, so that the kernels and
+* benchmarks can be built and run natively on the development machine.
+*
+* Related Document: See README.md
+*
+*
+*******************************************************************************
+* Copyright 2026, Cypress Semiconductor Corporation (an Infineon company) or
+* an affiliate of Cypress Semiconductor Corporation.  All rights reserved.
+*
+* This software, including source code, documentation and related
+* materials ("Software") is owned by Cypress Semiconductor Corporation
+* or one of its affiliates ("Cypress") and is protected by and subject to
+* worldwide patent protection (United States and foreign),
+* United States copyright laws and international treaty provisions.
+* Therefore, you may use this Software only as provided in the license
+* agreement accompanying the software package from which you
+* obtained this Software ("EULA").
+* If no EULA applies, Cypress hereby grants you a personal, non-exclusive,
+* non-transferable license to copy, modify, and compile the Software
+* source code solely for use in connection with Cypress's
+* integrated circuit products.  Any reproduction, modification, translation,
+* compilation, or representation of this Software except as specified
+* above is prohibited without the express written permission of Cypress.
+*
+* Disclaimer: THIS SOFTWARE IS PROVIDED AS-IS, WITH NO WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING, BUT NOT LIMITED TO, NONINFRINGEMENT, IMPLIED
+* WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE. Cypress
+* reserves the right to make changes to the Software without notice. Cypress
+* does not assume any liability arising out of the application or use of the
+* Software or any product or circuit described in the Software. Cypress does
+* not authorize its products for use in any products where a malfunction or
+* failure of the Cypress product may reasonably be expected to result in
+* significant property damage, injury or death ("High Risk Product"). By
+* including Cypress's product in a High Risk Product, the manufacturer
+* of such system or application assumes all risk of such use and in doing
+* so agrees to indemnify Cypress against all liability.
+*******************************************************************************/
+#ifndef CY_PDL_H
+#define CY_PDL_H
+
+/*******************************************************************************
+* Header Files
+*******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <assert.h>
+
+/******************************************************************************
+* Macros
+*******************************************************************************/
+#define __STATIC_INLINE static inline
+#define __STATIC_FORCEINLINE static inline __attribute__((always_inline))
+
+/* Count leading zeros, as provided by the CMSIS core header */
+__STATIC_INLINE uint8_t __CLZ(uint32_t value)
+{
+    return (0U == value) ? 32U : (uint8_t)__builtin_clz(value);
+}
+
+/* The DWT cycle counter is emulated with the host monotonic clock. CYCCNT is
+ * refreshed on every access to DWT, one cycle corresponds to one nanosecond. */
+typedef struct
+{
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct
+{
+    volatile uint32_t DEMCR;
+} DCB_Type;
+
+#define DWT                    (cy_host_dwt())
+#define DCB                    (&cy_host_dcb)
+#define DWT_CTRL_CYCCNTENA_Msk (1UL)
+#define DCB_DEMCR_TRCENA_Msk   (1UL << 24U)
+
+/* Result codes and assertions of the device support library */
+typedef uint32_t cy_rslt_t;
+
+#define CY_RSLT_SUCCESS        ((cy_rslt_t)0x00000000U)
+#define CY_ASSERT(x)           assert(x)
+#define CY_ALIGN(align)        __attribute__((aligned(align)))
+
+/* Code placement in RAM has no meaning on the host */
+#define CY_RAMFUNC_BEGIN
+#define CY_RAMFUNC_END
+
+/* Clock dividers of CLK_HF. The host tracks the divider and scales
+ * SystemCoreClock, the DWT cycle counter keeps counting nanoseconds. */
+typedef enum
+{
+    CY_SYSCLK_CLKHF_NO_DIVIDE   = 0U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_2 = 1U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_4 = 2U,
+    CY_SYSCLK_CLKHF_DIVIDE_BY_8 = 3U
+} cy_en_clkhf_dividers_t;
+
+typedef enum
+{
+    CY_SYSCLK_SUCCESS   = 0x00U,
+    CY_SYSCLK_BAD_PARAM = 0x01U
+} cy_en_sysclk_status_t;
+
+/* Interrupts are not emulated */
+#define __enable_irq()
+#define __disable_irq()
+
+/* SCB UART driver. The debug UART is mapped to the standard streams of the
+ * process by the host retarget-io layer, these calls only track the state. */
+typedef enum
+{
+    CY_SCB_UART_SUCCESS   = 0x00U,
+    CY_SCB_UART_BAD_PARAM = 0x01U
+} cy_en_scb_uart_status_t;
+
+typedef struct
+{
+    volatile uint32_t CTRL;
+} CySCB_Type;
+
+typedef struct
+{
+    uint32_t oversample;
+} cy_stc_scb_uart_config_t;
+
+typedef struct
+{
+    uint32_t initialized;
+} cy_stc_scb_uart_context_t;
+
+/* CORDIC driver types. The driver functions are emulated in cy_cordic_emu.c. */
+typedef int32_t CY_CORDIC_Q31_t;
+typedef int32_t CY_CORDIC_1Q30_t;
+typedef int32_t CY_CORDIC_8Q23_t;
+typedef int32_t CY_CORDIC_20Q11_t;
+
+typedef enum
+{
+    CY_CORDIC_SUCCESS   = 0x00U,
+    CY_CORDIC_BAD_PARAM = 0x01U
+} cy_en_cordic_status_t;
+
+typedef struct
+{
+    int32_t parkTransformIq;
+    int32_t parkTransformId;
+} cy_stc_cordic_parkTransform_result_t;
+
+typedef struct
+{
+    volatile uint32_t CTL;
+} CORDIC_Type;
+
+#define MXCORDIC (&cy_host_cordic)
+
+/*******************************************************************************
+* Global Variables
+*******************************************************************************/
+extern uint32_t    SystemCoreClock;
+extern DCB_Type    cy_host_dcb;
+extern CORDIC_Type cy_host_cordic;
+extern CySCB_Type  cy_host_scb;
+
+/*******************************************************************************
+* Function Prototypes
+********************************************************************************/
+DWT_Type *cy_host_dwt(void);
+
+cy_en_sysclk_status_t  Cy_SysClk_ClkHfSetDivider(uint32_t clkHf, cy_en_clkhf_dividers_t divider);
+cy_en_clkhf_dividers_t Cy_SysClk_ClkHfGetDivider(uint32_t clkHf);
+void                   SystemCoreClockUpdate(void);
+void                   Cy_SysLib_SetWaitStates(bool ulpMode, uint32_t clkHfMHz);
+void                   Cy_SysLib_Delay(uint32_t milliseconds);
+
+cy_en_scb_uart_status_t Cy_SCB_UART_Init(CySCB_Type *base, cy_stc_scb_uart_config_t const *config,
+                                         cy_stc_scb_uart_context_t *context);
+void                    Cy_SCB_UART_Enable(CySCB_Type *base);
+
+void               Cy_CORDIC_Enable(CORDIC_Type *base);
+bool               Cy_CORDIC_IsBusy(CORDIC_Type *base);
+CY_CORDIC_Q31_t    Cy_CORDIC_Sin(CORDIC_Type *base, CY_CORDIC_Q31_t angle);
+CY_CORDIC_Q31_t    Cy_CORDIC_Cos(CORDIC_Type *base, CY_CORDIC_Q31_t angle);
+CY_CORDIC_20Q11_t  Cy_CORDIC_Tan(CORDIC_Type *base, CY_CORDIC_Q31_t angle);
+CY_CORDIC_Q31_t    Cy_CORDIC_ArcTan(CORDIC_Type *base, CY_CORDIC_8Q23_t x, CY_CORDIC_8Q23_t y);
+CY_CORDIC_1Q30_t   Cy_CORDIC_Sinh(CORDIC_Type *base, CY_CORDIC_Q31_t angle);
+CY_CORDIC_1Q30_t   Cy_CORDIC_Cosh(CORDIC_Type *base, CY_CORDIC_Q31_t angle);
+CY_CORDIC_20Q11_t  Cy_CORDIC_Tanh(CORDIC_Type *base, CY_CORDIC_Q31_t angle);
+CY_CORDIC_Q31_t    Cy_CORDIC_ArcTanh(CORDIC_Type *base, CY_CORDIC_8Q23_t x, CY_CORDIC_8Q23_t y);
+CY_CORDIC_Q31_t    Cy_CORDIC_Sqrt(CORDIC_Type *base, CY_CORDIC_Q31_t x);
+void               Cy_CORDIC_ParkTransformNB(CORDIC_Type *base, CY_CORDIC_Q31_t theta,
+                                             CY_CORDIC_Q31_t ialpha, CY_CORDIC_Q31_t ibeta);
+void               Cy_CORDIC_GetParkResult(CORDIC_Type *base,
+                                           cy_stc_cordic_parkTransform_result_t *result);
+
+#endif /*CY_PDL_H*/
+/* [] END OF FILE */
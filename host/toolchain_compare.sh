@@ -0,0 +1,166 @@
+#!/bin/sh
+################################################################################
+# \file toolchain_compare.sh
+# \version 1.0
+#
+# \brief
+# Compares the code generated by the available toolchains and optimization
+# levels for the CORDIC operation suite (cordic_suite.c) and tabulates the
+# cycles and the code size per operation.
+#
+# Host compilers: the firmware is built natively with each compiler and
+# optimization level and the suite runs on the CORDIC emulator. Cycles are
+# nanoseconds of the development machine.
+#
+# Target toolchains: when ModusToolbox and the toolchain are installed, the
+# firmware is built with TOOLCHAIN=<name> CONFIG=Custom OPT_LEVEL=<level> and
+# the code size of each operation is read from the ELF. With TARGET_UART set
+# to the KitProg3 serial device, each build is programmed and the suite cycles
+# are read from the debug UART. Toolchains that fail to build are skipped.
+#
+# usage: host/toolchain_compare.sh [output.csv]
+#
+# Environment:
+# HOST_COMPILERS     host compilers, default "gcc clang"
+# HOST_OPT_LEVELS    host optimization levels, default "-O0 -O1 -O2 -O3 -Os"
+# TARGET_TOOLCHAINS  ModusToolbox toolchains, default "GCC_ARM ARM IAR LLVM_ARM",
+#                    set to "" to skip the target builds
+# TARGET_UART        serial device of the kit, empty for code size only
+# NM                 nm reading the target ELF files, default arm-none-eabi-nm
+#
+################################################################################
+# \copyright
+# Copyright 2026, Cypress Semiconductor Corporation (an Infineon company)
+# SPDX-License-Identifier: Apache-2.0
+# 
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+# 
+#     http://www.apache.org/licenses/LICENSE-2.0
+# 
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+################################################################################
+
+set -u
+
+script_dir=$(cd "$(dirname "$0")" && pwd)
+app_dir=$(dirname "$script_dir")
+csv=${1:-$script_dir/build/toolchain_compare.csv}
+
+HOST_COMPILERS=${HOST_COMPILERS-"gcc clang"}
+HOST_OPT_LEVELS=${HOST_OPT_LEVELS-"-O0 -O1 -O2 -O3 -Os"}
+TARGET_TOOLCHAINS=${TARGET_TOOLCHAINS-"GCC_ARM ARM IAR LLVM_ARM"}
+TARGET_UART=${TARGET_UART-""}
+NM=${NM-arm-none-eabi-nm}
+
+# Names from the application Makefile
+target=$(sed -n 's/^TARGET=//p' "$app_dir/Makefile")
+appname=$(sed -n 's/^APPNAME=//p' "$app_dir/Makefile")
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Position of the operation suite in the benchmark menu
+suite_index=$(awk '/cordic_benchmarks\[\] =/ { list = 1; n = -1 }
+                   list && /^ *\{"/        { n++ }
+                   list && /"operation suite"/ { print n; exit }' "$app_dir/cordic_benchmark.c")
+
+# Optimization levels of a target toolchain
+target_opt_levels()
+{
+    if [ "$1" = "IAR" ]; then
+        echo "-On -Ol -Om -Oh -Ohs -Ohz"
+    else
+        echo "-O0 -O1 -O2 -O3 -Os"
+    fi
+}
+
+# Code size of the suite_op_ functions from nm -S output, "operation size" lines
+suite_sizes()
+{
+    awk 'function hex(s,   i, v) { v = 0; s = tolower(s);
+                                   for (i = 1; i <= length(s); i++) v = v * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1;
+                                   return v }
+         $4 ~ /^suite_op_/ { sub(/^suite_op_/, "", $4); print $4, hex($2) }'
+}
+
+# CSV rows from the suite output ($2) and the sizes ($1) of one build
+tabulate()
+{
+    awk -v toolchain="$3" -v opt="$4" '
+        NR == FNR { size[$1] = $2; next }
+        /^suite \|/ && !/done/ && !/operation/ {
+            split($0, f, "|"); op = f[2]; cycles = f[3];
+            gsub(/ /, "", op); gsub(/ /, "", cycles);
+            printf "%s,%s,%s,%s,%s\n", toolchain, opt, op, cycles, (op in size) ? size[op] : "-"
+        }' "$1" "$2"
+}
+
+mkdir -p "$(dirname "$csv")"
+echo "toolchain,opt,operation,cycles,size" > "$csv"
+
+# Host compilers on the CORDIC emulator
+for cc in $HOST_COMPILERS; do
+    if ! command -v "$cc" >/dev/null 2>&1; then
+        echo "host $cc: not installed, skipped"
+        continue
+    fi
+    for opt in $HOST_OPT_LEVELS; do
+        dir=build/compare/$cc$opt
+        echo "host $cc $opt"
+        if ! make -s -C "$script_dir" CC="$cc" OPT="$opt" BUILD_DIR="$dir" "$dir/cordic_firmware" >"$tmp/build.log" 2>&1; then
+            echo "  build failed, see below"; cat "$tmp/build.log"
+            continue
+        fi
+        printf '10\n%s\n' "$suite_index" | "$script_dir/$dir/cordic_firmware" | tr -d '\r' >"$tmp/suite.txt"
+        nm -S "$script_dir/$dir/cordic_firmware" | suite_sizes >"$tmp/sizes.txt"
+        tabulate "$tmp/sizes.txt" "$tmp/suite.txt" "host-$cc" "$opt" >>"$csv"
+    done
+done
+
+# Target toolchains, code size and, with a kit connected, cycles
+for toolchain in $TARGET_TOOLCHAINS; do
+    for opt in $(target_opt_levels "$toolchain"); do
+        echo "target $toolchain $opt"
+        if ! make -C "$app_dir" build TOOLCHAIN="$toolchain" CONFIG=Custom OPT_LEVEL="$opt" >"$tmp/build.log" 2>&1; then
+            echo "  not available, skipped"
+            break
+        fi
+        elf=$app_dir/build/APP_$target/Custom/$appname.elf
+        "$NM" -S "$elf" | suite_sizes >"$tmp/sizes.txt"
+        : >"$tmp/suite.txt"
+
+        if [ -n "$TARGET_UART" ] &&
+           make -C "$app_dir" qprogram TOOLCHAIN="$toolchain" CONFIG=Custom OPT_LEVEL="$opt" >"$tmp/program.log" 2>&1; then
+            stty -F "$TARGET_UART" 115200 raw -echo
+            (sleep 2; printf '10\r'; sleep 1; printf '%s\r' "$suite_index") >"$TARGET_UART" &
+            timeout 30 sed -n '/suite | done/q; p' <"$TARGET_UART" | tr -d '\r' >"$tmp/suite.txt"
+            wait
+        fi
+
+        # Without cycles from the kit, list the sizes only
+        if ! grep -q '^suite |' "$tmp/suite.txt"; then
+            awk '{ printf "suite | %s | -\n", $1 }' "$tmp/sizes.txt" >"$tmp/suite.txt"
+        fi
+        tabulate "$tmp/sizes.txt" "$tmp/suite.txt" "$toolchain" "$opt" >>"$csv"
+    done
+done
+
+# Per-operation table and totals per build, fastest first
+echo
+if command -v column >/dev/null 2>&1; then
+    column -t -s, "$csv"
+else
+    cat "$csv"
+fi
+echo
+echo "Totals over the suite, by cycles:"
+awk -F, 'NR > 1 { key = $1 " " $2; cycles[key] += ($4 == "-") ? 0 : $4; size[key] += ($5 == "-") ? 0 : $5 }
+         END { for (k in cycles) printf "%-24s %8d cycles %8d bytes\n", k, cycles[k], size[k] }' "$csv" | sort -k3,3n
+echo
+echo "Results written to $csv"